@@ -104,12 +104,23 @@
 */
 #define BRIDGE_MCU_MSG_FORMAT   "0.1"
 
+/* Msg format 0.2 replies to Read, BlockRead, Detect and Batch in binary rather than ASCII.  The Bridge requests it
+   by sending the minor version in the MCU msg format version command, otherwise replies stay in format 0.1.
+*/
+#define BRIDGE_MCU_MSG_FORMAT_BINARY        "0.2"
+#define BRIDGE_MCU_MSG_FORMAT_BINARY_MINOR  (2)
+
+/* Msg format 0.3 adds streaming block writes, with binary replies as for 0.2.
+*/
+#define BRIDGE_MCU_MSG_FORMAT_STREAM        "0.3"
+#define BRIDGE_MCU_MSG_FORMAT_STREAM_MINOR  (3)
+
 #define WRITE_OK        ("Ok")
 
 // Binary payload field offsets
 #define LENGTH_OFFSET   (0)
 #define OPCODE_OFFSET   (2)
-// For PV only
+// For PV and MCU msg format version only
 #define VERSION_OFFSET  (3)
 // For R, W, BR, BWs only
 #define CHIPID_OFFSET   (3)
@@ -120,6 +131,37 @@
 #define READ_LEN_OFFSET  (8)
 // For BWc only
 #define REG_VAL_OFFSET_BWC  (3)
+// For Batch only
+#define BATCH_COUNT_OFFSET  (3)
+#define BATCH_OPS_OFFSET    (4)
+// For BWS start only
+#define STREAM_LEN_OFFSET   (8)
+// For BWS data only
+#define STREAM_DATA_OFFSET  (3)
+
+/* Batch operations
+   Each is | Op type | Chip-Id | Reg addr | Reg value (Write only) |
+             1-byte    1-byte    4-bytes    4-bytes
+*/
+#define BATCH_OP_READ           (0)
+#define BATCH_OP_WRITE          (1)
+#define BATCH_OP_READ_LEN       (6)
+#define BATCH_OP_WRITE_LEN      (10)
+
+/* Binary reply field offsets, for msg format 0.2
+   | Reply Length | Status | Data ...
+     2-bytes        1-byte
+   Reply Length includes itself and is little-endian, as are all data values.  Status is 0 or one of the error codes
+   below.
+*/
+#define REPLY_LENGTH_OFFSET     (0)
+#define REPLY_STATUS_OFFSET     (2)
+#define REPLY_DATA_OFFSET       (3)
+#define REPLY_STATUS_OK         (0)
+
+// BWS start reply data: | Window bytes | Max chunk bytes |
+//                          2-bytes        2-bytes
+#define STREAM_REPLY_LENGTH     (4)
 
 
 /***********************************************************************************************************************
@@ -138,6 +180,7 @@ typedef struct
 {
     const uint8_t opcode;
     bridge_command_handler_t handler;
+    const bool binary_reply;    // Reply is binary in msg format 0.2
 } bridge_command_handler_map_t;
 
 /***********************************************************************************************************************
@@ -156,6 +199,13 @@ static bridge_t bridge;
 static uint32_t bw_addr = 0;
 static uint32_t bw_data_collect_indx = 0;
 static size_t reg_sz = sizeof(uint32_t);
+static bool msg_format_binary = false;
+static bool msg_format_stream = false;
+static uint16_t reply_length = 0;
+static bridge_device_t *bws_device = NULL;
+static uint32_t bws_addr = 0;
+static uint32_t bws_bytes_left = 0;
+static const char hex_digits[] = "0123456789ABCDEF";
 
 static uint32_t handle_protocol_version(unsigned char *cmd);
 static uint32_t handle_info(unsigned char *cmd);
@@ -170,6 +220,9 @@ static uint32_t handle_unsupported(unsigned char *cmd);
 static uint32_t handle_invalid(unsigned char *cmd);
 static uint32_t handle_current_device(unsigned char *cmd);
 static uint32_t handle_mcu_msg_format_version(unsigned char *cmd);
+static uint32_t handle_batch(unsigned char *cmd);
+static uint32_t handle_blockwrite_stream_start(unsigned char *cmd);
+static uint32_t handle_blockwrite_stream_data(unsigned char *cmd);
 
 
 // An array of coded command Ids mapped to their handler functions
@@ -178,10 +231,10 @@ static const bridge_command_handler_map_t command_handler_map[] =
     {.opcode = 0x1,     .handler = handle_current_device},          // CurrentDevice
     {.opcode = 0x2,     .handler = handle_protocol_version},        // ProtocolVersion
     {.opcode = 0x3,     .handler = handle_info},                    // Info
-    {.opcode = 0x4,     .handler = handle_detect},                  // Detect
-    {.opcode = 0x5,     .handler = handle_read},                    // Read
+    {.opcode = 0x4,     .handler = handle_detect,       .binary_reply = true},  // Detect
+    {.opcode = 0x5,     .handler = handle_read,         .binary_reply = true},  // Read
     {.opcode = 0x6,     .handler = handle_write},                   // Write
-    {.opcode = 0x7,     .handler = handle_blockread},               // BlockRead
+    {.opcode = 0x7,     .handler = handle_blockread,    .binary_reply = true},  // BlockRead
     {.opcode = 0x8,     .handler = handle_blockwrite_start},        // BlockWrite
     {.opcode = 0x9,     .handler = handle_blockwrite_cont},
     {.opcode = 0xa,     .handler = handle_blockwrite_end},
@@ -190,7 +243,10 @@ static const bridge_command_handler_map_t command_handler_map[] =
     {.opcode = 0xd,     .handler = handle_unsupported},             // ServiceMessage
     {.opcode = 0xe,     .handler = handle_invalid},                 // ServiceAvailable
     {.opcode = 0xf,     .handler = handle_unsupported},             // Shutdown
-    {.opcode = 0x10,    .handler = handle_mcu_msg_format_version}   // MCU msg format version
+    {.opcode = 0x10,    .handler = handle_mcu_msg_format_version},  // MCU msg format version
+    {.opcode = 0x11,    .handler = handle_batch,        .binary_reply = true},  // Batch
+    {.opcode = 0x12,    .handler = handle_blockwrite_stream_start,  .binary_reply = true},  // BlockWrite stream
+    {.opcode = 0x13,    .handler = handle_blockwrite_stream_data,   .binary_reply = true}
 };
 
 /***********************************************************************************************************************
@@ -201,6 +257,27 @@ static const bridge_command_handler_map_t command_handler_map[] =
  * LOCAL FUNCTIONS
  **********************************************************************************************************************/
 
+static bridge_device_t *get_device(uint8_t chip_num)
+{
+    uint8_t device_index = chip_num - 1;
+
+    if (device_index < bridge.num_devices)
+    {
+        return &(bridge.device_list[device_index]);
+    }
+
+    return NULL;
+}
+
+// Fill in the Reply Length and Status of a binary reply, for msg format 0.2
+static void set_binary_reply(unsigned char *u_cmd, uint8_t status, uint16_t data_length)
+{
+    reply_length = REPLY_DATA_OFFSET + data_length;
+    u_cmd[REPLY_LENGTH_OFFSET] = GET_BYTE_FROM_WORD(reply_length, 0);
+    u_cmd[REPLY_LENGTH_OFFSET + 1] = GET_BYTE_FROM_WORD(reply_length, 1);
+    u_cmd[REPLY_STATUS_OFFSET] = status;
+}
+
 /*
  * Functions that handle each of the bridge commands that we support
  */
@@ -256,7 +333,16 @@ static uint32_t handle_read(unsigned char *u_cmd)
         sprintf(cmd, "%s", WMT_READ_FAILED);
         return BRIDGE_STATUS_FAIL;
     }
-    sprintf(cmd, "%lu", reg_val);
+
+    if (msg_format_binary)
+    {
+        memcpy(&u_cmd[REPLY_DATA_OFFSET], &reg_val, sizeof(uint32_t));
+        set_binary_reply(u_cmd, REPLY_STATUS_OK, sizeof(uint32_t));
+    }
+    else
+    {
+        sprintf(cmd, "%lu", reg_val);
+    }
 
     return BRIDGE_STATUS_OK;
 }
@@ -327,12 +413,30 @@ static uint32_t handle_blockread(unsigned char *u_cmd)
     uint16_t block_read_length;
     memcpy((void*)&block_read_length, (void*)&u_cmd[READ_LEN_OFFSET], sizeof(uint16_t));
 
-    if (block_read_length > MAX_BLOCK_DATA_BYTES)
+    if (block_read_length > BRIDGE_MAX_BLOCK_READ_BYTES)
     {
         sprintf(cmd, "%s", WMT_UNSUPPORTED);
         return BRIDGE_STATUS_FAIL;
     }
 
+    if (msg_format_binary)
+    {
+        // Read straight into the reply
+        ret = regmap_read_block(&(bridge.current_device->b),
+                                read_addr,
+                                &u_cmd[REPLY_DATA_OFFSET],
+                                block_read_length);
+        if(ret != REGMAP_STATUS_OK)
+        {
+            sprintf(cmd, "%s", WMT_READ_FAILED);
+            return BRIDGE_STATUS_FAIL;
+        }
+
+        set_binary_reply(u_cmd, REPLY_STATUS_OK, block_read_length);
+
+        return BRIDGE_STATUS_OK;
+    }
+
     ret = regmap_read_block(&(bridge.current_device->b), read_addr, block_buffer, block_read_length);
     if(ret != REGMAP_STATUS_OK)
     {
@@ -343,7 +447,8 @@ static uint32_t handle_blockread(unsigned char *u_cmd)
     for(uint32_t i = 0; i < block_read_length; ++i)
     {
         // Convert each byte value into ASCII hex
-        sprintf(&cmd[i*2], "%02X", block_buffer[i]);
+        cmd[i*2] = hex_digits[block_buffer[i] >> 4];
+        cmd[(i*2) + 1] = hex_digits[block_buffer[i] & 0xF];
     }
     cmd[block_read_length*2] = '\0'; // Manually add null terminator
 
@@ -473,9 +578,20 @@ static uint32_t handle_detect(unsigned char *u_cmd)
 {
     char *cmd = (char*)u_cmd;
     const char *bus_name_str;
-    char temp_str[MAX_BRIDGE_DEVICE_NAME_LEN+1]; // Holds the dev_name_str eg "Shelley_Left,", plus one for safety
+    uint32_t index = 0;
+
+    /*
+     In msg format 0.2 the reply data is:
+        | Num devices | Bus type | Bus addr | Driver ctrl | Name length | Name | Id length | Id | ...
+          1-byte        1-byte     1-byte     1-byte        1-byte               1-byte
+     with Bus type 0 for I2C and 1 for SPI, repeated for each device
+     */
+    if (msg_format_binary)
+    {
+        index = REPLY_DATA_OFFSET;
+        u_cmd[index++] = bridge.num_devices;
+    }
 
-    cmd[0] = '\0';  // 0-out the cmd string for reuse
     for (uint8_t i = 0; i < bridge.num_devices; i++)
     {
         if (bridge.device_list[i].b.bus_type == REGMAP_BUS_TYPE_SPI)
@@ -498,20 +614,42 @@ static uint32_t handle_detect(unsigned char *u_cmd)
         }
 #endif
 
-        sprintf(temp_str, "%s,", bridge.device_list[i].dev_name_str);
-        strcat(cmd, temp_str);
-        sprintf(temp_str, "%s,", bus_name_str);
-        strcat(cmd, temp_str);
-        sprintf(temp_str, "%x,", bridge.device_list[i].bus_i2c_cs_address);
-        strcat(cmd, temp_str);
-        sprintf(temp_str, "%s,", DRIVER_CTRL);
-        strcat(cmd, temp_str);
-        sprintf(temp_str, "%s:", bridge.device_list[i].device_id_str);
-        strcat(cmd, temp_str);
+        if (msg_format_binary)
+        {
+            uint8_t len;
+
+            u_cmd[index++] = (bus_name_str == bus_name_spi) ? 1 : 0;
+            u_cmd[index++] = bridge.device_list[i].bus_i2c_cs_address;
+            u_cmd[index++] = 0; // DRIVER_CTRL
+            len = strlen(bridge.device_list[i].dev_name_str);
+            u_cmd[index++] = len;
+            memcpy(&u_cmd[index], bridge.device_list[i].dev_name_str, len);
+            index += len;
+            len = strlen(bridge.device_list[i].device_id_str);
+            u_cmd[index++] = len;
+            memcpy(&u_cmd[index], bridge.device_list[i].device_id_str, len);
+            index += len;
+        }
+        else
+        {
+            index += sprintf(&cmd[index],
+                             "%s,%s,%x,%s,%s:",
+                             bridge.device_list[i].dev_name_str,
+                             bus_name_str,
+                             bridge.device_list[i].bus_i2c_cs_address,
+                             DRIVER_CTRL,
+                             bridge.device_list[i].device_id_str);
+        }
     }
 
-    uint32_t index = strlen(cmd) - 1;
-    cmd[index] = '\0'; // remove the final ':'
+    if (msg_format_binary)
+    {
+        set_binary_reply(u_cmd, REPLY_STATUS_OK, index - REPLY_DATA_OFFSET);
+    }
+    else if (index > 0)
+    {
+        cmd[index - 1] = '\0'; // remove the final ':'
+    }
 
     return BRIDGE_STATUS_OK;
 }
@@ -543,7 +681,233 @@ static uint32_t handle_current_device(unsigned char *u_cmd)
 static uint32_t handle_mcu_msg_format_version(unsigned char *u_cmd)
 {
     char *cmd = (char*)u_cmd;
-    sprintf(cmd, "%s", BRIDGE_MCU_MSG_FORMAT);
+    uint16_t payload_len;
+
+    // The Bridge may request a msg format by sending its minor version, older Bridges send no version
+    payload_len = u_cmd[LENGTH_OFFSET] << 8;
+    payload_len |= u_cmd[LENGTH_OFFSET+1];
+    msg_format_binary = ((payload_len > VERSION_OFFSET) && \
+                         (u_cmd[VERSION_OFFSET] >= BRIDGE_MCU_MSG_FORMAT_BINARY_MINOR));
+    msg_format_stream = ((payload_len > VERSION_OFFSET) && \
+                         (u_cmd[VERSION_OFFSET] >= BRIDGE_MCU_MSG_FORMAT_STREAM_MINOR));
+    bws_bytes_left = 0;
+
+    // Reply with the msg format that will be used
+    if (msg_format_stream)
+    {
+        sprintf(cmd, "%s", BRIDGE_MCU_MSG_FORMAT_STREAM);
+    }
+    else if (msg_format_binary)
+    {
+        sprintf(cmd, "%s", BRIDGE_MCU_MSG_FORMAT_BINARY);
+    }
+    else
+    {
+        sprintf(cmd, "%s", BRIDGE_MCU_MSG_FORMAT);
+    }
+
+    return BRIDGE_STATUS_OK;
+}
+
+// User has executed a batch of register reads and writes, for any chip Ids, in one message.
+// Only supported in msg format 0.2.
+static uint32_t handle_batch(unsigned char *u_cmd)
+{
+    char *cmd = (char*)u_cmd;
+    uint16_t payload_len;
+    uint8_t num_ops, num_done;
+    uint32_t op_index, reply_index, ret;
+
+    /*
+     Agent to MCU:
+        | Payload Length | Batch OpCode | Num ops | Op | Op | ...
+          2-bytes          1-byte         1-byte
+     with each Op as described for BATCH_OP_
+
+     MCU to Agent reply data:
+        | Num ops done | Reg value | Reg value | ...
+          1-byte         4-bytes     4-bytes
+     with a Reg value for each Read op done.  If an op fails, Status is its error code and Num ops done is its index.
+
+     The reply is built in place over the command.  Each Read op is longer than the value it adds to the reply, so the
+     reply never overtakes the ops still to be done.
+    */
+    if (!msg_format_binary)
+    {
+        sprintf(cmd, "%s", WMT_UNSUPPORTED);
+        return BRIDGE_STATUS_FAIL;
+    }
+
+    payload_len = u_cmd[LENGTH_OFFSET] << 8;
+    payload_len |= u_cmd[LENGTH_OFFSET+1];
+    num_ops = u_cmd[BATCH_COUNT_OFFSET];
+    op_index = BATCH_OPS_OFFSET;
+    reply_index = REPLY_DATA_OFFSET + 1;
+
+    for (num_done = 0; num_done < num_ops; num_done++)
+    {
+        uint8_t op_type = u_cmd[op_index];
+        bridge_device_t *device = get_device(u_cmd[op_index + 1]);
+        const char *err = NULL;
+        uint32_t addr, val;
+
+        if ((op_index + ((op_type == BATCH_OP_WRITE) ? BATCH_OP_WRITE_LEN : BATCH_OP_READ_LEN)) > payload_len)
+        {
+            err = WMT_INVALID_COMMAND;
+        }
+        else if (device == NULL)
+        {
+            err = WMT_NO_DEVICE;
+        }
+        else if (op_type == BATCH_OP_READ)
+        {
+            memcpy(&addr, &u_cmd[op_index + 2], sizeof(uint32_t));
+            op_index += BATCH_OP_READ_LEN;
+
+            ret = regmap_read(&(device->b), addr, &val);
+            if (ret != REGMAP_STATUS_OK)
+            {
+                err = WMT_READ_FAILED;
+            }
+            else
+            {
+                memcpy(&u_cmd[reply_index], &val, sizeof(uint32_t));
+                reply_index += sizeof(uint32_t);
+            }
+        }
+        else if (op_type == BATCH_OP_WRITE)
+        {
+            memcpy(&addr, &u_cmd[op_index + 2], sizeof(uint32_t));
+            memcpy(&val, &u_cmd[op_index + 6], sizeof(uint32_t));
+            op_index += BATCH_OP_WRITE_LEN;
+
+            ret = regmap_write(&(device->b), addr, val);
+            if (ret != REGMAP_STATUS_OK)
+            {
+                err = WMT_WRITE_FAILED;
+            }
+        }
+        else
+        {
+            err = WMT_INVALID_COMMAND;
+        }
+
+        if (err != NULL)
+        {
+            u_cmd[REPLY_DATA_OFFSET] = num_done;
+            set_binary_reply(u_cmd, strtoul(err, NULL, 16), reply_index - REPLY_DATA_OFFSET);
+
+            return BRIDGE_STATUS_OK;
+        }
+    }
+
+    u_cmd[REPLY_DATA_OFFSET] = num_done;
+    set_binary_reply(u_cmd, REPLY_STATUS_OK, reply_index - REPLY_DATA_OFFSET);
+
+    return BRIDGE_STATUS_OK;
+}
+
+// User has executed a block-write command on WISCE/SCS, and the Bridge streams it in msg format 0.3.
+// Rather than collecting the whole block, each chunk is written to the device as it arrives.
+static uint32_t handle_blockwrite_stream_start(unsigned char *u_cmd)
+{
+    char *cmd = (char*)u_cmd;
+    uint32_t total_len;
+
+    /*
+            MCU                                    Agent
+                <-- | Payload Length | BWS OpCode | Chip-Id | Start Addr | Total bytes |
+                        2-bytes         1-byte      1-byte     4-bytes      4-bytes
+
+                    | Reply Length | Status | Window bytes | Max chunk bytes |  -->
+                      2-bytes        1-byte   2-bytes        2-bytes
+
+                <-- | Payload Length | BWS data OpCode | Reg value | Reg value | ...
+                <-- | Payload Length | BWS data OpCode | Reg value | Reg value | ...
+                    :
+                    | Reply Length | Status |  -->
+                    | Reply Length | Status |  -->
+                    :
+
+     The agent may send data chunks back-to-back, as long as the payloads of chunks it has not yet had a reply to add
+     up to no more than Window bytes.  There is a reply to every data chunk.  If a chunk fails, the stream is
+     abandoned, and it and any later chunks reply with an error Status.
+    */
+    if (!msg_format_stream)
+    {
+        sprintf(cmd, "%s", WMT_UNSUPPORTED);
+        return BRIDGE_STATUS_FAIL;
+    }
+
+    bws_bytes_left = 0;
+    bws_device = get_device(u_cmd[CHIPID_OFFSET]);
+    if (bws_device == NULL)
+    {
+        sprintf(cmd, "%s", WMT_NO_DEVICE);
+        return BRIDGE_STATUS_FAIL;
+    }
+    bridge.current_device = bws_device;
+
+    memcpy(&bws_addr, &u_cmd[REG_ADDR_OFFSET], sizeof(uint32_t));
+    memcpy(&total_len, &u_cmd[STREAM_LEN_OFFSET], sizeof(uint32_t));
+
+    if ((total_len == 0) || ((total_len % BRIDGE_REG_BYTES) != 0))
+    {
+        sprintf(cmd, "%s", WMT_INVALID_COMMAND);
+        return BRIDGE_STATUS_FAIL;
+    }
+
+    bws_bytes_left = total_len;
+
+    u_cmd[REPLY_DATA_OFFSET] = GET_BYTE_FROM_WORD(BRIDGE_STREAM_WINDOW_BYTES, 0);
+    u_cmd[REPLY_DATA_OFFSET + 1] = GET_BYTE_FROM_WORD(BRIDGE_STREAM_WINDOW_BYTES, 1);
+    u_cmd[REPLY_DATA_OFFSET + 2] = GET_BYTE_FROM_WORD(BRIDGE_MAX_BLOCK_WRITE_BYTES, 0);
+    u_cmd[REPLY_DATA_OFFSET + 3] = GET_BYTE_FROM_WORD(BRIDGE_MAX_BLOCK_WRITE_BYTES, 1);
+    set_binary_reply(u_cmd, REPLY_STATUS_OK, STREAM_REPLY_LENGTH);
+
+    return BRIDGE_STATUS_OK;
+}
+
+static uint32_t handle_blockwrite_stream_data(unsigned char *u_cmd)
+{
+    char *cmd = (char*)u_cmd;
+    uint16_t payload_len, chunk_len;
+    uint32_t ret, stride;
+
+    if (bws_bytes_left == 0)
+    {
+        sprintf(cmd, "%s", WMT_INVALID_COMMAND);
+        return BRIDGE_STATUS_FAIL;
+    }
+
+    payload_len = u_cmd[LENGTH_OFFSET] << 8;
+    payload_len |= u_cmd[LENGTH_OFFSET+1];
+    chunk_len = payload_len - STREAM_DATA_OFFSET;
+
+    if ((payload_len <= STREAM_DATA_OFFSET) ||
+        ((chunk_len % BRIDGE_REG_BYTES) != 0) ||
+        (chunk_len > BRIDGE_MAX_BLOCK_WRITE_BYTES) ||
+        (chunk_len > bws_bytes_left))
+    {
+        bws_bytes_left = 0;
+        sprintf(cmd, "%s", WMT_INVALID_COMMAND);
+        return BRIDGE_STATUS_FAIL;
+    }
+
+    // The chunk is written straight from the command, at the address following the previous chunk
+    ret = regmap_write_block(&(bws_device->b), bws_addr, &u_cmd[STREAM_DATA_OFFSET], chunk_len);
+    if (ret != REGMAP_STATUS_OK)
+    {
+        bws_bytes_left = 0;
+        sprintf(cmd, "%s", WMT_WRITE_FAILED);
+        return BRIDGE_STATUS_FAIL;
+    }
+
+    stride = (bws_device->reg_addr_stride != 0) ? bws_device->reg_addr_stride : BRIDGE_REG_BYTES;
+    bws_addr += (chunk_len / BRIDGE_REG_BYTES) * stride;
+    bws_bytes_left -= chunk_len;
+
+    set_binary_reply(u_cmd, REPLY_STATUS_OK, 0);
 
     return BRIDGE_STATUS_OK;
 }
@@ -649,6 +1013,7 @@ void bridge_process(void)
         uint32_t ret;
         uint8_t opcode = cmd_resp[OPCODE_OFFSET];
         bridge_command_handler_t handler = NULL;
+        bool binary_reply = false;
 
         // Find the correct handler for the bridge command
         for (uint8_t k = 0; k < (sizeof(command_handler_map)/sizeof(bridge_command_handler_map_t)); k++)
@@ -656,6 +1021,7 @@ void bridge_process(void)
             if (opcode == command_handler_map[k].opcode)
             {
                 handler = command_handler_map[k].handler;
+                binary_reply = msg_format_binary && command_handler_map[k].binary_reply;
                 break;
             }
         }
@@ -665,9 +1031,19 @@ void bridge_process(void)
             handler = handle_unsupported;
         }
 
+        reply_length = 0;
         ret = handler(cmd_resp);
 
-        if (ret != BRIDGE_STATUS_OK)
+        if (binary_reply)
+        {
+            if (ret != BRIDGE_STATUS_OK)
+            {
+                // Handler left an error code string, so send it as the Status of an empty reply
+                set_binary_reply(cmd_resp, strtoul((char *) cmd_resp, NULL, 16), 0);
+            }
+            fwrite(cmd_resp, 1, reply_length, bridge_write_file);
+        }
+        else if (ret != BRIDGE_STATUS_OK)
         {
             // Handler returned an error so send an error msg back to bridge
             fprintf(bridge_write_file, "%s %s\n", ERROR, cmd_resp);
@@ -54,6 +54,12 @@ extern "C" {
     #define BRIDGE_BLOCK_BUFFER_LENGTH_BYTES    (BRIDGE_MAX_BLOCK_READ_BYTES)
 #endif
 
+// Streaming block writes (msg format 0.3) let the agent send chunks without waiting for each reply, as long as the
+// bytes of unacknowledged chunks fit in this window.  It must not exceed the receive buffering of the transport.
+#ifndef BRIDGE_STREAM_WINDOW_BYTES
+    #define BRIDGE_STREAM_WINDOW_BYTES          (1024)
+#endif
+
 /***********************************************************************************************************************
  * MACROS
  **********************************************************************************************************************/
@@ -70,6 +76,9 @@ typedef struct
     // WISCE/SCS will use this in their commands to target the correct device
     const char *dev_name_str;
     uint8_t bus_i2c_cs_address;
+    // reg_addr_stride is the address increment per BRIDGE_REG_BYTES of block data, used to advance streaming block
+    // writes.  Leave as 0 for byte-addressed devices, i.e. an increment of BRIDGE_REG_BYTES
+    uint8_t reg_addr_stride;
     regmap_cp_config_t b;
 } bridge_device_t;
 
@@ -87,6 +87,44 @@ extern "C" {
 #define BSP_SUPPLY_DISABLE              (0)
 #define BSP_SUPPLY_ENABLE               (1)
 
+/**
+ * @defgroup BSP_BUS_TYPE_
+ * @brief Type of control port bus to arbitrate
+ * @see bsp_driver_if_t.bus_lock
+ * @{
+ */
+#define BSP_BUS_TYPE_I2C                (0)
+#define BSP_BUS_TYPE_SPI                (1)
+/** @} */
+
+/**
+ * @defgroup BSP_BUS_PRIORITY_
+ * @brief Priority of a request to lock a control port bus
+ *
+ * When a bus is unlocked, it is granted to the waiting request with the highest priority.  Requests of equal priority
+ * are granted in the order they were made.
+ *
+ * @see bsp_driver_if_t.bus_lock
+ * @{
+ */
+#define BSP_BUS_PRIORITY_NORMAL         (0)     ///< i.e. configuration and firmware download
+#define BSP_BUS_PRIORITY_HIGH           (1)     ///< i.e. amplifier speaker protection event handling
+/** @} */
+
+/**
+ * @defgroup BSP_CLOCK_STATE_
+ * @brief Power/clocking state of a device, which sets the fastest control port clock it can take
+ *
+ * @see regmap_set_clock_state
+ * @{
+ */
+#define BSP_CLOCK_STATE_RESET           (0)     ///< Held in or coming out of reset
+#define BSP_CLOCK_STATE_OTP_BOOT        (1)     ///< OTP boot done, running from the internal oscillator
+#define BSP_CLOCK_STATE_PLL_LOCKED      (2)     ///< PLL/FLL locked, i.e. SYSCLK running
+#define BSP_CLOCK_STATE_HIBERNATE       (3)     ///< Hibernating, only the wake-up logic is clocked
+#define BSP_CLOCK_STATE_TOTAL           (4)
+/** @} */
+
 
 /***********************************************************************************************************************
  * MACROS
@@ -204,6 +242,18 @@ typedef struct
      */
     uint32_t (*set_timer)(uint32_t duration_ms, bsp_callback_t cb, void *cb_arg);
 
+    /**
+     * Get the time since BSP initialization
+     *
+     * Lets drivers time periodic or long-running work against deadlines, leaving set_timer free for blocking delays.
+     * The count wraps around, so compare times by their difference.  May be NULL if the BSP has no millisecond time
+     * base, in which case driver features that need one fail.
+     *
+     * @return                      Time in milliseconds
+     *
+     */
+    uint32_t (*get_time_ms)(void);
+
     /**
      * Reset I2C Port used for a specific device
      *
@@ -420,6 +470,56 @@ typedef struct
      *
      */
     uint32_t (*spi_restore_speed)(void);
+
+    /**
+     * Set the fastest SPI clock speed a device can take
+     *
+     * The BSP uses the fastest bus clock at or below speed_hz for all later transactions with the device, until the
+     * next call.  The clock is switched when the device is next selected, so devices sharing the bus can each run at
+     * their own speed.  A throttle set by spi_throttle_speed() still applies on top.  May be NULL if the BSP only
+     * supports a fixed SPI clock speed.
+     *
+     * @param [in] bsp_dev_id       ID of the device
+     * @param [in] speed_hz         Fastest SPI clock speed for the device, or 0 for the speed given during BSP
+     *                              initialization
+     *
+     * @return
+     * - BSP_STATUS_FAIL            if bsp_dev_id is invalid, or if speed_hz is slower than the slowest available
+     * - BSP_STATUS_OK              otherwise
+     *
+     */
+    uint32_t (*spi_set_max_speed)(uint32_t bsp_dev_id, uint32_t speed_hz);
+
+    /**
+     * Lock the control port bus used by a device
+     *
+     * Blocks until the bus is granted to the calling task.  A task holding the bus may lock it again, i.e. to make a
+     * sequence of transactions atomic, and each call must be matched by a call to bus_unlock.  May be NULL if the BSP
+     * does not run multiple tasks.
+     *
+     * @param [in] bsp_dev_id       ID of the device
+     * @param [in] bus_type         Type of control port bus used by the device - @see BSP_BUS_TYPE_
+     * @param [in] priority         Priority of the request - @see BSP_BUS_PRIORITY_
+     *
+     * @return
+     * - BSP_STATUS_FAIL            if bus_type is invalid, or if too many tasks are waiting for the bus
+     * - BSP_STATUS_OK              otherwise
+     *
+     */
+    uint32_t (*bus_lock)(uint32_t bsp_dev_id, uint8_t bus_type, uint8_t priority);
+
+    /**
+     * Unlock the control port bus used by a device
+     *
+     * @param [in] bsp_dev_id       ID of the device
+     * @param [in] bus_type         Type of control port bus used by the device - @see BSP_BUS_TYPE_
+     *
+     * @return
+     * - BSP_STATUS_FAIL            if bus_type is invalid, or if the calling task does not hold the bus
+     * - BSP_STATUS_OK              otherwise
+     *
+     */
+    uint32_t (*bus_unlock)(uint32_t bsp_dev_id, uint8_t bus_type);
 } bsp_driver_if_t;
 
 /***********************************************************************************************************************
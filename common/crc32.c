@@ -0,0 +1,58 @@
+/**
+ * @file crc32.c
+ *
+ * @brief CRC-32 used to protect records saved by the drivers
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2021 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include "crc32.h"
+
+/***********************************************************************************************************************
+ * LOCAL LITERAL SUBSTITUTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Reflected CRC-32 (IEEE 802.3) polynomial
+ */
+#define CRC32_POLYNOMIAL                    (0xEDB88320)
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Calculate CRC-32 of a block of bytes
+ *
+ */
+uint32_t crc32_calculate(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    while (length--)
+    {
+        crc ^= *(data++);
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            crc = (crc >> 1) ^ (CRC32_POLYNOMIAL & (0 - (crc & 0x1)));
+        }
+    }
+
+    return ~crc;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file crc32.h
+ *
+ * @brief
+ * CRC-32 used to protect records saved by the drivers, i.e. calibration records.
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2021 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef CRC32_H
+#define CRC32_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Calculate CRC-32 of a block of bytes
+ *
+ * @param [in] data             Pointer to bytes to calculate CRC over
+ * @param [in] length           Number of bytes
+ *
+ * @return                      CRC-32 (IEEE 802.3) of data
+ *
+ */
+uint32_t crc32_calculate(const uint8_t *data, uint32_t length);
+
+/**********************************************************************************************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CRC32_H
@@ -0,0 +1,426 @@
+/**
+ * @file fll.c
+ *
+ * @brief The common FLL configuration solver
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2021 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "fll.h"
+
+/***********************************************************************************************************************
+ * LOCAL LITERAL SUBSTITUTIONS
+ **********************************************************************************************************************/
+
+/**
+ * FLLHJ defines
+ */
+#define FLL_HJ_INT_MAX_N                    (1023)
+#define FLL_HJ_INT_MIN_N                    (1)
+#define FLL_HJ_FRAC_MAX_N                   (255)
+#define FLL_HJ_FRAC_MIN_N                   (2)
+#define FLL_HJ_LP_INT_MODE_THRESH           (100000)
+#define FLL_HJ_LOW_THRESH                   (192000)
+#define FLL_HJ_MID_THRESH                   (1152000)
+#define FLL_HJ_LOW_GAINS                    (0x23f0)
+#define FLL_HJ_MID_GAINS                    (0x22f2)
+#define FLL_HJ_HIGH_GAINS                   (0x21f0)
+
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+
+/***********************************************************************************************************************
+ * LOCAL VARIABLES
+ **********************************************************************************************************************/
+static const struct {
+    uint32_t min;
+    uint32_t max;
+    uint16_t  fratio;
+    int32_t  ratio;
+} fll_madera_sync_fratios[] = {
+    {       0,    64000, 4, 16 },
+    {   64000,   128000, 3,  8 },
+    {  128000,   256000, 2,  4 },
+    {  256000,  1000000, 1,  2 },
+    { 1000000, 13500000, 0,  1 },
+};
+
+struct fll_madera_gains {
+    uint32_t  min;
+    uint32_t  max;
+    int32_t   gain;            /* main gain */
+    int32_t   alt_gain;        /* alternate integer gain */
+};
+
+static const struct fll_madera_gains fll_madera_sync_gains[] = {
+    {       0,   256000, 0, -1 },
+    {  256000,  1000000, 2, -1 },
+    { 1000000, 13500000, 4, -1 },
+};
+
+static const struct fll_madera_gains fll_madera_main_gains[] = {
+    {       0,   100000, 0, 2 },
+    {  100000,   375000, 2, 2 },
+    {  375000,   768000, 3, 2 },
+    {  768001,  1500000, 3, 3 },
+    { 1500000,  6000000, 4, 3 },
+    { 6000000, 13500000, 5, 3 },
+};
+
+/***********************************************************************************************************************
+ * LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+static uint32_t fll_gcd(uint32_t n1, uint32_t n2)
+{
+    uint32_t t;
+
+    while (n2 != 0)
+    {
+        t = n1 % n2;
+        n1 = n2;
+        n2 = t;
+    }
+    return n1;
+}
+
+static int32_t fll_madera_find_sync_fratio(uint32_t fref, int32_t *fratio)
+{
+    uint32_t i;
+
+    for (i = 0; i < ARRAY_SIZE(fll_madera_sync_fratios); i++)
+    {
+        if (fll_madera_sync_fratios[i].min <= fref &&
+            fref <= fll_madera_sync_fratios[i].max)
+        {
+            *fratio = fll_madera_sync_fratios[i].fratio;
+            return fll_madera_sync_fratios[i].ratio;
+        }
+    }
+
+    return -1;
+}
+
+static int32_t fll_madera_find_main_fratio(uint32_t fref, uint32_t fout, int32_t *fratio)
+{
+    int32_t ratio = 1;
+
+    while ((fout / (ratio * fref)) > FLL_MADERA_MAX_N)
+    {
+        ratio++;
+    }
+    *fratio = ratio - 1;
+
+    return ratio;
+}
+
+static int32_t fll_madera_calc_fratio(fll_madera_cfg_t *cfg, uint32_t fref, uint32_t fout, bool sync)
+{
+    int32_t div;
+
+    /* fref must be <=13.5MHz, find initial refdiv */
+    div = 1;
+    cfg->refdiv = 0;
+    while (fref > FLL_MADERA_MAX_FREF)
+    {
+        div *= 2;
+        fref /= 2;
+        cfg->refdiv++;
+
+        if (div > FLL_MADERA_MAX_REFDIV)
+        {
+            return -1;  // return a neg value to signal an error
+        }
+    }
+
+    /* Find an appropriate FLL_FRATIO */
+    if (sync)
+    {
+        return fll_madera_find_sync_fratio(fref, &cfg->fratio);
+    }
+    else
+    {
+        return fll_madera_find_main_fratio(fref, fout, &cfg->fratio);
+    }
+}
+
+static uint32_t fll_madera_find_gain(fll_madera_cfg_t *cfg,
+                                     uint32_t fref,
+                                     const struct fll_madera_gains *gains,
+                                     uint32_t n_gains)
+{
+    uint32_t i;
+
+    for (i = 0; i < n_gains; i++)
+    {
+        if (gains[i].min <= fref && fref <= gains[i].max)
+        {
+            cfg->gain = gains[i].gain;
+            cfg->alt_gain = gains[i].alt_gain;
+            return FLL_STATUS_OK;
+        }
+    }
+    return FLL_STATUS_FAIL;
+}
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Solve the CS47L15/CS47L35 FLL or FLL synchroniser configuration
+ *
+ */
+uint32_t fll_madera_solve(uint32_t fref, uint32_t fout, bool sync, fll_madera_cfg_t *cfg)
+{
+    uint32_t gcd_fll;
+    int32_t ratio;
+
+    if (fref == 0)
+    {
+        return FLL_STATUS_FAIL;
+    }
+
+    /* Find an appropriate FLL_FRATIO and refdiv */
+    ratio = fll_madera_calc_fratio(cfg, fref, fout, sync);
+    if (ratio < 0)
+    {
+        return FLL_STATUS_FAIL;
+    }
+
+    /* Apply the division for our remaining calculations */
+    fref = fref / (1 << cfg->refdiv);
+
+    cfg->n = fout / (ratio * fref);
+
+    if (fout % (ratio * fref))
+    {
+        gcd_fll = fll_gcd(fout, ratio * fref);
+
+        cfg->theta = (fout - (cfg->n * ratio * fref)) / gcd_fll;
+        cfg->lambda = (ratio * fref) / gcd_fll;
+    }
+    else
+    {
+        cfg->theta = 0;
+        cfg->lambda = 0;
+    }
+
+    /*
+     * Round down to 16bit range with cost of accuracy lost.
+     * Denominator must be bigger than numerator so we only
+     * take care of it.
+     */
+    while (cfg->lambda >= (1 << 16))
+    {
+        cfg->theta >>= 1;
+        cfg->lambda >>= 1;
+    }
+
+    if (sync)
+    {
+        return fll_madera_find_gain(cfg, fref, fll_madera_sync_gains, ARRAY_SIZE(fll_madera_sync_gains));
+    }
+    else
+    {
+        return fll_madera_find_gain(cfg, fref, fll_madera_main_gains, ARRAY_SIZE(fll_madera_main_gains));
+    }
+}
+
+/**
+ * Get the CS47L15/CS47L35 FLL or FLL synchroniser configuration
+ *
+ */
+uint32_t fll_madera_calc(uint32_t fref, uint32_t fout, bool sync, fll_madera_cfg_t *cfg)
+{
+    uint32_t i;
+
+    for (i = 0; i < fll_madera_table_size; i++)
+    {
+        if (fll_madera_table[i].fref == fref &&
+            fll_madera_table[i].fout == fout &&
+            fll_madera_table[i].sync == sync)
+        {
+            *cfg = fll_madera_table[i].cfg;
+            return FLL_STATUS_OK;
+        }
+    }
+
+    return fll_madera_solve(fref, fout, sync, cfg);
+}
+
+/**
+ * Solve the CS47L63 FLLHJ configuration
+ *
+ */
+uint32_t fll_hj_solve(uint32_t fref, uint32_t fout, fll_hj_cfg_t *cfg)
+{
+    bool frac;
+    uint32_t refdiv, min_n, max_n, ratio, fbdiv, fllgcd, num;
+
+    if (fref == 0 || fout == 0)
+    {
+        return FLL_STATUS_FAIL;
+    }
+
+    for (refdiv = 0; refdiv < 4; refdiv++)
+    {
+        if ((fref / (1 << refdiv)) <= FLL_HJ_MAX_THRESH)
+        {
+            break;
+        }
+    }
+
+    fref = fref / (1 << refdiv);
+    frac = (fout % fref) != 0;
+
+    // Calc fb_div according to fref and whether frac mode
+    if (fref < FLL_HJ_LOW_THRESH)
+    {
+        cfg->lockdet_thr = 2;
+        cfg->gains = FLL_HJ_LOW_GAINS;
+        fbdiv = (frac) ? 256 : 4;
+    }
+    else if (fref < FLL_HJ_MID_THRESH)
+    {
+        cfg->lockdet_thr = 8;
+        cfg->gains = FLL_HJ_MID_GAINS;
+        fbdiv = (frac) ? 16 : 2;
+    }
+    else
+    {
+        cfg->lockdet_thr = 8;
+        cfg->gains = FLL_HJ_HIGH_GAINS;
+        fbdiv = 1;
+    }
+
+    // Use high performance mode for fractional configurations
+    if (frac)
+    {
+        cfg->hp = 0x3;
+        min_n = FLL_HJ_FRAC_MIN_N;
+        max_n = FLL_HJ_FRAC_MAX_N;
+    }
+    else
+    {
+        if (fref < FLL_HJ_LP_INT_MODE_THRESH)
+        {
+            cfg->hp = 0x0;
+        }
+        else
+        {
+            cfg->hp = 0x1;
+        }
+        min_n = FLL_HJ_INT_MIN_N;
+        max_n = FLL_HJ_INT_MAX_N;
+    }
+
+    ratio = fout / fref;
+
+    while (ratio / fbdiv < min_n)
+    {
+        fbdiv /= 2;
+        if (fbdiv < min_n)
+        {
+            return FLL_STATUS_FAIL;
+        }
+    }
+    while (frac && (ratio / fbdiv > max_n))
+    {
+        fbdiv *= 2;
+        if (fbdiv >= 1024)
+        {
+            return FLL_STATUS_FAIL;
+        }
+    }
+
+    // Calc N.K, theta, lambda
+    fllgcd = fll_gcd(fout, fbdiv * fref);
+    num = fout / fllgcd;
+    cfg->lambda = (fref * fbdiv) / fllgcd;
+    cfg->n = num / cfg->lambda;
+    cfg->theta = num % cfg->lambda;
+
+    // Some sanity checks before any registers are written
+    if (cfg->n < min_n || cfg->n > max_n)
+    {
+        return FLL_STATUS_FAIL;
+    }
+    if (fbdiv < 1 || (frac && fbdiv >= 1024) || (!frac && fbdiv >= 256))
+    {
+        return FLL_STATUS_FAIL;
+    }
+
+    cfg->refdiv = refdiv;
+    cfg->fbdiv = fbdiv;
+
+    return FLL_STATUS_OK;
+}
+
+/**
+ * Get the CS47L63 FLLHJ configuration
+ *
+ */
+uint32_t fll_hj_calc(uint32_t fref, uint32_t fout, fll_hj_cfg_t *cfg)
+{
+    uint32_t i;
+
+    for (i = 0; i < fll_hj_table_size; i++)
+    {
+        if (fll_hj_table[i].fref == fref && fll_hj_table[i].fout == fout)
+        {
+            *cfg = fll_hj_table[i].cfg;
+            return FLL_STATUS_OK;
+        }
+    }
+
+    return fll_hj_solve(fref, fout, cfg);
+}
+
+/**
+ * Check the lookup tables against the solvers
+ *
+ */
+uint32_t fll_table_check(void)
+{
+    fll_madera_cfg_t madera_cfg;
+    fll_hj_cfg_t hj_cfg;
+    uint32_t i;
+
+    for (i = 0; i < fll_madera_table_size; i++)
+    {
+        if (fll_madera_solve(fll_madera_table[i].fref, fll_madera_table[i].fout, fll_madera_table[i].sync,
+                             &madera_cfg) ||
+            memcmp(&madera_cfg, &fll_madera_table[i].cfg, sizeof(madera_cfg)))
+        {
+            return FLL_STATUS_FAIL;
+        }
+    }
+
+    for (i = 0; i < fll_hj_table_size; i++)
+    {
+        if (fll_hj_solve(fll_hj_table[i].fref, fll_hj_table[i].fout, &hj_cfg) ||
+            memcmp(&hj_cfg, &fll_hj_table[i].cfg, sizeof(hj_cfg)))
+        {
+            return FLL_STATUS_FAIL;
+        }
+    }
+
+    return FLL_STATUS_OK;
+}
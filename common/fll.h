@@ -0,0 +1,230 @@
+/**
+ * @file fll.h
+ *
+ * @brief
+ * Common FLL configuration solver shared by the CS47Lxx codec drivers.
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2021 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef FLL_H
+#define FLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+ * LITERALS & CONSTANTS
+ **********************************************************************************************************************/
+
+/**
+ * @defgroup FLL_STATUS_
+ * @brief Return values for all public API calls
+ *
+ * @{
+ */
+#define FLL_STATUS_OK                       (0)
+#define FLL_STATUS_FAIL                     (1)
+/** @} */
+
+/**
+ * @defgroup FLL_MADERA_
+ * @brief Limits of the FLL found on CS47L15/CS47L35
+ *
+ * @{
+ */
+#define FLL_MADERA_MAX_FREF                 (13500000)
+#define FLL_MADERA_MIN_FOUT                 (90000000)
+#define FLL_MADERA_MAX_FOUT                 (100000000)
+#define FLL_MADERA_MAX_REFDIV               (8)
+#define FLL_MADERA_MAX_N                    (1023)
+/** @} */
+
+/**
+ * @defgroup FLL_HJ_
+ * @brief Limits of the FLLHJ found on CS47L63
+ *
+ * @{
+ */
+#define FLL_HJ_MAX_THRESH                   (13000000)
+#define FLL_HJ_MAX_FOUT                     (50000000)
+#define FLL_HJ_MAX_REFDIV                   (8)
+/** @} */
+
+/***********************************************************************************************************************
+ * ENUMS, STRUCTS, UNIONS, TYPEDEFS
+ **********************************************************************************************************************/
+
+/**
+ * Register-level configuration of a CS47L15/CS47L35 FLL or FLL synchroniser
+ */
+typedef struct
+{
+    int32_t n;                  ///< Integer part of the multiplier
+    uint32_t theta;             ///< Fractional numerator
+    uint32_t lambda;            ///< Fractional denominator
+    int32_t refdiv;             ///< Reference divider, as log2 of the division
+    int32_t fratio;             ///< FLL_FRATIO field value
+    int32_t gain;               ///< Main loop gain
+    int32_t alt_gain;           ///< Alternate integer-mode gain, or -1 if not applicable
+} fll_madera_cfg_t;
+
+/**
+ * Register-level configuration of a CS47L63 FLLHJ
+ */
+typedef struct
+{
+    uint32_t refdiv;            ///< Reference divider, as log2 of the division
+    uint32_t n;                 ///< Integer part of the multiplier
+    uint32_t theta;             ///< Fractional numerator
+    uint32_t lambda;            ///< Fractional denominator
+    uint32_t fbdiv;             ///< Feedback divider
+    uint32_t hp;                ///< High-performance mode field value
+    uint32_t gains;             ///< Coarse gain field value
+    uint32_t lockdet_thr;       ///< Lock detect threshold
+} fll_hj_cfg_t;
+
+/**
+ * Pre-solved CS47L15/CS47L35 configuration for a common reference/output frequency pair
+ */
+typedef struct
+{
+    uint32_t fref;
+    uint32_t fout;
+    bool sync;
+    fll_madera_cfg_t cfg;
+} fll_madera_table_entry_t;
+
+/**
+ * Pre-solved CS47L63 configuration for a common reference/output frequency pair
+ */
+typedef struct
+{
+    uint32_t fref;
+    uint32_t fout;
+    fll_hj_cfg_t cfg;
+} fll_hj_table_entry_t;
+
+/***********************************************************************************************************************
+ * GLOBAL VARIABLES
+ **********************************************************************************************************************/
+
+/**
+ * Lookup tables of pre-solved configurations, generated by tools/fll_table_generator into fll_table.c
+ */
+extern const fll_madera_table_entry_t fll_madera_table[];
+extern const uint32_t fll_madera_table_size;
+extern const fll_hj_table_entry_t fll_hj_table[];
+extern const uint32_t fll_hj_table_size;
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Solve the CS47L15/CS47L35 FLL or FLL synchroniser configuration
+ *
+ * Runs the full solver without consulting the lookup table.
+ *
+ * @param [in] fref             Reference clock frequency in Hz
+ * @param [in] fout             FLL output frequency in Hz
+ * @param [in] sync             true to solve for the synchroniser path, false for the main path
+ * @param [out] cfg             Pointer to the configuration solved
+ *
+ * @return
+ * - FLL_STATUS_FAIL            if fref cannot be divided into range, or no gain covers fref
+ * - FLL_STATUS_OK              otherwise
+ *
+ */
+uint32_t fll_madera_solve(uint32_t fref, uint32_t fout, bool sync, fll_madera_cfg_t *cfg);
+
+/**
+ * Get the CS47L15/CS47L35 FLL or FLL synchroniser configuration
+ *
+ * Returns the pre-solved configuration if the frequency pair is in fll_madera_table, otherwise falls back to
+ * fll_madera_solve.
+ *
+ * @param [in] fref             Reference clock frequency in Hz
+ * @param [in] fout             FLL output frequency in Hz
+ * @param [in] sync             true to solve for the synchroniser path, false for the main path
+ * @param [out] cfg             Pointer to the configuration
+ *
+ * @return
+ * - FLL_STATUS_FAIL            if fll_madera_solve fails
+ * - FLL_STATUS_OK              otherwise
+ *
+ */
+uint32_t fll_madera_calc(uint32_t fref, uint32_t fout, bool sync, fll_madera_cfg_t *cfg);
+
+/**
+ * Solve the CS47L63 FLLHJ configuration
+ *
+ * Runs the full solver without consulting the lookup table.
+ *
+ * @param [in] fref             Reference clock frequency in Hz
+ * @param [in] fout             FLL output frequency in Hz
+ * @param [out] cfg             Pointer to the configuration solved
+ *
+ * @return
+ * - FLL_STATUS_FAIL            if no feedback divider or multiplier is in range
+ * - FLL_STATUS_OK              otherwise
+ *
+ */
+uint32_t fll_hj_solve(uint32_t fref, uint32_t fout, fll_hj_cfg_t *cfg);
+
+/**
+ * Get the CS47L63 FLLHJ configuration
+ *
+ * Returns the pre-solved configuration if the frequency pair is in fll_hj_table, otherwise falls back to
+ * fll_hj_solve.
+ *
+ * @param [in] fref             Reference clock frequency in Hz
+ * @param [in] fout             FLL output frequency in Hz
+ * @param [out] cfg             Pointer to the configuration
+ *
+ * @return
+ * - FLL_STATUS_FAIL            if fll_hj_solve fails
+ * - FLL_STATUS_OK              otherwise
+ *
+ */
+uint32_t fll_hj_calc(uint32_t fref, uint32_t fout, fll_hj_cfg_t *cfg);
+
+/**
+ * Check the lookup tables against the solvers
+ *
+ * Re-solves every entry of fll_madera_table and fll_hj_table and compares the result.  Run on the host by
+ * 'tools/fll_table_generator/fll_table_generator.py --check' after regenerating fll_table.c.
+ *
+ * @return
+ * - FLL_STATUS_FAIL            if any entry does not match its solved configuration
+ * - FLL_STATUS_OK              otherwise
+ *
+ */
+uint32_t fll_table_check(void);
+
+/**********************************************************************************************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FLL_H
@@ -0,0 +1,110 @@
+/**
+ * @file fll_table.c
+ *
+ * @brief Pre-solved FLL configurations for common reference/output frequency pairs
+ *
+ * This file is generated by tools/fll_table_generator/fll_table_generator.py - do not edit.
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2026 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include "fll.h"
+
+/***********************************************************************************************************************
+ * GLOBAL VARIABLES
+ **********************************************************************************************************************/
+const fll_madera_table_entry_t fll_madera_table[] =
+{
+    //  fref,      fout,       sync,  { n,    theta,  lambda, refdiv, fratio, gain, alt_gain }
+    {    32768,   98304000, false, { 1000,      0,      0,      0,      2,    0,        2 } },
+    {    32768,   98304000, true , {  187,      1,      2,      0,      4,    0,       -1 } },
+    {  1411200,   98304000, false, {   69,     97,    147,      0,      0,    3,        3 } },
+    {  1411200,   98304000, true , {   69,     97,    147,      0,      0,    4,       -1 } },
+    {  1536000,   98304000, false, {   64,      0,      0,      0,      0,    4,        3 } },
+    {  1536000,   98304000, true , {   64,      0,      0,      0,      0,    4,       -1 } },
+    {  2822400,   98304000, false, {   34,    122,    147,      0,      0,    4,        3 } },
+    {  2822400,   98304000, true , {   34,    122,    147,      0,      0,    4,       -1 } },
+    {  3072000,   98304000, false, {   32,      0,      0,      0,      0,    4,        3 } },
+    {  3072000,   98304000, true , {   32,      0,      0,      0,      0,    4,       -1 } },
+    {  5644800,   98304000, false, {   17,     61,    147,      0,      0,    4,        3 } },
+    {  5644800,   98304000, true , {   17,     61,    147,      0,      0,    4,       -1 } },
+    {  6144000,   98304000, false, {   16,      0,      0,      0,      0,    5,        3 } },
+    {  6144000,   98304000, true , {   16,      0,      0,      0,      0,    4,       -1 } },
+    { 11289600,   98304000, false, {    8,    104,    147,      0,      0,    5,        3 } },
+    { 11289600,   98304000, true , {    8,    104,    147,      0,      0,    4,       -1 } },
+    { 12288000,   98304000, false, {    8,      0,      0,      0,      0,    5,        3 } },
+    { 12288000,   98304000, true , {    8,      0,      0,      0,      0,    4,       -1 } },
+    { 22579200,   98304000, false, {    8,    104,    147,      1,      0,    5,        3 } },
+    { 22579200,   98304000, true , {    8,    104,    147,      1,      0,    4,       -1 } },
+    { 24576000,   98304000, false, {    8,      0,      0,      1,      0,    5,        3 } },
+    { 24576000,   98304000, true , {    8,      0,      0,      1,      0,    4,       -1 } },
+    {    32768,   90316800, false, {  918,      3,      4,      0,      2,    0,        2 } },
+    {    32768,   90316800, true , {  172,     17,     64,      0,      4,    0,       -1 } },
+    {  1411200,   90316800, false, {   64,      0,      0,      0,      0,    3,        3 } },
+    {  1411200,   90316800, true , {   64,      0,      0,      0,      0,    4,       -1 } },
+    {  1536000,   90316800, false, {   58,      4,      5,      0,      0,    4,        3 } },
+    {  1536000,   90316800, true , {   58,      4,      5,      0,      0,    4,       -1 } },
+    {  2822400,   90316800, false, {   32,      0,      0,      0,      0,    4,        3 } },
+    {  2822400,   90316800, true , {   32,      0,      0,      0,      0,    4,       -1 } },
+    {  3072000,   90316800, false, {   29,      2,      5,      0,      0,    4,        3 } },
+    {  3072000,   90316800, true , {   29,      2,      5,      0,      0,    4,       -1 } },
+    {  5644800,   90316800, false, {   16,      0,      0,      0,      0,    4,        3 } },
+    {  5644800,   90316800, true , {   16,      0,      0,      0,      0,    4,       -1 } },
+    {  6144000,   90316800, false, {   14,      7,     10,      0,      0,    5,        3 } },
+    {  6144000,   90316800, true , {   14,      7,     10,      0,      0,    4,       -1 } },
+    { 11289600,   90316800, false, {    8,      0,      0,      0,      0,    5,        3 } },
+    { 11289600,   90316800, true , {    8,      0,      0,      0,      0,    4,       -1 } },
+    { 12288000,   90316800, false, {    7,      7,     20,      0,      0,    5,        3 } },
+    { 12288000,   90316800, true , {    7,      7,     20,      0,      0,    4,       -1 } },
+    { 22579200,   90316800, false, {    8,      0,      0,      1,      0,    5,        3 } },
+    { 22579200,   90316800, true , {    8,      0,      0,      1,      0,    4,       -1 } },
+    { 24576000,   90316800, false, {    7,      7,     20,      1,      0,    5,        3 } },
+    { 24576000,   90316800, true , {    7,      7,     20,      1,      0,    4,       -1 } },
+};
+
+const uint32_t fll_madera_table_size = sizeof(fll_madera_table) / sizeof(fll_madera_table[0]);
+
+const fll_hj_table_entry_t fll_hj_table[] =
+{
+    //  fref,      fout,       { refdiv, n,    theta,  lambda, fbdiv, hp,  gains,  lockdet_thr }
+    {    32768,   49152000, {      0,  375,      0,      1,     4,   0, 0x23f0,           2 } },
+    {  1411200,   49152000, {      0,   34,    122,    147,     1,   3, 0x21f0,           8 } },
+    {  1536000,   49152000, {      0,   32,      0,      1,     1,   1, 0x21f0,           8 } },
+    {  2822400,   49152000, {      0,   17,     61,    147,     1,   3, 0x21f0,           8 } },
+    {  3072000,   49152000, {      0,   16,      0,      1,     1,   1, 0x21f0,           8 } },
+    {  5644800,   49152000, {      0,    8,    104,    147,     1,   3, 0x21f0,           8 } },
+    {  6144000,   49152000, {      0,    8,      0,      1,     1,   1, 0x21f0,           8 } },
+    { 11289600,   49152000, {      0,    4,     52,    147,     1,   3, 0x21f0,           8 } },
+    { 12288000,   49152000, {      0,    4,      0,      1,     1,   1, 0x21f0,           8 } },
+    { 22579200,   49152000, {      1,    4,     52,    147,     1,   3, 0x21f0,           8 } },
+    { 24576000,   49152000, {      1,    4,      0,      1,     1,   1, 0x21f0,           8 } },
+    {    32768,   45158400, {      0,    5,    785,   2048,   256,   3, 0x23f0,           2 } },
+    {  1411200,   45158400, {      0,   32,      0,      1,     1,   1, 0x21f0,           8 } },
+    {  1536000,   45158400, {      0,   29,      2,      5,     1,   3, 0x21f0,           8 } },
+    {  2822400,   45158400, {      0,   16,      0,      1,     1,   1, 0x21f0,           8 } },
+    {  3072000,   45158400, {      0,   14,      7,     10,     1,   3, 0x21f0,           8 } },
+    {  5644800,   45158400, {      0,    8,      0,      1,     1,   1, 0x21f0,           8 } },
+    {  6144000,   45158400, {      0,    7,      7,     20,     1,   3, 0x21f0,           8 } },
+    { 11289600,   45158400, {      0,    4,      0,      1,     1,   1, 0x21f0,           8 } },
+    { 12288000,   45158400, {      0,    3,     27,     40,     1,   3, 0x21f0,           8 } },
+    { 22579200,   45158400, {      1,    4,      0,      1,     1,   1, 0x21f0,           8 } },
+    { 24576000,   45158400, {      1,    3,     27,     40,     1,   3, 0x21f0,           8 } },
+};
+
+const uint32_t fll_hj_table_size = sizeof(fll_hj_table) / sizeof(fll_hj_table[0]);
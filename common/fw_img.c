@@ -187,6 +187,134 @@ static uint32_t fw_img_process_data(fw_img_boot_state_t *state)
     return ret;
 }
 
+/**
+ * Start reading the next chunk of the fw_img from the source, if any is left
+ *
+ * @param [in] source           Pointer to the fw_img source
+ *
+ * @return
+ * - FW_IMG_STATUS_FAIL         if the call to read_start failed
+ * - FW_IMG_STATUS_OK           otherwise
+ *
+ */
+static uint32_t fw_img_source_read_next(fw_img_source_t *source)
+{
+    uint32_t length;
+
+    if (source->read_offset >= source->img_size)
+    {
+        return FW_IMG_STATUS_OK;
+    }
+
+    length = source->img_size - source->read_offset;
+    if (length > source->buffer_size)
+    {
+        length = source->buffer_size;
+    }
+
+    if (source->read_start(source->arg,
+                           (source->img_addr + source->read_offset),
+                           source->buffers[source->read_index],
+                           length))
+    {
+        return FW_IMG_STATUS_FAIL;
+    }
+    source->read_pending = true;
+
+    return FW_IMG_STATUS_OK;
+}
+
+/**
+ * Wait for the chunk being read from the source, pass it to the fw_img state and start reading the chunk after it
+ *
+ * @param [in] state            Pointer to the fw_img boot state
+ *
+ * @return
+ * - FW_IMG_STATUS_FAIL         if reading from the source failed
+ * - FW_IMG_STATUS_NODATA       if the whole fw_img has already been read
+ * - FW_IMG_STATUS_OK           otherwise
+ *
+ */
+static uint32_t fw_img_source_get_next(fw_img_boot_state_t *state)
+{
+    fw_img_source_t *source = state->source;
+    uint32_t length;
+
+    if (!source->read_pending)
+    {
+        return FW_IMG_STATUS_NODATA;
+    }
+
+    source->read_pending = false;
+    if (source->read_wait(source->arg))
+    {
+        return FW_IMG_STATUS_FAIL;
+    }
+
+    length = source->img_size - source->read_offset;
+    if (length > source->buffer_size)
+    {
+        length = source->buffer_size;
+    }
+
+    state->fw_img_blocks = source->buffers[source->read_index];
+    state->fw_img_blocks_size = length;
+    state->fw_img_blocks_end = state->fw_img_blocks + length;
+
+    source->read_offset += length;
+    source->read_index ^= 1;
+
+    // The buffer just handed over is not touched until this chunk has been processed and the next one is needed
+    return fw_img_source_read_next(source);
+}
+
+/**
+ * Read the first chunk of the fw_img from the source
+ *
+ * @param [in] state            Pointer to the fw_img boot state
+ *
+ * @return
+ * - FW_IMG_STATUS_FAIL         if the source is not initialised correctly, or if reading from it failed
+ * - FW_IMG_STATUS_OK           otherwise
+ *
+ */
+static uint32_t fw_img_source_begin(fw_img_boot_state_t *state)
+{
+    fw_img_source_t *source = state->source;
+
+    if ((source->read_start == NULL) ||
+        (source->read_wait == NULL) ||
+        (source->buffers[0] == NULL) ||
+        (source->buffers[1] == NULL) ||
+        (source->buffer_size < (sizeof(fw_img_preheader_t) + sizeof(fw_img_v2_header_t))) ||
+        ((source->buffer_size % sizeof(uint32_t)) != 0) ||
+        (source->img_size == 0))
+    {
+        return FW_IMG_STATUS_FAIL;
+    }
+
+    // A read may still be in progress from an earlier pass over the same source
+    if (fw_img_source_stop(state))
+    {
+        return FW_IMG_STATUS_FAIL;
+    }
+
+    source->read_offset = 0;
+    source->read_index = 0;
+
+    if (fw_img_source_read_next(source))
+    {
+        return FW_IMG_STATUS_FAIL;
+    }
+
+    if (fw_img_source_get_next(state) != FW_IMG_STATUS_OK)
+    {
+        return FW_IMG_STATUS_FAIL;
+    }
+
+    return FW_IMG_STATUS_OK;
+}
+
 /***********************************************************************************************************************
  * API FUNCTIONS
  **********************************************************************************************************************/
@@ -200,6 +328,11 @@ uint32_t fw_img_read_header(fw_img_boot_state_t *state)
     uint32_t ret = FW_IMG_STATUS_OK;
     fw_img_info_t *fw_info = &state->fw_info;
 
+    if ((state != NULL) && (state->source != NULL) && (fw_img_source_begin(state) != FW_IMG_STATUS_OK))
+    {
+        return FW_IMG_STATUS_FAIL;
+    }
+
     if (state == NULL || state->fw_img_blocks == NULL || state->fw_img_blocks_size ==  0)
     {
         return FW_IMG_STATUS_FAIL;
@@ -263,6 +396,21 @@ uint32_t fw_img_process(fw_img_boot_state_t *state)
 
     do {
         ret = fw_img_process_data(state);
+
+        // Move on to the next chunk from the source, which was read while this one was processed
+        if ((ret == FW_IMG_STATUS_NODATA) && (state->source != NULL))
+        {
+            ret = fw_img_source_get_next(state);
+            if (ret == FW_IMG_STATUS_OK)
+            {
+                ret = FW_IMG_STATUS_AGAIN;
+            }
+            else
+            {
+                // Either the read failed, or the fw_img ended before the checksum
+                ret = FW_IMG_STATUS_FAIL;
+            }
+        }
     } while (ret == FW_IMG_STATUS_AGAIN);
 
     if (ret == FW_IMG_STATUS_NODATA)
@@ -273,6 +421,32 @@ uint32_t fw_img_process(fw_img_boot_state_t *state)
     return ret;
 }
 
+/**
+ * Stop reading from a fw_img source
+ *
+ */
+uint32_t fw_img_source_stop(fw_img_boot_state_t *state)
+{
+    fw_img_source_t *source;
+
+    if ((state == NULL) || (state->source == NULL))
+    {
+        return FW_IMG_STATUS_OK;
+    }
+
+    source = state->source;
+    if (source->read_pending)
+    {
+        source->read_pending = false;
+        if (source->read_wait(source->arg))
+        {
+            return FW_IMG_STATUS_FAIL;
+        }
+    }
+
+    return FW_IMG_STATUS_OK;
+}
+
 /**
  * Find if a symbol is in the symbol table and return its address if it is.
  *
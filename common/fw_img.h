@@ -158,6 +158,31 @@ typedef struct
     uint32_t *alg_id_list;
 } fw_img_info_t;
 
+/**
+ * Source of fw_img data that is not mapped into MCU memory, e.g. an external SPI EEPROM
+ *
+ * The fw_img is read in chunks of buffer_size bytes, into the two buffers in turn.  While fw_img_process() parses the
+ * chunk in one buffer, the next chunk is read into the other, so if read_start() returns before the read is done
+ * (e.g. by DMA), reading the fw_img overlaps with parsing it and writing it to the device.
+ *
+ * @see fw_img_boot_state_t member source
+ */
+typedef struct
+{
+    uint32_t (*read_start)(void *arg, uint32_t addr, uint8_t *buffer, uint32_t length); // Initialised by user
+    uint32_t (*read_wait)(void *arg);           // Initialised by user - wait for the read started by read_start()
+    void *arg;                                  // Initialised by user - passed to read_start() and read_wait()
+
+    uint32_t img_addr;                          // Initialised by user - address of the fw_img in the source
+    uint32_t img_size;                          // Initialised by user - size of the fw_img in bytes
+    uint8_t *buffers[2];                        // Initialised by user - word-aligned
+    uint32_t buffer_size;                       // Initialised by user - multiple of 4 bytes, that holds the header
+
+    uint32_t read_offset;                       // Offset in the fw_img of the next chunk to read
+    uint8_t read_index;                         // Index of the buffer the next chunk is read into
+    bool read_pending;                          // (True) read_start() was called without read_wait()
+} fw_img_source_t;
+
 /**
  * Data structure to describe HALO firmware and coefficient download.
  */
@@ -165,8 +190,9 @@ typedef struct
 {
     int8_t state;
     uint32_t count;
-    uint32_t fw_img_blocks_size;                // Initialised by user
-    uint8_t *fw_img_blocks;                     // Initialised by user
+    uint32_t fw_img_blocks_size;                // Initialised by user, unless source is used
+    uint8_t *fw_img_blocks;                     // Initialised by user, unless source is used
+    fw_img_source_t *source;                    // Initialised by user - NULL if fw_img_blocks are supplied by user
 
     uint8_t *fw_img_blocks_end;
 
@@ -190,7 +216,8 @@ typedef struct
 /**
  * Read fw_img header
  *
- * Reads all members into fw_img_boot_state_t member fw_info.header
+ * Reads all members into fw_img_boot_state_t member fw_info.header.  If fw_img_boot_state_t member source is set, the
+ * first chunk of the fw_img is read from it, and reading of the next chunk is started.
  *
  * @param [in] state            Pointer to the fw_img boot state
  *
@@ -199,6 +226,7 @@ typedef struct
  *      - any NULL pointers
  *      - fw_img_blocks_size is 0
  *      - header magic number is incorrect
+ *      - source is set, and it is not initialised correctly or reading from it failed
  * - FW_IMG_STATUS_OK           otherwise
  *
  */
@@ -215,13 +243,30 @@ extern uint32_t fw_img_read_header(fw_img_boot_state_t *state);
  * - FW_IMG_STATUS_FAIL if:
  *      - any NULL pointers
  *      - any errors processing fw_img data
- * - FW_IMG_STATUS_NODATA       fw_img_process() requires input of another block of fw_img data
+ *      - source is set, and reading from it failed or the fw_img ended early
+ * - FW_IMG_STATUS_NODATA       fw_img_process() requires input of another block of fw_img data.  Not returned if
+ *                              fw_img_boot_state_t member source is set, as the next chunk is then taken from it.
  * - FW_IMG_STATUS_DATA_READY   an output block of data is ready to be sent to the device
  * - FW_IMG_STATUS_OK           Once finished reading the fw_img checksum
  *
  */
 extern uint32_t fw_img_process(fw_img_boot_state_t *state);
 
+/**
+ * Stop reading from a fw_img source
+ *
+ * Waits for any read that is still in progress, so that the buffers of fw_img_boot_state_t member source can be freed.
+ * Must be called once processing is finished or abandoned.
+ *
+ * @param [in] state            Pointer to the fw_img boot state
+ *
+ * @return
+ * - FW_IMG_STATUS_FAIL         if the read in progress failed
+ * - FW_IMG_STATUS_OK           otherwise
+ *
+ */
+extern uint32_t fw_img_source_stop(fw_img_boot_state_t *state);
+
 /**
  * Find if a symbol is in the symbol table and return its address if it is.
  *
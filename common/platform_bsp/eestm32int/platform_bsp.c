@@ -23,11 +23,13 @@
  * INCLUDES
  **********************************************************************************************************************/
 #include <stdlib.h>
+#include <string.h>
 #include "platform_bsp.h"
 #include "stm32f4xx_hal.h"
-#include "test_tone_tables.h"
+#include "tone_gen.h"
 #ifdef USE_CMSIS_OS
 #include "FreeRTOS.h"
+#include "task.h"
 #include "semphr.h"
 #endif
 #include <stdio.h>
@@ -46,6 +48,11 @@
 #define BSP_I2C_TRANSACTION_TYPE_DB_WRITE               (2)
 #define BSP_I2C_TRANSACTION_TYPE_INVALID                (3)
 
+// SPI1 baud rate prescalers are indexed by the CR1 BR field, i.e. index 0 is fPCLK/2 and index 7 is fPCLK/256
+#define BSP_SPI_PRESCALER_MAX           (SPI_BAUDRATEPRESCALER_256 >> SPI_CR1_BR_Pos)
+#define BSP_SPI_PRESCALER_DEFAULT       (SPI_BAUDRATEPRESCALER_16 >> SPI_CR1_BR_Pos)
+#define BSP_SPI_DEV_ID_TOTAL            (BSP_EEPROM_DEV_ID + 1)
+
 /* I2S peripheral configuration defines */
 #define I2S_HW                          SPI2
 #define I2S_CLK_ENABLE()                __HAL_RCC_SPI2_CLK_ENABLE()
@@ -78,6 +85,15 @@
 #define I2S_RX_DMAx_MEM_DATA_SIZE       DMA_MDATAALIGN_HALFWORD
 #define I2S_RX_IRQHandler               DMA1_Stream3_IRQHandler
 
+/* SPI1 DMA Stream definitions, used for EEPROM reads */
+#define SPI1_DMAx_CLK_ENABLE()          __HAL_RCC_DMA2_CLK_ENABLE()
+#define SPI1_TX_DMAx_STREAM             DMA2_Stream3
+#define SPI1_TX_DMAx_CHANNEL            DMA_CHANNEL_3
+#define SPI1_TX_DMAx_IRQ                DMA2_Stream3_IRQn
+#define SPI1_RX_DMAx_STREAM             DMA2_Stream0
+#define SPI1_RX_DMAx_CHANNEL            DMA_CHANNEL_3
+#define SPI1_RX_DMAx_IRQ                DMA2_Stream0_IRQn
+
 /* Definition for USART2 HW resources */
 #define USART2_CLK_ENABLE()                     __HAL_RCC_USART2_CLK_ENABLE();
 #define USART2_RX_GPIO_CLK_ENABLE()             __HAL_RCC_GPIOA_CLK_ENABLE()
@@ -117,15 +133,16 @@
 #define BSP_I2S_SUBFRAME_SIZE_BYTES             (BSP_I2S_SUBFRAME_SIZE_BITS/8)
 #define BSP_I2S_CHANNEL_NBR                     (2)
 
-#ifdef TEST_TONES_INCLUDE_100HZ
-/* Playback PCM buffer size of 10ms */
-#define PLAYBACK_BUFFER_SIZE_SUBFRAMES          (BSP_I2S_FS_HZ / 100 * BSP_I2S_CHANNEL_NBR)
-#else
-/* Playback PCM buffer size of 1ms */
+/* Playback PCM buffer size of 1ms, run as circular DMA and serviced by half from the half/complete callbacks */
 #define PLAYBACK_BUFFER_SIZE_SUBFRAMES          (BSP_I2S_FS_HZ / 1000 * BSP_I2S_CHANNEL_NBR)
-#endif
 #define PLAYBACK_BUFFER_SIZE_2BYTES             (PLAYBACK_BUFFER_SIZE_SUBFRAMES * BSP_I2S_2BYTES_PER_SUBFRAME)
+#define PLAYBACK_BUFFER_FRAMES                  (PLAYBACK_BUFFER_SIZE_SUBFRAMES / BSP_I2S_CHANNEL_NBR)
+#define PLAYBACK_BUFFER_HALF_FRAMES             (PLAYBACK_BUFFER_FRAMES / 2)
+#define PLAYBACK_BUFFER_FRAME_2BYTES            (BSP_I2S_CHANNEL_NBR * BSP_I2S_2BYTES_PER_SUBFRAME)
 #define BSP_I2S_DMA_SIZE                        (PLAYBACK_BUFFER_SIZE_SUBFRAMES)
+/* Peaks of the BSP_PLAY_ tones, the same as the tables they replace (0.2 of full scale, and 0.1 at 8kHz) */
+#define BSP_PLAY_TONE_AMPLITUDE                 (0x1999999A)
+#define BSP_PLAY_TONE_AMPLITUDE_8000_HZ         (0x0CCCCCCD)
 #define PLAYBACK_BUFFER_DEFAULT_VALUE           (0xABCD)
 #define PLAYBACK_BUFFER_DEFAULT_L_VALUE         (0x1234)
 #define PLAYBACK_BUFFER_DEFAULT_R_VALUE         (0xABCD)
@@ -195,6 +212,7 @@
 /* Select the preemption priority level(0 is the highest) */
 #define I2S_TX_IRQ_PREPRIO                          (0x7)
 #define I2S_RX_IRQ_PREPRIO                          (0x8)
+#define SPI1_DMA_IRQ_PREPRIO                        (0x9)
 #define BSP_DUT_CDC_INT_PREEMPT_PRIO                (0xE)
 #define BSP_DUT_DSP_INT_PREEMPT_PRIO                (0xF)
 #define USART2_IRQ_PREPRIO                          (0xF)
@@ -242,6 +260,28 @@ typedef struct
     uint8_t *packet_buffer;
 } bsp_uart_state_t;
 
+#ifdef USE_CMSIS_OS
+#define BSP_BUS_TOTAL                   (BSP_BUS_TYPE_SPI + 1)
+#define BSP_BUS_WAITERS_MAX             (4)
+
+typedef struct
+{
+    TaskHandle_t task;                  ///< Waiting task, or NULL if the entry is free
+    bool granted;                       ///< (True) The bus has been handed over and the task is being woken
+    uint8_t priority;
+    uint32_t order;                     ///< Request order, to grant requests of equal priority first come first served
+    SemaphoreHandle_t grant;
+} bsp_bus_waiter_t;
+
+typedef struct
+{
+    TaskHandle_t owner;
+    uint32_t lock_count;
+    uint32_t order;
+    bsp_bus_waiter_t waiters[BSP_BUS_WAITERS_MAX];
+} bsp_bus_arbiter_t;
+#endif
+
 /***********************************************************************************************************************
  * LOCAL VARIABLES
  **********************************************************************************************************************/
@@ -261,10 +301,25 @@ static uint8_t *bsp_i2c_write_buffer_ptr;
 static bool bsp_i2c_transaction_complete;
 static bool bsp_i2c_transaction_error;
 
-static uint16_t playback_buffer[PLAYBACK_BUFFER_SIZE_2BYTES];
-static uint16_t record_buffer[RECORD_BUFFER_SIZE_2BYTES];
+// Aligned so stream callbacks, e.g. tone_gen_fill(), can access whole words
+static uint16_t playback_buffer[PLAYBACK_BUFFER_SIZE_2BYTES] __attribute__((aligned(4)));
+static uint16_t record_buffer[RECORD_BUFFER_SIZE_2BYTES] __attribute__((aligned(4)));
 static uint16_t *playback_content;
 
+static bsp_audio_stream_cb_t bsp_stream_play_cb = NULL;
+static void *bsp_stream_play_cb_arg = NULL;
+static bsp_audio_stream_cb_t bsp_stream_record_cb = NULL;
+static void *bsp_stream_record_cb_arg = NULL;
+static bool bsp_stream_tx_enabled = false;
+static volatile uint32_t bsp_stream_tx_next_half;
+static volatile uint32_t bsp_stream_rx_next_half;
+static volatile bsp_audio_stream_stats_t bsp_stream_stats;
+
+static tone_gen_t bsp_tone_gen;
+static tone_gen_config_t bsp_tone_config;
+static volatile bool bsp_tone_gen_active = false;
+static uint8_t bsp_play_content = BSP_PLAY_SILENCE;
+
 static bool bsp_pb_pressed_flags[BSP_PB_TOTAL] = {false};
 static bsp_app_callback_t bsp_pb_cbs[BSP_PB_TOTAL] = {NULL};
 static void* bsp_pb_cb_args[BSP_PB_TOTAL] = {NULL};
@@ -288,7 +343,11 @@ static bsp_callback_t bsp_dut_dsp_int_cb[2] = {NULL, NULL};
 static void *bsp_dut_cdc_int_cb_arg[2] = {NULL, NULL};
 static void *bsp_dut_dsp_int_cb_arg[2] = {NULL, NULL};
 
-static uint32_t spi_baud_prescaler = SPI_BAUDRATEPRESCALER_16;
+// Prescaler for each device on SPI1, and the throttle from bsp_spi_throttle_speed; the slower of the two is used
+static uint8_t spi_dev_prescaler[BSP_SPI_DEV_ID_TOTAL];
+static uint8_t spi_throttle_prescaler = 0;
+static volatile bool spi_dma_busy = false;
+static volatile bool spi_dma_error = false;
 
 static bsp_led_t bsp_ld2_led =
 {
@@ -427,6 +486,7 @@ static bsp_uart_state_t uart_rx_state =
 
 #ifdef USE_CMSIS_OS
 static SemaphoreHandle_t mutex_spi;
+static bsp_bus_arbiter_t bsp_bus_arbiters[BSP_BUS_TOTAL];
 #endif
 /***********************************************************************************************************************
  * GLOBAL VARIABLES
@@ -621,8 +681,12 @@ static void MX_SPI1_Init(void)
   hspi1.Init.CLKPolarity = SPI_POLARITY_LOW;
   hspi1.Init.CLKPhase = SPI_PHASE_1EDGE;
   hspi1.Init.NSS = SPI_NSS_SOFT;
-  spi_baud_prescaler = SPI_BAUDRATEPRESCALER_16;
-  hspi1.Init.BaudRatePrescaler = spi_baud_prescaler;
+  for (uint32_t i = 0; i < BSP_SPI_DEV_ID_TOTAL; i++)
+  {
+    spi_dev_prescaler[i] = BSP_SPI_PRESCALER_DEFAULT;
+  }
+  spi_throttle_prescaler = 0;
+  hspi1.Init.BaudRatePrescaler = (BSP_SPI_PRESCALER_DEFAULT << SPI_CR1_BR_Pos);
   hspi1.Init.FirstBit = SPI_FIRSTBIT_MSB;
   hspi1.Init.TIMode = SPI_TIMODE_DISABLE;
   hspi1.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
@@ -1118,9 +1182,11 @@ static void bsp_wait_for_eeprom(void)
 {
     uint8_t buffer[2] = {0xFF, 0xFF};
     uint32_t timeout = 0;
+
+    // Only wait if the EEPROM is busy, so back-to-back reads are not each delayed by 5ms
+    bsp_eeprom_read_status(buffer);
     while ((buffer[1] & 1)) // check busy bit
     {
-        bsp_eeprom_read_status(buffer);
         bsp_set_timer(5, NULL, NULL);
         if (timeout > 100) // about 0.5s, enough for everything except chip erase (typ. 60s)
         {
@@ -1130,8 +1196,82 @@ static void bsp_wait_for_eeprom(void)
         {
             timeout++;
         }
+        bsp_eeprom_read_status(buffer);
+    }
+}
+
+/**
+ * Wait for an EEPROM read started by bsp_eeprom_read_start() to finish
+ *
+ * Must be called before SPI1 is used for anything else.  Under USE_CMSIS_OS, call with mutex_spi taken.
+ *
+ */
+static void bsp_spi_wait_for_dma(void)
+{
+    while (spi_dma_busy)
+    {
+        ;
+    }
+
+    return;
+}
+
+/**
+ * Find the prescaler giving the fastest SPI1 clock at or below speed_hz
+ *
+ * @return
+ * - BSP_STATUS_FAIL            if speed_hz is slower than fPCLK/256
+ * - BSP_STATUS_OK              otherwise
+ *
+ */
+static uint32_t bsp_spi_speed_to_prescaler(uint32_t speed_hz, uint8_t *prescaler)
+{
+    uint32_t spi_baud_hz = HAL_RCC_GetPCLK2Freq() >> 1;  // Currently using SPI1 which is on APB2
+    uint8_t temp_prescaler = 0;
+
+    while ((speed_hz < spi_baud_hz) && (temp_prescaler < BSP_SPI_PRESCALER_MAX))
+    {
+        spi_baud_hz >>= 1;
+        temp_prescaler++;
+    }
+
+    if (speed_hz < spi_baud_hz)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    *prescaler = temp_prescaler;
+
+    return BSP_STATUS_OK;
+}
+
+/**
+ * Switch SPI1 to the clock speed for a device, before selecting it
+ *
+ * Only the CR1 BR field changes, so rather than a full HAL_SPI_DeInit/HAL_SPI_Init the peripheral is disabled, BR is
+ * written, and HAL_SPI_Transmit/HAL_SPI_Receive enable it again on the next transfer.  The blocking HAL transfers
+ * return with the bus idle, so SPI1 is never disabled mid-frame.
+ *
+ */
+static void bsp_spi_apply_speed(uint32_t bsp_dev_id)
+{
+    uint8_t prescaler = spi_dev_prescaler[bsp_dev_id];
+
+    if (prescaler < spi_throttle_prescaler)
+    {
+        prescaler = spi_throttle_prescaler;
+    }
+
+    if (hspi1.Init.BaudRatePrescaler != (prescaler << SPI_CR1_BR_Pos))
+    {
+        hspi1.Init.BaudRatePrescaler = (prescaler << SPI_CR1_BR_Pos);
+        __HAL_SPI_DISABLE(&hspi1);
+        MODIFY_REG(hspi1.Instance->CR1, SPI_CR1_BR, hspi1.Init.BaudRatePrescaler);
     }
+
+    return;
 }
+
 /***********************************************************************************************************************
  * MCU HAL FUNCTIONS
  **********************************************************************************************************************/
@@ -1297,6 +1437,8 @@ void HAL_MspInit(void)
 */
 void HAL_SPI_MspInit(SPI_HandleTypeDef* hspi)
 {
+  static DMA_HandleTypeDef hdma_spi1Tx;
+  static DMA_HandleTypeDef hdma_spi1Rx;
   GPIO_InitTypeDef GPIO_InitStruct = {0};
   if(hspi->Instance==SPI1)
   {
@@ -1338,6 +1480,46 @@ void HAL_SPI_MspInit(SPI_HandleTypeDef* hspi)
     GPIO_InitStruct.Alternate = 0;
     HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
 
+    /* DMA is only used for EEPROM reads, the HAL needs both streams linked for a master receive */
+    SPI1_DMAx_CLK_ENABLE();
+
+    hdma_spi1Tx.Init.Channel             = SPI1_TX_DMAx_CHANNEL;
+    hdma_spi1Tx.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+    hdma_spi1Tx.Init.PeriphInc           = DMA_PINC_DISABLE;
+    hdma_spi1Tx.Init.MemInc              = DMA_MINC_ENABLE;
+    hdma_spi1Tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_spi1Tx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    hdma_spi1Tx.Init.Mode                = DMA_NORMAL;
+    hdma_spi1Tx.Init.Priority            = DMA_PRIORITY_LOW;
+    hdma_spi1Tx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+    hdma_spi1Tx.Instance                 = SPI1_TX_DMAx_STREAM;
+
+    hdma_spi1Rx.Init.Channel             = SPI1_RX_DMAx_CHANNEL;
+    hdma_spi1Rx.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+    hdma_spi1Rx.Init.PeriphInc           = DMA_PINC_DISABLE;
+    hdma_spi1Rx.Init.MemInc              = DMA_MINC_ENABLE;
+    hdma_spi1Rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_spi1Rx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    hdma_spi1Rx.Init.Mode                = DMA_NORMAL;
+    hdma_spi1Rx.Init.Priority            = DMA_PRIORITY_MEDIUM;
+    hdma_spi1Rx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+    hdma_spi1Rx.Instance                 = SPI1_RX_DMAx_STREAM;
+
+    __HAL_LINKDMA(hspi, hdmatx, hdma_spi1Tx);
+    HAL_DMA_DeInit(&hdma_spi1Tx);
+    HAL_DMA_Init(&hdma_spi1Tx);
+
+    __HAL_LINKDMA(hspi, hdmarx, hdma_spi1Rx);
+    HAL_DMA_DeInit(&hdma_spi1Rx);
+    HAL_DMA_Init(&hdma_spi1Rx);
+
+    HAL_NVIC_SetPriority(SPI1_TX_DMAx_IRQ, SPI1_DMA_IRQ_PREPRIO, 0);
+    HAL_NVIC_EnableIRQ(SPI1_TX_DMAx_IRQ);
+    HAL_NVIC_SetPriority(SPI1_RX_DMAx_IRQ, SPI1_DMA_IRQ_PREPRIO, 0);
+    HAL_NVIC_EnableIRQ(SPI1_RX_DMAx_IRQ);
+    HAL_NVIC_SetPriority(SPI1_IRQn, SPI1_DMA_IRQ_PREPRIO, 0);
+    HAL_NVIC_EnableIRQ(SPI1_IRQn);
+
   /* USER CODE BEGIN SPI1_MspInit 1 */
 
   /* USER CODE END SPI1_MspInit 1 */
@@ -1361,6 +1543,12 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef* hspi)
     /* Peripheral clock disable */
     __HAL_RCC_SPI1_CLK_DISABLE();
 
+    HAL_NVIC_DisableIRQ(SPI1_TX_DMAx_IRQ);
+    HAL_NVIC_DisableIRQ(SPI1_RX_DMAx_IRQ);
+    HAL_NVIC_DisableIRQ(SPI1_IRQn);
+    HAL_DMA_DeInit(hspi->hdmatx);
+    HAL_DMA_DeInit(hspi->hdmarx);
+
     /**SPI1 GPIO Configuration
     PA15     ------> SPI1_NSS
     PB3     ------> SPI1_SCK
@@ -1380,6 +1568,34 @@ void HAL_SPI_MspDeInit(SPI_HandleTypeDef* hspi)
 
 }
 
+/**
+ * SPI1 DMA receive complete, which is only used by bsp_eeprom_read_start()
+ *
+ */
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi->Instance == SPI1)
+    {
+        // EEPROM chip select high
+        HAL_GPIO_WritePin(GPIOD, GPIO_PIN_2, GPIO_PIN_SET);
+        spi_dma_busy = false;
+    }
+
+    return;
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    if ((hspi->Instance == SPI1) && spi_dma_busy)
+    {
+        HAL_GPIO_WritePin(GPIOD, GPIO_PIN_2, GPIO_PIN_SET);
+        spi_dma_error = true;
+        spi_dma_busy = false;
+    }
+
+    return;
+}
+
 void HAL_MspDeInit(void)
 {
     HAL_GPIO_DeInit(GPIOA, GPIO_PIN_5);
@@ -1698,11 +1914,148 @@ void HAL_I2S_MspDeInit(I2S_HandleTypeDef *hi2s)
     return;
 }
 
+/**
+ * Get the half of a circular I2S buffer the DMA is currently transferring
+ *
+ * The DMA counter is the number of half-words left until the end of the buffer.
+ *
+ */
+static uint32_t bsp_audio_stream_dma_half(DMA_HandleTypeDef *hdma)
+{
+    return (__HAL_DMA_GET_COUNTER(hdma) > (PLAYBACK_BUFFER_SIZE_2BYTES / 2)) ? 0 : 1;
+}
+
+/**
+ * Fill one half of playback_buffer from the stream producer, padding with silence if it runs short
+ *
+ * @return true if the producer filled the whole half
+ *
+ */
+static bool bsp_audio_stream_fill(uint32_t half)
+{
+    uint32_t offset = half * (PLAYBACK_BUFFER_SIZE_2BYTES / 2);
+    uint32_t frames;
+
+    frames = bsp_stream_play_cb(&(playback_buffer[offset]), PLAYBACK_BUFFER_HALF_FRAMES, bsp_stream_play_cb_arg);
+    if (frames < PLAYBACK_BUFFER_HALF_FRAMES)
+    {
+        memset(&(playback_buffer[offset + (frames * PLAYBACK_BUFFER_FRAME_2BYTES)]),
+               0,
+               (PLAYBACK_BUFFER_HALF_FRAMES - frames) * PLAYBACK_BUFFER_FRAME_2BYTES * sizeof(uint16_t));
+
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Fill the half of playback_buffer the Tx DMA has just finished with
+ *
+ * A producer that fills fewer frames than asked for is padded with silence.  After filling the half, if the DMA has
+ * already moved back into it then the callback was too late, and the DMA sent frames before they were filled.  Both
+ * count as an underrun.
+ *
+ */
+static void bsp_audio_stream_service_tx(uint32_t half)
+{
+    if (half != bsp_stream_tx_next_half)
+    {
+        return;
+    }
+    bsp_stream_tx_next_half = half ^ 1;
+
+    if (bsp_stream_play_cb != NULL)
+    {
+        if ((!bsp_audio_stream_fill(half)) ||
+            (bsp_audio_stream_dma_half(i2s_drv_handle.hdmatx) == half))
+        {
+            bsp_stream_stats.tx_underruns++;
+        }
+    }
+
+    bsp_stream_stats.periods++;
+
+    return;
+}
+
+/**
+ * Drain the half of record_buffer the Rx DMA has just finished with
+ *
+ * A consumer that drains fewer frames than asked for, or drains the half after the DMA has moved back into it, counts
+ * as an overrun.
+ *
+ */
+static void bsp_audio_stream_service_rx(uint32_t half)
+{
+    uint32_t offset = half * (RECORD_BUFFER_SIZE_2BYTES / 2);
+    uint32_t frames;
+
+    if (half != bsp_stream_rx_next_half)
+    {
+        return;
+    }
+    bsp_stream_rx_next_half = half ^ 1;
+
+    if (bsp_stream_record_cb != NULL)
+    {
+        frames = bsp_stream_record_cb(&(record_buffer[offset]), PLAYBACK_BUFFER_HALF_FRAMES, bsp_stream_record_cb_arg);
+        if ((frames < PLAYBACK_BUFFER_HALF_FRAMES) ||
+            (bsp_audio_stream_dma_half(i2s_drv_handle.hdmarx) == half))
+        {
+            bsp_stream_stats.rx_overruns++;
+        }
+    }
+
+    // When playing, periods are counted by the Tx side
+    if (!bsp_stream_tx_enabled)
+    {
+        bsp_stream_stats.periods++;
+    }
+
+    return;
+}
+
+/*
+ * The HAL full duplex callbacks are called for both the Tx and Rx DMA without saying which one completed, and the Rx
+ * DMA completes a half slightly after the Tx DMA.  So in full duplex these replace the HAL DMA callbacks, to service
+ * each direction from its own DMA.
+ */
+static void bsp_audio_stream_tx_dma_half_cplt(DMA_HandleTypeDef *hdma)
+{
+    bsp_audio_stream_service_tx(0);
+
+    return;
+}
+
+static void bsp_audio_stream_tx_dma_cplt(DMA_HandleTypeDef *hdma)
+{
+    bsp_audio_stream_service_tx(1);
+
+    bsp_irq_count++;
+
+    return;
+}
+
+static void bsp_audio_stream_rx_dma_half_cplt(DMA_HandleTypeDef *hdma)
+{
+    bsp_audio_stream_service_rx(0);
+
+    return;
+}
+
+static void bsp_audio_stream_rx_dma_cplt(DMA_HandleTypeDef *hdma)
+{
+    bsp_audio_stream_service_rx(1);
+
+    return;
+}
+
 void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s)
 {
     if(hi2s->Instance == I2S_HW)
     {
-        bsp_audio_play(0);
+        bsp_audio_stream_service_tx(1);
     }
 
     bsp_irq_count++;
@@ -1712,16 +2065,31 @@ void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s)
 
 void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
 {
+    if(hi2s->Instance == I2S_HW)
+    {
+        bsp_audio_stream_service_tx(0);
+    }
+
     return;
 }
 
 void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s)
 {
+    if(hi2s->Instance == I2S_HW)
+    {
+        bsp_audio_stream_service_rx(1);
+    }
+
     return;
 }
 
 void HAL_I2S_RxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
 {
+    if(hi2s->Instance == I2S_HW)
+    {
+        bsp_audio_stream_service_rx(0);
+    }
+
     return;
 }
 
@@ -1867,7 +2235,13 @@ void process_uart_tx(void)
             tx_size_bytes = uart_tx_state.packet_size;
             tx_buffer = channel->fifo.buffer + channel->fifo.out_index;
 
-            // Calculate Checksum
+            // Calculate Checksum, the inverted sum of the payload bytes
+            uart_tx_state.packet_checksum = 0;
+            for (uint32_t i = 0; i < tx_size_bytes; i++)
+            {
+                uart_tx_state.packet_checksum += tx_buffer[i];
+            }
+            uart_tx_state.packet_checksum = ~uart_tx_state.packet_checksum;
 
             uart_tx_state.packet_state = BSP_UART_STATE_PACKET_STATE_PAYLOAD;
 
@@ -2284,6 +2658,18 @@ uint32_t bsp_initialize(bsp_app_callback_t cb, void *cb_arg)
     {
         return BSP_STATUS_FAIL; /* There was insufficient heap memory available for the mutex to be created. */
     }
+
+    for (uint32_t i = 0; i < BSP_BUS_TOTAL; i++)
+    {
+        for (uint32_t j = 0; j < BSP_BUS_WAITERS_MAX; j++)
+        {
+            bsp_bus_arbiters[i].waiters[j].grant = xSemaphoreCreateBinary();
+            if (bsp_bus_arbiters[i].waiters[j].grant == NULL)
+            {
+                return BSP_STATUS_FAIL;
+            }
+        }
+    }
 #endif
     /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
     HAL_Init();
@@ -2396,138 +2782,265 @@ uint32_t bsp_audio_set_fs(uint32_t fs_hz)
     return BSP_STATUS_OK;
 }
 
-uint32_t bsp_audio_play(uint8_t content)
+/**
+ * Stream producer generating the current tone
+ *
+ */
+static uint32_t bsp_audio_tone_produce(void *buffer, uint32_t frames, void *arg)
+{
+    tone_gen_fill((tone_gen_t *) arg, buffer, frames);
+
+    return frames;
+}
+
+/**
+ * Set up the stream producer for a BSP_PLAY_ content
+ *
+ * All contents except BSP_PLAY_STEREO_PATTERN are generated by bsp_audio_tone_produce.  The pattern is written to
+ * playback_buffer once, and has no producer so is repeated as is.
+ *
+ */
+static uint32_t bsp_audio_prepare(uint8_t content, bsp_audio_stream_cb_t *play_cb)
 {
+    tone_gen_config_t preset = {0};
+    tone_gen_config_t *config = &preset;
+
+    // Do not touch the generator or playback_buffer while a stream is running
+    if (HAL_I2S_GetState(&i2s_drv_handle) != HAL_I2S_STATE_READY)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    bsp_tone_gen_active = false;
+    bsp_play_content = content;
+    playback_content = playback_buffer;
+    *play_cb = NULL;
+
     switch (content)
     {
         case BSP_PLAY_SILENCE:
-#if (BSP_I2S_2BYTES_PER_SUBFRAME == 2)
-            playback_content = (uint16_t *) pcm_silence_32bit_stereo_single_period;
-#else
-            playback_content = pcm_silence_16bit_stereo_single_period;
-#endif
+            preset.type = TONE_GEN_TYPE_SILENCE;
             break;
 
         case BSP_PLAY_STEREO_1KHZ_20DBFS:
+            preset.type = TONE_GEN_TYPE_SINE;
+            preset.freq_hz[0] = 1000;
+            preset.amplitude = BSP_PLAY_TONE_AMPLITUDE;
             if (bsp_fs == BSP_AUDIO_FS_8000_HZ)
             {
-#if (BSP_I2S_2BYTES_PER_SUBFRAME == 2)
-                playback_content = (uint16_t *) pcm_20dBFs_1kHz_32bit_8000_stereo_single_period;
-#else
-                playback_content = pcm_20dBFs_1kHz_16bit_8000_stereo_single_period;
-#endif
-            }
-            else
-            {
-#if (BSP_I2S_2BYTES_PER_SUBFRAME == 2)
-                playback_content = (uint16_t *) pcm_20dBFs_1kHz_32bit_stereo_single_period;
-#else
-                playback_content = pcm_20dBFs_1kHz_16bit_stereo_single_period;
-#endif
+                preset.amplitude = BSP_PLAY_TONE_AMPLITUDE_8000_HZ;
             }
             break;
 
         case BSP_PLAY_STEREO_100HZ_20DBFS:
-#ifdef TEST_TONES_INCLUDE_100HZ
-#if (BSP_I2S_2BYTES_PER_SUBFRAME == 2)
-            playback_content = pcm_20dBFs_100Hz_32bit_stereo_single_period;
-#else
-            playback_content = pcm_20dBFs_100Hz_16bit_stereo_single_period;
-#endif
-#else
-            return BSP_STATUS_FAIL;
-#endif
+            preset.type = TONE_GEN_TYPE_SINE;
+            preset.freq_hz[0] = 100;
+            preset.amplitude = BSP_PLAY_TONE_AMPLITUDE;
+            break;
+
+        case BSP_PLAY_TONE:
+            config = &bsp_tone_config;
             break;
 
         default:
         case BSP_PLAY_STEREO_PATTERN:
-            playback_content = playback_buffer;
-            break;
-    }
+            for (int i = 0; i < PLAYBACK_BUFFER_SIZE_2BYTES; i++)
+            {
+                playback_buffer[i] = i;
+            }
 
-    if (HAL_OK == HAL_I2S_Transmit_DMA(&i2s_drv_handle, playback_content, BSP_I2S_DMA_SIZE))
-    {
-        return BSP_STATUS_OK;
+            return BSP_STATUS_OK;
     }
-    else
+
+    if (tone_gen_init(&bsp_tone_gen, config, bsp_fs, BSP_I2S_SUBFRAME_SIZE_BITS) != TONE_GEN_STATUS_OK)
     {
         return BSP_STATUS_FAIL;
     }
+
+    *play_cb = bsp_audio_tone_produce;
+    bsp_tone_gen_active = true;
+
+    return BSP_STATUS_OK;
 }
 
-uint32_t bsp_audio_record(void)
+/**
+ * Start circular I2S DMA of playback_buffer and/or record_buffer
+ *
+ * Both halves of playback_buffer are filled by the producer before the DMA is started.  A direction that is enabled
+ * without a callback just repeats (or overwrites) its buffer.
+ *
+ */
+static uint32_t bsp_audio_stream_run(bool play,
+                                     bsp_audio_stream_cb_t play_cb,
+                                     void *play_cb_arg,
+                                     bool record,
+                                     bsp_audio_stream_cb_t record_cb,
+                                     void *record_cb_arg)
 {
-    if (HAL_OK == HAL_I2S_Receive_DMA(&i2s_drv_handle, record_buffer, BSP_I2S_DMA_SIZE))
-    {
-        return BSP_STATUS_OK;
-    }
-    else
+    HAL_StatusTypeDef ret;
+
+    if (HAL_I2S_GetState(&i2s_drv_handle) != HAL_I2S_STATE_READY)
     {
         return BSP_STATUS_FAIL;
     }
-}
 
-uint32_t bsp_audio_play_record(uint8_t content)
-{
-    uint16_t dma_transfer_size = 0;
-    switch (content)
-    {
-        case BSP_PLAY_SILENCE:
-            dma_transfer_size = PCM_1KHZ_SINGLE_PERIOD_LENGTH_2BYTES;
-#if (BSP_I2S_2BYTES_PER_SUBFRAME == 2)
-            playback_content = (uint16_t *) pcm_silence_32bit_stereo_single_period;
-#else
-            playback_content = pcm_silence_16bit_stereo_single_period;
-#endif
-            break;
+    bsp_stream_play_cb = play_cb;
+    bsp_stream_play_cb_arg = play_cb_arg;
+    bsp_stream_record_cb = record_cb;
+    bsp_stream_record_cb_arg = record_cb_arg;
+    bsp_stream_tx_enabled = play;
+    bsp_stream_tx_next_half = 0;
+    bsp_stream_rx_next_half = 0;
+    memset((void *) &bsp_stream_stats, 0, sizeof(bsp_stream_stats));
 
-        case BSP_PLAY_STEREO_1KHZ_20DBFS:
-            if (bsp_fs == BSP_AUDIO_FS_8000_HZ)
+    if (play_cb != NULL)
+    {
+        for (uint32_t half = 0; half < 2; half++)
+        {
+            if (!bsp_audio_stream_fill(half))
             {
-                dma_transfer_size = PCM_1KTONE_8kHz_SINGLE_PERIOD_LENGTH_2BYTES;
-#if (BSP_I2S_2BYTES_PER_SUBFRAME == 2)
-                playback_content = (uint16_t *) pcm_20dBFs_1kHz_32bit_8000_stereo_single_period;
-#else
-                playback_content = pcm_20dBFs_1kHz_16bit_8000_stereo_single_period;
-#endif
+                bsp_stream_stats.tx_underruns++;
             }
-            else
-            {
-                dma_transfer_size = PCM_1KHZ_SINGLE_PERIOD_LENGTH_2BYTES;
-#if (BSP_I2S_2BYTES_PER_SUBFRAME == 2)
-                playback_content = (uint16_t *) pcm_20dBFs_1kHz_32bit_stereo_single_period;
-#else
-                playback_content = pcm_20dBFs_1kHz_16bit_stereo_single_period;
-#endif
-            }
-            break;
+        }
+    }
 
-        case BSP_PLAY_STEREO_100HZ_20DBFS:
-#ifdef TEST_TONES_INCLUDE_100HZ
-#if (BSP_I2S_2BYTES_PER_SUBFRAME == 2)
-            playback_content = pcm_20dBFs_100Hz_32bit_stereo_single_period;
-#else
-            playback_content = pcm_20dBFs_100Hz_16bit_stereo_single_period;
-#endif
-#else
-            return BSP_STATUS_FAIL;
-#endif
-            break;
+    if (play && record)
+    {
+        // Take over the DMA callbacks before either DMA can reach its first half
+        __disable_irq();
+        ret = HAL_I2SEx_TransmitReceive_DMA(&i2s_drv_handle, playback_buffer, record_buffer, BSP_I2S_DMA_SIZE);
+        if (ret == HAL_OK)
+        {
+            i2s_drv_handle.hdmatx->XferHalfCpltCallback = bsp_audio_stream_tx_dma_half_cplt;
+            i2s_drv_handle.hdmatx->XferCpltCallback = bsp_audio_stream_tx_dma_cplt;
+            i2s_drv_handle.hdmarx->XferHalfCpltCallback = bsp_audio_stream_rx_dma_half_cplt;
+            i2s_drv_handle.hdmarx->XferCpltCallback = bsp_audio_stream_rx_dma_cplt;
+        }
+        __enable_irq();
+    }
+    else if (play)
+    {
+        ret = HAL_I2S_Transmit_DMA(&i2s_drv_handle, playback_buffer, BSP_I2S_DMA_SIZE);
+    }
+    else
+    {
+        ret = HAL_I2S_Receive_DMA(&i2s_drv_handle, record_buffer, BSP_I2S_DMA_SIZE);
+    }
 
-        default:
-        case BSP_PLAY_STEREO_PATTERN:
-            playback_content = playback_buffer;
-            break;
+    if (ret != HAL_OK)
+    {
+        bsp_stream_play_cb = NULL;
+        bsp_stream_record_cb = NULL;
+        bsp_tone_gen_active = false;
+
+        return BSP_STATUS_FAIL;
     }
 
-    if (HAL_OK == HAL_I2SEx_TransmitReceive_DMA(&i2s_drv_handle, playback_content, record_buffer, dma_transfer_size))
+    return BSP_STATUS_OK;
+}
+
+uint32_t bsp_audio_set_tone(const tone_gen_config_t *config)
+{
+    tone_gen_t gen;
+
+    // Check the tone can be generated before replacing the current one
+    if (tone_gen_init(&gen, config, bsp_fs, BSP_I2S_SUBFRAME_SIZE_BITS) != TONE_GEN_STATUS_OK)
     {
-        return BSP_STATUS_OK;
+        return BSP_STATUS_FAIL;
     }
-    else
+
+    bsp_tone_config = *config;
+
+    // If already playing BSP_PLAY_TONE, switch to the new tone from the next half of playback_buffer
+    if (bsp_tone_gen_active && (bsp_play_content == BSP_PLAY_TONE))
+    {
+        __disable_irq();
+        bsp_tone_gen = gen;
+        __enable_irq();
+    }
+
+    return BSP_STATUS_OK;
+}
+
+uint32_t bsp_audio_play(uint8_t content)
+{
+    bsp_audio_stream_cb_t play_cb;
+
+    if (bsp_audio_prepare(content, &play_cb) != BSP_STATUS_OK)
     {
         return BSP_STATUS_FAIL;
     }
+
+    return bsp_audio_stream_run(true, play_cb, &bsp_tone_gen, false, NULL, NULL);
+}
+
+uint32_t bsp_audio_record(void)
+{
+    return bsp_audio_stream_run(false, NULL, NULL, true, NULL, NULL);
+}
+
+uint32_t bsp_audio_play_record(uint8_t content)
+{
+    bsp_audio_stream_cb_t play_cb;
+
+    if (bsp_audio_prepare(content, &play_cb) != BSP_STATUS_OK)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    return bsp_audio_stream_run(true, play_cb, &bsp_tone_gen, true, NULL, NULL);
+}
+
+uint32_t bsp_audio_stream_start(bsp_audio_stream_cb_t play_cb,
+                                void *play_cb_arg,
+                                bsp_audio_stream_cb_t record_cb,
+                                void *record_cb_arg)
+{
+    if ((play_cb == NULL) && (record_cb == NULL))
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    if (HAL_I2S_GetState(&i2s_drv_handle) != HAL_I2S_STATE_READY)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    bsp_tone_gen_active = false;
+
+    return bsp_audio_stream_run((play_cb != NULL), play_cb, play_cb_arg, (record_cb != NULL), record_cb, record_cb_arg);
+}
+
+uint32_t bsp_audio_stream_get_stats(bsp_audio_stream_stats_t *stats)
+{
+    uint32_t position;
+    uint32_t end;
+
+    if (stats == NULL)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    __disable_irq();
+    stats->periods = bsp_stream_stats.periods;
+    stats->tx_underruns = bsp_stream_stats.tx_underruns;
+    stats->rx_overruns = bsp_stream_stats.rx_overruns;
+    stats->tx_latency_frames = 0;
+    if ((bsp_stream_play_cb != NULL) && (HAL_I2S_GetState(&i2s_drv_handle) != HAL_I2S_STATE_READY))
+    {
+        /*
+         * Frames filled run from the DMA position to the end of the half serviced last, which is the start of the next
+         * half to service.  Both halves are filled when the DMA is at the start of that half.
+         */
+        position = PLAYBACK_BUFFER_FRAMES -
+                   (__HAL_DMA_GET_COUNTER(i2s_drv_handle.hdmatx) / PLAYBACK_BUFFER_FRAME_2BYTES);
+        end = bsp_stream_tx_next_half * PLAYBACK_BUFFER_HALF_FRAMES;
+        stats->tx_latency_frames = PLAYBACK_BUFFER_FRAMES -
+                                   ((position + PLAYBACK_BUFFER_FRAMES - end) % PLAYBACK_BUFFER_FRAMES);
+    }
+    __enable_irq();
+
+    return BSP_STATUS_OK;
 }
 
 uint32_t bsp_audio_pause(void)
@@ -2556,7 +3069,15 @@ uint32_t bsp_audio_resume(void)
 
 uint32_t bsp_audio_stop(void)
 {
-    if (HAL_OK == HAL_I2S_DMAStop(&i2s_drv_handle))
+    HAL_StatusTypeDef ret;
+
+    ret = HAL_I2S_DMAStop(&i2s_drv_handle);
+
+    bsp_tone_gen_active = false;
+    bsp_stream_play_cb = NULL;
+    bsp_stream_record_cb = NULL;
+
+    if (HAL_OK == ret)
     {
         return BSP_STATUS_OK;
     }
@@ -2818,6 +3339,9 @@ uint32_t bsp_spi_read(uint32_t bsp_dev_id,
 #ifdef USE_CMSIS_OS
     xSemaphoreTake(mutex_spi, portMAX_DELAY);
 #endif
+    bsp_spi_wait_for_dma();
+    bsp_spi_apply_speed(bsp_dev_id);
+
     // Chip select low
     HAL_GPIO_WritePin(cs_gpio_per, cs_gpio_pin, GPIO_PIN_RESET);
 
@@ -2896,6 +3420,9 @@ uint32_t bsp_spi_write(uint32_t bsp_dev_id,
 #ifdef USE_CMSIS_OS
     xSemaphoreTake(mutex_spi, portMAX_DELAY);
 #endif
+    bsp_spi_wait_for_dma();
+    bsp_spi_apply_speed(bsp_dev_id);
+
     // Chip select low
     HAL_GPIO_WritePin(cs_gpio_per, cs_gpio_pin, GPIO_PIN_RESET);
 
@@ -3262,6 +3789,11 @@ void bsp_sleep(void)
     return;
 }
 
+uint32_t bsp_get_time_ms(void)
+{
+    return HAL_GetTick();
+}
+
 uint32_t bsp_register_pb_cb(uint32_t pb_id, bsp_app_callback_t cb, void *cb_arg)
 {
     if (pb_id < BSP_PB_TOTAL)
@@ -3278,68 +3810,175 @@ uint32_t bsp_register_pb_cb(uint32_t pb_id, bsp_app_callback_t cb, void *cb_arg)
 
 uint32_t bsp_spi_throttle_speed(uint32_t speed_hz)
 {
-    uint32_t ret = BSP_STATUS_OK;
-    uint32_t spi_baud_hz = HAL_RCC_GetPCLK2Freq();  // Currently using SPI1 which is on APB2
-    uint32_t temp_spi_baud_prescaler;
+    uint8_t prescaler;
 
-    // Save the current prescaler value
-    spi_baud_prescaler = temp_spi_baud_prescaler = (hspi1.Init.BaudRatePrescaler >> SPI_CR1_BR_Pos);
-    // Get the current SPI Baud in Hz
-    spi_baud_hz >>= (temp_spi_baud_prescaler + 1);
+    if (bsp_spi_speed_to_prescaler(speed_hz, &prescaler))
+    {
+        return BSP_STATUS_FAIL;
+    }
 
-    // Check to see if any throttling is needed
-    if (speed_hz < spi_baud_hz)
+    // Takes effect from the next transaction, as the speed set per device does
+    spi_throttle_prescaler = prescaler;
+
+    return BSP_STATUS_OK;
+}
+
+uint32_t bsp_spi_restore_speed(void)
+{
+    spi_throttle_prescaler = 0;
+
+    return BSP_STATUS_OK;
+}
+
+uint32_t bsp_spi_set_max_speed(uint32_t bsp_dev_id, uint32_t speed_hz)
+{
+    uint8_t prescaler = BSP_SPI_PRESCALER_DEFAULT;
+
+    if ((bsp_dev_id != BSP_DUT_DEV_ID) &&
+        (bsp_dev_id != BSP_DUT_DEV_ID_SPI2) &&
+        (bsp_dev_id != BSP_EEPROM_DEV_ID))
     {
-        // Decrement the SPI baud until a rate slow enough is found
-        while ((speed_hz < spi_baud_hz) && (temp_spi_baud_prescaler < (SPI_BAUDRATEPRESCALER_256 >> SPI_CR1_BR_Pos)))
-        {
-            spi_baud_hz >>= 1;
-            temp_spi_baud_prescaler++;
-        }
+        return BSP_STATUS_FAIL;
+    }
 
-        // If no slower SPI baud was found
-        if ((speed_hz < spi_baud_hz) && (temp_spi_baud_prescaler >= (SPI_BAUDRATEPRESCALER_256 >> SPI_CR1_BR_Pos)))
-        {
-            ret = BSP_STATUS_FAIL;
-        }
-        else
-        {
-            if (HAL_SPI_DeInit(&hspi1) != HAL_OK)
-            {
-                Error_Handler();
-            }
+    if ((speed_hz != 0) && (bsp_spi_speed_to_prescaler(speed_hz, &prescaler)))
+    {
+        return BSP_STATUS_FAIL;
+    }
 
-            hspi1.Init.BaudRatePrescaler = (temp_spi_baud_prescaler << SPI_CR1_BR_Pos);
-            if (HAL_SPI_Init(&hspi1) != HAL_OK)
-            {
-                Error_Handler();
-            }
+    spi_dev_prescaler[bsp_dev_id] = prescaler;
+
+    return BSP_STATUS_OK;
+}
+
+#ifdef USE_CMSIS_OS
+uint32_t bsp_bus_lock(uint32_t bsp_dev_id, uint8_t bus_type, uint8_t priority)
+{
+    bsp_bus_arbiter_t *arb;
+    bsp_bus_waiter_t *w = NULL;
+    TaskHandle_t self;
+
+    if (bus_type >= BSP_BUS_TOTAL)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    // Until the scheduler starts there is only one context, so there is nothing to arbitrate
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+    {
+        return BSP_STATUS_OK;
+    }
+
+    // All devices of a bus type share one bus on this platform, so bsp_dev_id is not needed to select the arbiter
+    arb = &bsp_bus_arbiters[bus_type];
+    self = xTaskGetCurrentTaskHandle();
+
+    taskENTER_CRITICAL();
+    if ((arb->owner == NULL) || (arb->owner == self))
+    {
+        arb->owner = self;
+        arb->lock_count++;
+        taskEXIT_CRITICAL();
+
+        return BSP_STATUS_OK;
+    }
+
+    for (uint32_t i = 0; i < BSP_BUS_WAITERS_MAX; i++)
+    {
+        if (arb->waiters[i].task == NULL)
+        {
+            w = &(arb->waiters[i]);
+            w->task = self;
+            w->granted = false;
+            w->priority = priority;
+            w->order = arb->order++;
+            break;
         }
+    }
+    taskEXIT_CRITICAL();
 
+    if (w == NULL)
+    {
+        return BSP_STATUS_FAIL;
     }
 
-    return ret;
+    // bsp_bus_unlock makes this task the owner before giving the grant
+    xSemaphoreTake(w->grant, portMAX_DELAY);
+
+    taskENTER_CRITICAL();
+    w->task = NULL;
+    taskEXIT_CRITICAL();
+
+    return BSP_STATUS_OK;
 }
 
-uint32_t bsp_spi_restore_speed(void)
+uint32_t bsp_bus_unlock(uint32_t bsp_dev_id, uint8_t bus_type)
 {
-    // If the SPI baud rate was changed, restore it
-    if (spi_baud_prescaler != (hspi1.Init.BaudRatePrescaler >> SPI_CR1_BR_Pos))
+    bsp_bus_arbiter_t *arb;
+    bsp_bus_waiter_t *next = NULL;
+
+    if (bus_type >= BSP_BUS_TOTAL)
     {
-        if (HAL_SPI_DeInit(&hspi1) != HAL_OK)
+        return BSP_STATUS_FAIL;
+    }
+
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+    {
+        return BSP_STATUS_OK;
+    }
+
+    arb = &bsp_bus_arbiters[bus_type];
+
+    taskENTER_CRITICAL();
+    if ((arb->owner != xTaskGetCurrentTaskHandle()) || (arb->lock_count == 0))
+    {
+        taskEXIT_CRITICAL();
+
+        return BSP_STATUS_FAIL;
+    }
+
+    arb->lock_count--;
+    if (arb->lock_count == 0)
+    {
+        // Hand the bus to the highest priority waiter, oldest request first
+        for (uint32_t i = 0; i < BSP_BUS_WAITERS_MAX; i++)
         {
-            Error_Handler();
+            bsp_bus_waiter_t *w = &(arb->waiters[i]);
+
+            if ((w->task == NULL) || (w->granted))
+            {
+                continue;
+            }
+
+            if ((next == NULL) || \
+                (w->priority > next->priority) || \
+                ((w->priority == next->priority) && ((int32_t) (w->order - next->order) < 0)))
+            {
+                next = w;
+            }
         }
 
-        hspi1.Init.BaudRatePrescaler = (spi_baud_prescaler << SPI_CR1_BR_Pos);
-        if (HAL_SPI_Init(&hspi1) != HAL_OK)
+        if (next != NULL)
         {
-            Error_Handler();
+            next->granted = true;
+            arb->owner = next->task;
+            arb->lock_count = 1;
         }
+        else
+        {
+            arb->owner = NULL;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (next != NULL)
+    {
+        xSemaphoreGive(next->grant);
     }
 
     return BSP_STATUS_OK;
 }
+#endif
 
 void* bsp_malloc(size_t size)
 {
@@ -3449,6 +4088,114 @@ uint32_t bsp_eeprom_read(uint32_t addr,
     return ret;
 }
 
+uint32_t bsp_eeprom_read_start(uint32_t addr,
+                               uint8_t *data_buffer,
+                               uint32_t data_length)
+{
+    HAL_StatusTypeDef ret;
+    uint8_t buffer[4];
+
+    if ((data_buffer == NULL) || (data_length == 0) || (data_length > UINT16_MAX))
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    buffer[0] = BSP_EEPROM_OPCODE_READ_DATA;
+    buffer[1] = GET_BYTE_FROM_WORD(addr, 2);
+    buffer[2] = GET_BYTE_FROM_WORD(addr, 1);
+    buffer[3] = GET_BYTE_FROM_WORD(addr, 0);
+
+    bsp_wait_for_eeprom();
+
+#ifdef USE_CMSIS_OS
+    xSemaphoreTake(mutex_spi, portMAX_DELAY);
+#endif
+    bsp_spi_wait_for_dma();
+    bsp_spi_apply_speed(BSP_EEPROM_DEV_ID);
+
+    // Chip select low, and held low until HAL_SPI_RxCpltCallback()
+    HAL_GPIO_WritePin(GPIOD, GPIO_PIN_2, GPIO_PIN_RESET);
+
+    // The command and address are short enough to send blocking, only the data is read by DMA
+    ret = HAL_SPI_Transmit(&hspi1, buffer, 4, HAL_MAX_DELAY);
+    if (ret == HAL_OK)
+    {
+        spi_dma_error = false;
+        spi_dma_busy = true;
+        ret = HAL_SPI_Receive_DMA(&hspi1, data_buffer, data_length);
+        if (ret != HAL_OK)
+        {
+            spi_dma_busy = false;
+        }
+    }
+
+    if (ret != HAL_OK)
+    {
+        HAL_GPIO_WritePin(GPIOD, GPIO_PIN_2, GPIO_PIN_SET);
+    }
+
+#ifdef USE_CMSIS_OS
+    xSemaphoreGive(mutex_spi);
+#endif
+    if (ret)
+    {
+        return BSP_STATUS_FAIL;
+    }
+    else
+    {
+        return BSP_STATUS_OK;
+    }
+}
+
+uint32_t bsp_eeprom_read_wait(void)
+{
+    bsp_spi_wait_for_dma();
+
+    if (spi_dma_error)
+    {
+        spi_dma_error = false;
+        return BSP_STATUS_FAIL;
+    }
+
+    return BSP_STATUS_OK;
+}
+
+uint32_t bsp_eeprom_fw_img_find(uint32_t index, uint32_t *addr, uint32_t *size)
+{
+    uint32_t header[3];
+    uint32_t entry[2];
+
+    if ((addr == NULL) || (size == NULL))
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    // The index is little-endian, as is the MCU, so can be read straight into words
+    if (bsp_eeprom_read(BSP_EEPROM_FW_IMG_INDEX_ADDR, (uint8_t *) header, sizeof(header)))
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    if ((header[0] != BSP_EEPROM_FW_IMG_INDEX_MAGIC) ||
+        (header[1] != BSP_EEPROM_FW_IMG_INDEX_VERSION) ||
+        (index >= header[2]))
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    if (bsp_eeprom_read(BSP_EEPROM_FW_IMG_INDEX_ADDR + sizeof(header) + (index * sizeof(entry)),
+                        (uint8_t *) entry,
+                        sizeof(entry)))
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    *addr = entry[0];
+    *size = entry[1];
+
+    return BSP_STATUS_OK;
+}
+
 uint32_t bsp_eeprom_program(uint32_t addr,
                             uint8_t *data_buffer,
                             uint32_t data_length)
@@ -3574,6 +4321,7 @@ static bsp_driver_if_t bsp_driver_if_s =
     .set_supply = &bsp_set_supply,
     .register_gpio_cb = &bsp_register_gpio_cb,
     .set_timer = &bsp_set_timer,
+    .get_time_ms = &bsp_get_time_ms,
     .i2c_read_repeated_start = &bsp_i2c_read_repeated_start,
     .i2c_write = &bsp_i2c_write,
     .i2c_db_write = &bsp_i2c_db_write,
@@ -3583,7 +4331,12 @@ static bsp_driver_if_t bsp_driver_if_s =
     .enable_irq = &bsp_enable_irq,
     .disable_irq = &bsp_disable_irq,
     .spi_throttle_speed = &bsp_spi_throttle_speed,
-    .spi_restore_speed = &bsp_spi_restore_speed
+    .spi_restore_speed = &bsp_spi_restore_speed,
+    .spi_set_max_speed = &bsp_spi_set_max_speed,
+#ifdef USE_CMSIS_OS
+    .bus_lock = &bsp_bus_lock,
+    .bus_unlock = &bsp_bus_unlock,
+#endif
 };
 
 bsp_driver_if_t *bsp_driver_if_g = &bsp_driver_if_s;
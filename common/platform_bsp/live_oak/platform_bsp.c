@@ -25,7 +25,6 @@
 #include <stdlib.h>
 #include "platform_bsp.h"
 #include "stm32f4xx_hal.h"
-#include "test_tone_tables.h"
 #ifdef USE_CMSIS_OS
 #include "FreeRTOS.h"
 #include "semphr.h"
@@ -832,6 +831,11 @@ uint32_t bsp_audio_set_fs(uint32_t fs_hz)
     return BSP_STATUS_FAIL;
 }
 
+uint32_t bsp_audio_set_tone(const tone_gen_config_t *config)
+{
+    return BSP_STATUS_FAIL;
+}
+
 uint32_t bsp_audio_play(uint8_t content)
 {
     return BSP_STATUS_FAIL;
@@ -847,6 +851,19 @@ uint32_t bsp_audio_play_record(uint8_t content)
     return BSP_STATUS_FAIL;
 }
 
+uint32_t bsp_audio_stream_start(bsp_audio_stream_cb_t play_cb,
+                                void *play_cb_arg,
+                                bsp_audio_stream_cb_t record_cb,
+                                void *record_cb_arg)
+{
+    return BSP_STATUS_FAIL;
+}
+
+uint32_t bsp_audio_stream_get_stats(bsp_audio_stream_stats_t *stats)
+{
+    return BSP_STATUS_FAIL;
+}
+
 uint32_t bsp_audio_pause(void)
 {
     return BSP_STATUS_FAIL;
@@ -1136,6 +1153,11 @@ void bsp_sleep(void)
     return;
 }
 
+uint32_t bsp_get_time_ms(void)
+{
+    return HAL_GetTick();
+}
+
 uint32_t bsp_spi_throttle_speed(uint32_t speed_hz)
 {
     return BSP_STATUS_FAIL;
@@ -1248,6 +1270,7 @@ static bsp_driver_if_t bsp_driver_if_s =
     .set_supply = &bsp_set_supply,
     .register_gpio_cb = &bsp_register_gpio_cb,
     .set_timer = &bsp_set_timer,
+    .get_time_ms = &bsp_get_time_ms,
     .i2c_read_repeated_start = &bsp_i2c_read_repeated_start,
     .i2c_write = &bsp_i2c_write,
     .i2c_db_write = &bsp_i2c_db_write,
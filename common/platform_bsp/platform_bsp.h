@@ -34,6 +34,7 @@ extern "C" {
 #include <stdbool.h>
 #include <stddef.h>
 #include "bsp_dut.h"
+#include "tone_gen.h"
 #include <stdio.h>
 
 /***********************************************************************************************************************
@@ -74,6 +75,7 @@ extern "C" {
 #define BSP_PLAY_STEREO_1KHZ_20DBFS     (1)
 #define BSP_PLAY_STEREO_100HZ_20DBFS    (2)
 #define BSP_PLAY_STEREO_PATTERN         (3)
+#define BSP_PLAY_TONE                   (4)     ///< Tone set by bsp_audio_set_tone
 
 #define BSP_BUS_TYPE_I2C                (0)
 #define BSP_BUS_TYPE_SPI                (1)
@@ -109,6 +111,14 @@ extern "C" {
 #define BSP_EEPROM_OPCODE_BLOCK_ERASE_32KB          (0x52)
 #define BSP_EEPROM_OPCODE_BLOCK_ERASE_64KB          (0xD8)
 
+/*
+ * Index of the fw_imgs in the EEPROM, as written by tools/fw_img_eeprom.  All fields are little-endian words:
+ * magic, version, count, then an address and size for each fw_img.
+ */
+#define BSP_EEPROM_FW_IMG_INDEX_ADDR                (0x0)
+#define BSP_EEPROM_FW_IMG_INDEX_MAGIC               (0x58495746) // "FWIX"
+#define BSP_EEPROM_FW_IMG_INDEX_VERSION             (1)
+
 /***********************************************************************************************************************
  * MACROS
  **********************************************************************************************************************/
@@ -123,6 +133,20 @@ extern "C" {
  **********************************************************************************************************************/
 typedef void (*bsp_app_callback_t)(uint32_t status, void *arg);
 
+/*
+ * Fills (play) or drains (record) 'frames' stereo frames of 'buffer', in the I2S DMA layout, and returns the number of
+ * frames actually filled or drained.  Called from the I2S DMA IRQ for the half of the buffer the DMA is not using.
+ */
+typedef uint32_t (*bsp_audio_stream_cb_t)(void *buffer, uint32_t frames, void *arg);
+
+typedef struct
+{
+    uint32_t periods;                   // Half buffers serviced since the stream was started
+    uint32_t tx_underruns;              // Half buffers the producer did not fill completely, or filled too late
+    uint32_t rx_overruns;               // Half buffers the consumer did not drain completely, or drained too late
+    uint32_t tx_latency_frames;         // Frames filled by the producer and not yet sent, when the stats were read
+} bsp_audio_stream_stats_t;
+
 /***********************************************************************************************************************
  * GLOBAL VARIABLES
  **********************************************************************************************************************/
@@ -140,14 +164,21 @@ extern FILE* bridge_read_file;
  **********************************************************************************************************************/
 uint32_t bsp_initialize(bsp_app_callback_t cb, void *cb_arg);
 uint32_t bsp_audio_set_fs(uint32_t fs_hz);
+uint32_t bsp_audio_set_tone(const tone_gen_config_t *config);
 uint32_t bsp_audio_play(uint8_t content);
 uint32_t bsp_audio_play_record(uint8_t content);
+uint32_t bsp_audio_stream_start(bsp_audio_stream_cb_t play_cb,
+                                void *play_cb_arg,
+                                bsp_audio_stream_cb_t record_cb,
+                                void *record_cb_arg);
+uint32_t bsp_audio_stream_get_stats(bsp_audio_stream_stats_t *stats);
 uint32_t bsp_audio_pause(void);
 uint32_t bsp_audio_resume(void);
 uint32_t bsp_audio_stop(void);
 uint32_t bsp_set_timer(uint32_t duration_ms, bsp_callback_t cb, void *cb_arg);
 bool     bsp_was_pb_pressed(uint8_t pb_id);
 void     bsp_sleep(void);
+uint32_t bsp_get_time_ms(void);
 uint32_t bsp_register_pb_cb(uint32_t pb_id, bsp_app_callback_t cb, void *cb_arg);
 void     bsp_notification_callback(uint32_t event_flags, void *arg);
 uint32_t bsp_i2c_read_repeated_start(uint32_t bsp_dev_id,
@@ -172,6 +203,11 @@ uint32_t bsp_eeprom_read_jedecid(uint8_t *buffer);
 uint32_t bsp_eeprom_read(uint32_t addr,
                          uint8_t *data_buffer,
                          uint32_t data_length);
+uint32_t bsp_eeprom_read_start(uint32_t addr,
+                               uint8_t *data_buffer,
+                               uint32_t data_length);
+uint32_t bsp_eeprom_read_wait(void);
+uint32_t bsp_eeprom_fw_img_find(uint32_t index, uint32_t *addr, uint32_t *size);
 uint32_t bsp_eeprom_program(uint32_t addr,
                             uint8_t *data_buffer,
                             uint32_t data_length);
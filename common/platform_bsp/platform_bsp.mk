@@ -49,7 +49,7 @@ C_SRCS += $(REPO_PATH)/common/platform_bsp/sysmem.c
 C_SRCS += $(REPO_PATH)/common/platform_bsp/$(PLATFORM)/platform_bsp.c
 C_SRCS += $(REPO_PATH)/common/platform_bsp/$(PLATFORM)/stm32f4xx_it.c
 ifeq ($(PLATFORM), eestm32int)
-	C_SRCS += $(REPO_PATH)/common/platform_bsp/test_tone_tables.c
+	C_SRCS += $(REPO_PATH)/common/platform_bsp/tone_gen.c
 endif
 
 # Assign includes
@@ -1,1345 +0,0 @@
-/*!***************************************************************************
-* @file test_tone_tables.c
-*
-* @brief PCM sample tables for Render path Test Tone
-*
-*
-******************************************************************************
-* @copyright
-* Copyright (c) 2019 All Rights Reserved, http://www.cirrus.com/
-*
- * Licensed under the Apache License, Version 2.0 (the License); you may
- * not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- * www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an AS IS BASIS, WITHOUT
- * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
-*
-*/
-
-/*****************************************************************************
-* Header Includes
-*****************************************************************************/
-#include "test_tone_tables.h"
-
-/*****************************************************************************
-* Macro Definitions
-*****************************************************************************/
-
-/*****************************************************************************
-* Type Definitions
-*****************************************************************************/
-
-/*****************************************************************************
-* Function Declarations
-*****************************************************************************/
-
-/*****************************************************************************
-* Variable Declarations
-*****************************************************************************/
-
-/**
- * Table of PCM samples for single period of stereo / 1kHz sine / -20dBFs / 32-bit
- *
- * Table uses type of uint16_t, so 32-bit samples are broken into 16-bit words.  Total length of table is
- * PCM_1KHZ_SINGLE_PERIOD_LENGTH_2BYTES per channel, thus * 2 for stereo.  16-bit words are arranged MS-Word of Left
- * channel first:
- * - MS-Word of Left channel Sample 1
- * - LS-Word of Left channel Sample 1
- * - MS-Word of Right channel Sample 1
- * - LS-Word of Right channel Sample 1
- * - MS-Word of Left channel Sample 2
- * - ...
- *
- */
-const uint16_t pcm_20dBFs_1kHz_32bit_stereo_single_period[PCM_1KHZ_SINGLE_PERIOD_LENGTH_2BYTES * 2] =
-{
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0357, 0x6a9c, 0x0357, 0x6a9c,
-    0x06a0, 0x324d, 0x06a0, 0x324d,
-    0x09cb, 0xf442, 0x09cb, 0xf442,
-    0x0ccc, 0xcccc, 0x0ccc, 0xcccc,
-    0x0f95, 0x9432, 0x0f95, 0x9432,
-    0x121a, 0x1851, 0x121a, 0x1851,
-    0x144f, 0x5208, 0x144f, 0x5208,
-    0x162b, 0x9586, 0x162b, 0x9586,
-    0x17a6, 0xbca5, 0x17a6, 0xbca5,
-    0x18ba, 0x4a9f, 0x18ba, 0x4a9f,
-    0x1961, 0x8875, 0x1961, 0x8875,
-    0x1999, 0x9999, 0x1999, 0x9999,
-    0x1961, 0x8875, 0x1961, 0x8875,
-    0x18ba, 0x4a9f, 0x18ba, 0x4a9f,
-    0x17a6, 0xbca5, 0x17a6, 0xbca5,
-    0x162b, 0x9586, 0x162b, 0x9586,
-    0x144f, 0x5208, 0x144f, 0x5208,
-    0x121a, 0x1851, 0x121a, 0x1851,
-    0x0f95, 0x9432, 0x0f95, 0x9432,
-    0x0ccc, 0xcccc, 0x0ccc, 0xcccc,
-    0x09cb, 0xf442, 0x09cb, 0xf442,
-    0x06a0, 0x324d, 0x06a0, 0x324d,
-    0x0357, 0x6a9c, 0x0357, 0x6a9c,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0xfca8, 0x9564, 0xfca8, 0x9564,
-    0xf95f, 0xcdb3, 0xf95f, 0xcdb3,
-    0xf634, 0x0bbe, 0xf634, 0x0bbe,
-    0xf333, 0x3334, 0xf333, 0x3334,
-    0xf06a, 0x6bce, 0xf06a, 0x6bce,
-    0xede5, 0xe7af, 0xede5, 0xe7af,
-    0xebb0, 0xadf8, 0xebb0, 0xadf8,
-    0xe9d4, 0x6a7a, 0xe9d4, 0x6a7a,
-    0xe859, 0x435b, 0xe859, 0x435b,
-    0xe745, 0xb561, 0xe745, 0xb561,
-    0xe69e, 0x778b, 0xe69e, 0x778b,
-    0xe666, 0x6667, 0xe666, 0x6667,
-    0xe69e, 0x778b, 0xe69e, 0x778b,
-    0xe745, 0xb561, 0xe745, 0xb561,
-    0xe859, 0x435b, 0xe859, 0x435b,
-    0xe9d4, 0x6a7a, 0xe9d4, 0x6a7a,
-    0xebb0, 0xadf8, 0xebb0, 0xadf8,
-    0xede5, 0xe7af, 0xede5, 0xe7af,
-    0xf06a, 0x6bce, 0xf06a, 0x6bce,
-    0xf333, 0x3334, 0xf333, 0x3334,
-    0xf634, 0x0bbe, 0xf634, 0x0bbe,
-    0xf95f, 0xcdb3, 0xf95f, 0xcdb3,
-    0xfca8, 0x9564, 0xfca8, 0x9564,
-};
-
-/**
- * Table of PCM samples for single period of stereo / silence / -20dBFs / 32-bit
- *
- * Table uses type of uint16_t, so 32-bit samples are broken into 16-bit words.  Total length of table is
- * PCM_1KHZ_SINGLE_PERIOD_LENGTH_2BYTES per channel, thus * 2 for stereo.  16-bit words are arranged MS-Word of Left
- * channel first:
- * - MS-Word of Left channel Sample 1
- * - LS-Word of Left channel Sample 1
- * - MS-Word of Right channel Sample 1
- * - LS-Word of Right channel Sample 1
- * - MS-Word of Left channel Sample 2
- * - ...
- *
- */
-const uint16_t pcm_silence_32bit_stereo_single_period[PCM_1KHZ_SINGLE_PERIOD_LENGTH_2BYTES * 2] =
-{
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000,
-};
-
-/**
- * Table of PCM samples for single period of stereo / 1kHz sine / -20dBFs / 16-bit
- *
- * Table uses type of uint16_t, so 16-bit samples are directly implemented.  Total length of table is
- * PCM_1KHZ_SINGLE_PERIOD_LENGTH per channel, thus * 2 for stereo.  16-bit words are arranged Left
- * channel first:
- * - Left channel Sample 1
- * - Right channel Sample 1
- * - eft channel Sample 2
- * - ...
- *
- */
-const uint16_t pcm_20dBFs_1kHz_16bit_stereo_single_period[PCM_1KHZ_SINGLE_PERIOD_LENGTH * 2] =
-{
-    0x0000, 0x0000,
-    0x0357, 0x0357,
-    0x06a0, 0x06a0,
-    0x09cb, 0x09cb,
-    0x0ccc, 0x0ccc,
-    0x0f95, 0x0f95,
-    0x121a, 0x121a,
-    0x144f, 0x144f,
-    0x162b, 0x162b,
-    0x17a6, 0x17a6,
-    0x18ba, 0x18ba,
-    0x1961, 0x1961,
-    0x1999, 0x1999,
-    0x1961, 0x1961,
-    0x18ba, 0x18ba,
-    0x17a6, 0x17a6,
-    0x162b, 0x162b,
-    0x144f, 0x144f,
-    0x121a, 0x121a,
-    0x0f95, 0x0f95,
-    0x0ccc, 0x0ccc,
-    0x09cb, 0x09cb,
-    0x06a0, 0x06a0,
-    0x0357, 0x0357,
-    0x0000, 0x0000,
-    0xfca8, 0xfca8,
-    0xf95f, 0xf95f,
-    0xf634, 0xf634,
-    0xf333, 0xf333,
-    0xf06a, 0xf06a,
-    0xede5, 0xede5,
-    0xebb0, 0xebb0,
-    0xe9d4, 0xe9d4,
-    0xe859, 0xe859,
-    0xe745, 0xe745,
-    0xe69e, 0xe69e,
-    0xe666, 0xe666,
-    0xe69e, 0xe69e,
-    0xe745, 0xe745,
-    0xe859, 0xe859,
-    0xe9d4, 0xe9d4,
-    0xebb0, 0xebb0,
-    0xede5, 0xede5,
-    0xf06a, 0xf06a,
-    0xf333, 0xf333,
-    0xf634, 0xf634,
-    0xf95f, 0xf95f,
-    0xfca8, 0xfca8,
-};
-
-/**
- * Table of PCM samples for single period of stereo / silence / -20dBFs / 16-bit
- *
- * Table uses type of uint16_t, so 16-bit samples are directly implemented.  Total length of table is
- * PCM_1KHZ_SINGLE_PERIOD_LENGTH per channel, thus * 2 for stereo.  16-bit words are arranged Left
- * channel first:
- * - Left channel Sample 1
- * - Right channel Sample 1
- * - eft channel Sample 2
- * - ...
- *
- */
-const uint16_t pcm_silence_16bit_stereo_single_period[PCM_1KHZ_SINGLE_PERIOD_LENGTH * 2] =
-{
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-    0x0000, 0x0000,
-};
-
-#ifdef TEST_TONES_INCLUDE_100HZ
-/**
- * Table of PCM samples for single period of stereo / 100Hz / -20dBFs / 32-bit
- *
- * Table uses type of uint16_t, so 32-bit samples are broken into 16-bit words.  Total length of table is
- * PCM_1KHZ_SINGLE_PERIOD_LENGTH_2BYTES per channel, thus * 2 for stereo.  16-bit words are arranged MS-Word of Left
- * channel first:
- * - MS-Word of Left channel Sample 1
- * - LS-Word of Left channel Sample 1
- * - MS-Word of Right channel Sample 1
- * - LS-Word of Right channel Sample 1
- * - MS-Word of Left channel Sample 2
- * - ...
- *
- */
-const uint16_t pcm_20dBFs_100Hz_32bit_stereo_single_period[] =
-{
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0x0055, 0xc8b2, 0x0055, 0xc8b2,
-    0x00ab, 0x8da1, 0x00ab, 0x8da1,
-    0x0101, 0x4b0a, 0x0101, 0x4b0a,
-    0x0156, 0xfd29, 0x0156, 0xfd29,
-    0x01ac, 0xa03e, 0x01ac, 0xa03e,
-    0x0202, 0x3085, 0x0202, 0x3085,
-    0x0257, 0xaa3e, 0x0257, 0xaa3e,
-    0x02ad, 0x09a8, 0x02ad, 0x09a8,
-    0x0302, 0x4b07, 0x0302, 0x4b07,
-    0x0357, 0x6a9c, 0x0357, 0x6a9c,
-    0x03ac, 0x64ab, 0x03ac, 0x64ab,
-    0x0401, 0x357b, 0x0401, 0x357b,
-    0x0455, 0xd952, 0x0455, 0xd952,
-    0x04aa, 0x4c79, 0x04aa, 0x4c79,
-    0x04fe, 0x8b3f, 0x04fe, 0x8b3f,
-    0x0552, 0x91ef, 0x0552, 0x91ef,
-    0x05a6, 0x5cda, 0x05a6, 0x5cda,
-    0x05f9, 0xe854, 0x05f9, 0xe854,
-    0x064d, 0x30b2, 0x064d, 0x30b2,
-    0x06a0, 0x324d, 0x06a0, 0x324d,
-    0x06f2, 0xe981, 0x06f2, 0xe981,
-    0x0745, 0x52ad, 0x0745, 0x52ad,
-    0x0797, 0x6a34, 0x0797, 0x6a34,
-    0x07e9, 0x2c7c, 0x07e9, 0x2c7c,
-    0x083a, 0x95ee, 0x083a, 0x95ee,
-    0x088b, 0xa2fa, 0x088b, 0xa2fa,
-    0x08dc, 0x5010, 0x08dc, 0x5010,
-    0x092c, 0x99a6, 0x092c, 0x99a6,
-    0x097c, 0x7c37, 0x097c, 0x7c37,
-    0x09cb, 0xf442, 0x09cb, 0xf442,
-    0x0a1a, 0xfe4b, 0x0a1a, 0xfe4b,
-    0x0a69, 0x96d9, 0x0a69, 0x96d9,
-    0x0ab7, 0xba7c, 0x0ab7, 0xba7c,
-    0x0b05, 0x65c4, 0x0b05, 0x65c4,
-    0x0b52, 0x9549, 0x0b52, 0x9549,
-    0x0b9f, 0x45aa, 0x0b9f, 0x45aa,
-    0x0beb, 0x7389, 0x0beb, 0x7389,
-    0x0c37, 0x1b8e, 0x0c37, 0x1b8e,
-    0x0c82, 0x3a68, 0x0c82, 0x3a68,
-    0x0ccc, 0xcccc, 0x0ccc, 0xcccc,
-    0x0d16, 0xcf74, 0x0d16, 0xcf74,
-    0x0d60, 0x3f20, 0x0d60, 0x3f20,
-    0x0da9, 0x1899, 0x0da9, 0x1899,
-    0x0df1, 0x58ac, 0x0df1, 0x58ac,
-    0x0e38, 0xfc2e, 0x0e38, 0xfc2e,
-    0x0e7f, 0xfffa, 0x0e7f, 0xfffa,
-    0x0ec6, 0x60f3, 0x0ec6, 0x60f3,
-    0x0f0c, 0x1c03, 0x0f0c, 0x1c03,
-    0x0f51, 0x2e1b, 0x0f51, 0x2e1b,
-    0x0f95, 0x9432, 0x0f95, 0x9432,
-    0x0fd9, 0x4b4a, 0x0fd9, 0x4b4a,
-    0x101c, 0x5069, 0x101c, 0x5069,
-    0x105e, 0xa0a0, 0x105e, 0xa0a0,
-    0x10a0, 0x3904, 0x10a0, 0x3904,
-    0x10e1, 0x16b7, 0x10e1, 0x16b7,
-    0x1121, 0x36de, 0x1121, 0x36de,
-    0x1160, 0x96ac, 0x1160, 0x96ac,
-    0x119f, 0x3357, 0x119f, 0x3357,
-    0x11dd, 0x0a20, 0x11dd, 0x0a20,
-    0x121a, 0x1851, 0x121a, 0x1851,
-    0x1256, 0x5b3d, 0x1256, 0x5b3d,
-    0x1291, 0xd040, 0x1291, 0xd040,
-    0x12cc, 0x74bc, 0x12cc, 0x74bc,
-    0x1306, 0x461f, 0x1306, 0x461f,
-    0x133f, 0x41e2, 0x133f, 0x41e2,
-    0x1377, 0x6583, 0x1377, 0x6583,
-    0x13ae, 0xae8c, 0x13ae, 0xae8c,
-    0x13e5, 0x1a90, 0x13e5, 0x1a90,
-    0x141a, 0xa72d, 0x141a, 0xa72d,
-    0x144f, 0x5208, 0x144f, 0x5208,
-    0x1483, 0x18d4, 0x1483, 0x18d4,
-    0x14b5, 0xf949, 0x14b5, 0xf949,
-    0x14e7, 0xf12d, 0x14e7, 0xf12d,
-    0x1518, 0xfe4e, 0x1518, 0xfe4e,
-    0x1549, 0x1e87, 0x1549, 0x1e87,
-    0x1578, 0x4fba, 0x1578, 0x4fba,
-    0x15a6, 0x8fd5, 0x15a6, 0x8fd5,
-    0x15d3, 0xdcd1, 0x15d3, 0xdcd1,
-    0x1600, 0x34b3, 0x1600, 0x34b3,
-    0x162b, 0x9586, 0x162b, 0x9586,
-    0x1655, 0xfd65, 0x1655, 0xfd65,
-    0x167f, 0x6a73, 0x167f, 0x6a73,
-    0x16a7, 0xdadf, 0x16a7, 0xdadf,
-    0x16cf, 0x4ce4, 0x16cf, 0x4ce4,
-    0x16f5, 0xbec5, 0x16f5, 0xbec5,
-    0x171b, 0x2ed3, 0x171b, 0x2ed3,
-    0x173f, 0x9b6b, 0x173f, 0x9b6b,
-    0x1763, 0x02f2, 0x1763, 0x02f2,
-    0x1785, 0x63db, 0x1785, 0x63db,
-    0x17a6, 0xbca5, 0x17a6, 0xbca5,
-    0x17c7, 0x0bd9, 0x17c7, 0x0bd9,
-    0x17e6, 0x500b, 0x17e6, 0x500b,
-    0x1804, 0x87de, 0x1804, 0x87de,
-    0x1821, 0xb1fd, 0x1821, 0xb1fd,
-    0x183d, 0xcd21, 0x183d, 0xcd21,
-    0x1858, 0xd80f, 0x1858, 0xd80f,
-    0x1872, 0xd196, 0x1872, 0xd196,
-    0x188b, 0xb894, 0x188b, 0xb894,
-    0x18a3, 0x8bf0, 0x18a3, 0x8bf0,
-    0x18ba, 0x4a9f, 0x18ba, 0x4a9f,
-    0x18cf, 0xf3a1, 0x18cf, 0xf3a1,
-    0x18e4, 0x8604, 0x18e4, 0x8604,
-    0x18f8, 0x00e1, 0x18f8, 0x00e1,
-    0x190a, 0x635b, 0x190a, 0x635b,
-    0x191b, 0xaca6, 0x191b, 0xaca6,
-    0x192b, 0xdbff, 0x192b, 0xdbff,
-    0x193a, 0xf0b0, 0x193a, 0xf0b0,
-    0x1948, 0xea10, 0x1948, 0xea10,
-    0x1955, 0xc782, 0x1955, 0xc782,
-    0x1961, 0x8875, 0x1961, 0x8875,
-    0x196c, 0x2c66, 0x196c, 0x2c66,
-    0x1975, 0xb2dd, 0x1975, 0xb2dd,
-    0x197e, 0x1b6f, 0x197e, 0x1b6f,
-    0x1985, 0x65be, 0x1985, 0x65be,
-    0x198b, 0x9177, 0x198b, 0x9177,
-    0x1990, 0x9e57, 0x1990, 0x9e57,
-    0x1994, 0x8c22, 0x1994, 0x8c22,
-    0x1997, 0x5aaf, 0x1997, 0x5aaf,
-    0x1999, 0x09dd, 0x1999, 0x09dd,
-    0x1999, 0x9999, 0x1999, 0x9999,
-    0x1999, 0x09dd, 0x1999, 0x09dd,
-    0x1997, 0x5aaf, 0x1997, 0x5aaf,
-    0x1994, 0x8c22, 0x1994, 0x8c22,
-    0x1990, 0x9e57, 0x1990, 0x9e57,
-    0x198b, 0x9177, 0x198b, 0x9177,
-    0x1985, 0x65be, 0x1985, 0x65be,
-    0x197e, 0x1b6f, 0x197e, 0x1b6f,
-    0x1975, 0xb2dd, 0x1975, 0xb2dd,
-    0x196c, 0x2c66, 0x196c, 0x2c66,
-    0x1961, 0x8875, 0x1961, 0x8875,
-    0x1955, 0xc782, 0x1955, 0xc782,
-    0x1948, 0xea10, 0x1948, 0xea10,
-    0x193a, 0xf0b0, 0x193a, 0xf0b0,
-    0x192b, 0xdbff, 0x192b, 0xdbff,
-    0x191b, 0xaca6, 0x191b, 0xaca6,
-    0x190a, 0x635b, 0x190a, 0x635b,
-    0x18f8, 0x00e1, 0x18f8, 0x00e1,
-    0x18e4, 0x8604, 0x18e4, 0x8604,
-    0x18cf, 0xf3a1, 0x18cf, 0xf3a1,
-    0x18ba, 0x4a9f, 0x18ba, 0x4a9f,
-    0x18a3, 0x8bf0, 0x18a3, 0x8bf0,
-    0x188b, 0xb894, 0x188b, 0xb894,
-    0x1872, 0xd196, 0x1872, 0xd196,
-    0x1858, 0xd80f, 0x1858, 0xd80f,
-    0x183d, 0xcd21, 0x183d, 0xcd21,
-    0x1821, 0xb1fd, 0x1821, 0xb1fd,
-    0x1804, 0x87de, 0x1804, 0x87de,
-    0x17e6, 0x500b, 0x17e6, 0x500b,
-    0x17c7, 0x0bd9, 0x17c7, 0x0bd9,
-    0x17a6, 0xbca5, 0x17a6, 0xbca5,
-    0x1785, 0x63db, 0x1785, 0x63db,
-    0x1763, 0x02f2, 0x1763, 0x02f2,
-    0x173f, 0x9b6b, 0x173f, 0x9b6b,
-    0x171b, 0x2ed3, 0x171b, 0x2ed3,
-    0x16f5, 0xbec5, 0x16f5, 0xbec5,
-    0x16cf, 0x4ce4, 0x16cf, 0x4ce4,
-    0x16a7, 0xdadf, 0x16a7, 0xdadf,
-    0x167f, 0x6a73, 0x167f, 0x6a73,
-    0x1655, 0xfd65, 0x1655, 0xfd65,
-    0x162b, 0x9586, 0x162b, 0x9586,
-    0x1600, 0x34b3, 0x1600, 0x34b3,
-    0x15d3, 0xdcd1, 0x15d3, 0xdcd1,
-    0x15a6, 0x8fd5, 0x15a6, 0x8fd5,
-    0x1578, 0x4fba, 0x1578, 0x4fba,
-    0x1549, 0x1e87, 0x1549, 0x1e87,
-    0x1518, 0xfe4e, 0x1518, 0xfe4e,
-    0x14e7, 0xf12d, 0x14e7, 0xf12d,
-    0x14b5, 0xf949, 0x14b5, 0xf949,
-    0x1483, 0x18d4, 0x1483, 0x18d4,
-    0x144f, 0x5208, 0x144f, 0x5208,
-    0x141a, 0xa72d, 0x141a, 0xa72d,
-    0x13e5, 0x1a90, 0x13e5, 0x1a90,
-    0x13ae, 0xae8c, 0x13ae, 0xae8c,
-    0x1377, 0x6583, 0x1377, 0x6583,
-    0x133f, 0x41e2, 0x133f, 0x41e2,
-    0x1306, 0x461f, 0x1306, 0x461f,
-    0x12cc, 0x74bc, 0x12cc, 0x74bc,
-    0x1291, 0xd040, 0x1291, 0xd040,
-    0x1256, 0x5b3d, 0x1256, 0x5b3d,
-    0x121a, 0x1851, 0x121a, 0x1851,
-    0x11dd, 0x0a20, 0x11dd, 0x0a20,
-    0x119f, 0x3357, 0x119f, 0x3357,
-    0x1160, 0x96ac, 0x1160, 0x96ac,
-    0x1121, 0x36de, 0x1121, 0x36de,
-    0x10e1, 0x16b7, 0x10e1, 0x16b7,
-    0x10a0, 0x3904, 0x10a0, 0x3904,
-    0x105e, 0xa0a0, 0x105e, 0xa0a0,
-    0x101c, 0x5069, 0x101c, 0x5069,
-    0x0fd9, 0x4b4a, 0x0fd9, 0x4b4a,
-    0x0f95, 0x9432, 0x0f95, 0x9432,
-    0x0f51, 0x2e1b, 0x0f51, 0x2e1b,
-    0x0f0c, 0x1c03, 0x0f0c, 0x1c03,
-    0x0ec6, 0x60f3, 0x0ec6, 0x60f3,
-    0x0e7f, 0xfffa, 0x0e7f, 0xfffa,
-    0x0e38, 0xfc2e, 0x0e38, 0xfc2e,
-    0x0df1, 0x58ac, 0x0df1, 0x58ac,
-    0x0da9, 0x1899, 0x0da9, 0x1899,
-    0x0d60, 0x3f20, 0x0d60, 0x3f20,
-    0x0d16, 0xcf74, 0x0d16, 0xcf74,
-    0x0ccc, 0xcccc, 0x0ccc, 0xcccc,
-    0x0c82, 0x3a68, 0x0c82, 0x3a68,
-    0x0c37, 0x1b8e, 0x0c37, 0x1b8e,
-    0x0beb, 0x7389, 0x0beb, 0x7389,
-    0x0b9f, 0x45aa, 0x0b9f, 0x45aa,
-    0x0b52, 0x9549, 0x0b52, 0x9549,
-    0x0b05, 0x65c4, 0x0b05, 0x65c4,
-    0x0ab7, 0xba7c, 0x0ab7, 0xba7c,
-    0x0a69, 0x96d9, 0x0a69, 0x96d9,
-    0x0a1a, 0xfe4b, 0x0a1a, 0xfe4b,
-    0x09cb, 0xf442, 0x09cb, 0xf442,
-    0x097c, 0x7c37, 0x097c, 0x7c37,
-    0x092c, 0x99a6, 0x092c, 0x99a6,
-    0x08dc, 0x5010, 0x08dc, 0x5010,
-    0x088b, 0xa2fa, 0x088b, 0xa2fa,
-    0x083a, 0x95ee, 0x083a, 0x95ee,
-    0x07e9, 0x2c7c, 0x07e9, 0x2c7c,
-    0x0797, 0x6a34, 0x0797, 0x6a34,
-    0x0745, 0x52ad, 0x0745, 0x52ad,
-    0x06f2, 0xe981, 0x06f2, 0xe981,
-    0x06a0, 0x324d, 0x06a0, 0x324d,
-    0x064d, 0x30b2, 0x064d, 0x30b2,
-    0x05f9, 0xe854, 0x05f9, 0xe854,
-    0x05a6, 0x5cda, 0x05a6, 0x5cda,
-    0x0552, 0x91ef, 0x0552, 0x91ef,
-    0x04fe, 0x8b3f, 0x04fe, 0x8b3f,
-    0x04aa, 0x4c79, 0x04aa, 0x4c79,
-    0x0455, 0xd952, 0x0455, 0xd952,
-    0x0401, 0x357b, 0x0401, 0x357b,
-    0x03ac, 0x64ab, 0x03ac, 0x64ab,
-    0x0357, 0x6a9c, 0x0357, 0x6a9c,
-    0x0302, 0x4b07, 0x0302, 0x4b07,
-    0x02ad, 0x09a8, 0x02ad, 0x09a8,
-    0x0257, 0xaa3e, 0x0257, 0xaa3e,
-    0x0202, 0x3085, 0x0202, 0x3085,
-    0x01ac, 0xa03e, 0x01ac, 0xa03e,
-    0x0156, 0xfd29, 0x0156, 0xfd29,
-    0x0101, 0x4b0a, 0x0101, 0x4b0a,
-    0x00ab, 0x8da1, 0x00ab, 0x8da1,
-    0x0055, 0xc8b2, 0x0055, 0xc8b2,
-    0x0000, 0x0000, 0x0000, 0x0000,
-    0xffaa, 0x374e, 0xffaa, 0x374e,
-    0xff54, 0x725f, 0xff54, 0x725f,
-    0xfefe, 0xb4f6, 0xfefe, 0xb4f6,
-    0xfea9, 0x02d7, 0xfea9, 0x02d7,
-    0xfe53, 0x5fc2, 0xfe53, 0x5fc2,
-    0xfdfd, 0xcf7b, 0xfdfd, 0xcf7b,
-    0xfda8, 0x55c2, 0xfda8, 0x55c2,
-    0xfd52, 0xf657, 0xfd52, 0xf657,
-    0xfcfd, 0xb4f9, 0xfcfd, 0xb4f9,
-    0xfca8, 0x9564, 0xfca8, 0x9564,
-    0xfc53, 0x9b55, 0xfc53, 0x9b55,
-    0xfbfe, 0xca85, 0xfbfe, 0xca85,
-    0xfbaa, 0x26ae, 0xfbaa, 0x26ae,
-    0xfb55, 0xb386, 0xfb55, 0xb386,
-    0xfb01, 0x74c1, 0xfb01, 0x74c1,
-    0xfaad, 0x6e11, 0xfaad, 0x6e11,
-    0xfa59, 0xa326, 0xfa59, 0xa326,
-    0xfa06, 0x17ac, 0xfa06, 0x17ac,
-    0xf9b2, 0xcf4e, 0xf9b2, 0xcf4e,
-    0xf95f, 0xcdb3, 0xf95f, 0xcdb3,
-    0xf90d, 0x167f, 0xf90d, 0x167f,
-    0xf8ba, 0xad53, 0xf8ba, 0xad53,
-    0xf868, 0x95cc, 0xf868, 0x95cc,
-    0xf816, 0xd384, 0xf816, 0xd384,
-    0xf7c5, 0x6a12, 0xf7c5, 0x6a12,
-    0xf774, 0x5d06, 0xf774, 0x5d06,
-    0xf723, 0xaff0, 0xf723, 0xaff0,
-    0xf6d3, 0x665a, 0xf6d3, 0x665a,
-    0xf683, 0x83c9, 0xf683, 0x83c9,
-    0xf634, 0x0bbe, 0xf634, 0x0bbe,
-    0xf5e5, 0x01b5, 0xf5e5, 0x01b5,
-    0xf596, 0x6927, 0xf596, 0x6927,
-    0xf548, 0x4584, 0xf548, 0x4584,
-    0xf4fa, 0x9a3c, 0xf4fa, 0x9a3c,
-    0xf4ad, 0x6ab7, 0xf4ad, 0x6ab7,
-    0xf460, 0xba55, 0xf460, 0xba55,
-    0xf414, 0x8c77, 0xf414, 0x8c77,
-    0xf3c8, 0xe472, 0xf3c8, 0xe472,
-    0xf37d, 0xc597, 0xf37d, 0xc597,
-    0xf333, 0x3334, 0xf333, 0x3334,
-    0xf2e9, 0x308c, 0xf2e9, 0x308c,
-    0xf29f, 0xc0e0, 0xf29f, 0xc0e0,
-    0xf256, 0xe767, 0xf256, 0xe767,
-    0xf20e, 0xa754, 0xf20e, 0xa754,
-    0xf1c7, 0x03d2, 0xf1c7, 0x03d2,
-    0xf180, 0x0006, 0xf180, 0x0006,
-    0xf139, 0x9f0d, 0xf139, 0x9f0d,
-    0xf0f3, 0xe3fd, 0xf0f3, 0xe3fd,
-    0xf0ae, 0xd1e5, 0xf0ae, 0xd1e5,
-    0xf06a, 0x6bce, 0xf06a, 0x6bce,
-    0xf026, 0xb4b6, 0xf026, 0xb4b6,
-    0xefe3, 0xaf97, 0xefe3, 0xaf97,
-    0xefa1, 0x5f60, 0xefa1, 0x5f60,
-    0xef5f, 0xc6fc, 0xef5f, 0xc6fc,
-    0xef1e, 0xe949, 0xef1e, 0xe949,
-    0xeede, 0xc922, 0xeede, 0xc922,
-    0xee9f, 0x6954, 0xee9f, 0x6954,
-    0xee60, 0xcca9, 0xee60, 0xcca9,
-    0xee22, 0xf5e0, 0xee22, 0xf5e0,
-    0xede5, 0xe7af, 0xede5, 0xe7af,
-    0xeda9, 0xa4c3, 0xeda9, 0xa4c3,
-    0xed6e, 0x2fc0, 0xed6e, 0x2fc0,
-    0xed33, 0x8b44, 0xed33, 0x8b44,
-    0xecf9, 0xb9e1, 0xecf9, 0xb9e1,
-    0xecc0, 0xbe1e, 0xecc0, 0xbe1e,
-    0xec88, 0x9a7d, 0xec88, 0x9a7d,
-    0xec51, 0x5174, 0xec51, 0x5174,
-    0xec1a, 0xe570, 0xec1a, 0xe570,
-    0xebe5, 0x58d3, 0xebe5, 0x58d3,
-    0xebb0, 0xadf8, 0xebb0, 0xadf8,
-    0xeb7c, 0xe72c, 0xeb7c, 0xe72c,
-    0xeb4a, 0x06b7, 0xeb4a, 0x06b7,
-    0xeb18, 0x0ed3, 0xeb18, 0x0ed3,
-    0xeae7, 0x01b2, 0xeae7, 0x01b2,
-    0xeab6, 0xe179, 0xeab6, 0xe179,
-    0xea87, 0xb046, 0xea87, 0xb046,
-    0xea59, 0x702b, 0xea59, 0x702b,
-    0xea2c, 0x232f, 0xea2c, 0x232f,
-    0xe9ff, 0xcb4d, 0xe9ff, 0xcb4d,
-    0xe9d4, 0x6a7a, 0xe9d4, 0x6a7a,
-    0xe9aa, 0x029b, 0xe9aa, 0x029b,
-    0xe980, 0x958d, 0xe980, 0x958d,
-    0xe958, 0x2521, 0xe958, 0x2521,
-    0xe930, 0xb31c, 0xe930, 0xb31c,
-    0xe90a, 0x413b, 0xe90a, 0x413b,
-    0xe8e4, 0xd12d, 0xe8e4, 0xd12d,
-    0xe8c0, 0x6495, 0xe8c0, 0x6495,
-    0xe89c, 0xfd0e, 0xe89c, 0xfd0e,
-    0xe87a, 0x9c25, 0xe87a, 0x9c25,
-    0xe859, 0x435b, 0xe859, 0x435b,
-    0xe838, 0xf427, 0xe838, 0xf427,
-    0xe819, 0xaff5, 0xe819, 0xaff5,
-    0xe7fb, 0x7822, 0xe7fb, 0x7822,
-    0xe7de, 0x4e03, 0xe7de, 0x4e03,
-    0xe7c2, 0x32df, 0xe7c2, 0x32df,
-    0xe7a7, 0x27f1, 0xe7a7, 0x27f1,
-    0xe78d, 0x2e6a, 0xe78d, 0x2e6a,
-    0xe774, 0x476c, 0xe774, 0x476c,
-    0xe75c, 0x7410, 0xe75c, 0x7410,
-    0xe745, 0xb561, 0xe745, 0xb561,
-    0xe730, 0x0c5e, 0xe730, 0x0c5e,
-    0xe71b, 0x79fc, 0xe71b, 0x79fc,
-    0xe707, 0xff1f, 0xe707, 0xff1f,
-    0xe6f5, 0x9ca5, 0xe6f5, 0x9ca5,
-    0xe6e4, 0x535a, 0xe6e4, 0x535a,
-    0xe6d4, 0x2401, 0xe6d4, 0x2401,
-    0xe6c5, 0x0f50, 0xe6c5, 0x0f50,
-    0xe6b7, 0x15f0, 0xe6b7, 0x15f0,
-    0xe6aa, 0x387e, 0xe6aa, 0x387e,
-    0xe69e, 0x778b, 0xe69e, 0x778b,
-    0xe693, 0xd39a, 0xe693, 0xd39a,
-    0xe68a, 0x4d23, 0xe68a, 0x4d23,
-    0xe681, 0xe491, 0xe681, 0xe491,
-    0xe67a, 0x9a42, 0xe67a, 0x9a42,
-    0xe674, 0x6e88, 0xe674, 0x6e88,
-    0xe66f, 0x61a9, 0xe66f, 0x61a9,
-    0xe66b, 0x73dd, 0xe66b, 0x73dd,
-    0xe668, 0xa551, 0xe668, 0xa551,
-    0xe666, 0xf623, 0xe666, 0xf623,
-    0xe666, 0x6667, 0xe666, 0x6667,
-    0xe666, 0xf623, 0xe666, 0xf623,
-    0xe668, 0xa551, 0xe668, 0xa551,
-    0xe66b, 0x73dd, 0xe66b, 0x73dd,
-    0xe66f, 0x61a9, 0xe66f, 0x61a9,
-    0xe674, 0x6e88, 0xe674, 0x6e88,
-    0xe67a, 0x9a42, 0xe67a, 0x9a42,
-    0xe681, 0xe491, 0xe681, 0xe491,
-    0xe68a, 0x4d23, 0xe68a, 0x4d23,
-    0xe693, 0xd39a, 0xe693, 0xd39a,
-    0xe69e, 0x778b, 0xe69e, 0x778b,
-    0xe6aa, 0x387e, 0xe6aa, 0x387e,
-    0xe6b7, 0x15f0, 0xe6b7, 0x15f0,
-    0xe6c5, 0x0f50, 0xe6c5, 0x0f50,
-    0xe6d4, 0x2401, 0xe6d4, 0x2401,
-    0xe6e4, 0x535a, 0xe6e4, 0x535a,
-    0xe6f5, 0x9ca5, 0xe6f5, 0x9ca5,
-    0xe707, 0xff1f, 0xe707, 0xff1f,
-    0xe71b, 0x79fc, 0xe71b, 0x79fc,
-    0xe730, 0x0c5e, 0xe730, 0x0c5e,
-    0xe745, 0xb561, 0xe745, 0xb561,
-    0xe75c, 0x7410, 0xe75c, 0x7410,
-    0xe774, 0x476c, 0xe774, 0x476c,
-    0xe78d, 0x2e6a, 0xe78d, 0x2e6a,
-    0xe7a7, 0x27f1, 0xe7a7, 0x27f1,
-    0xe7c2, 0x32df, 0xe7c2, 0x32df,
-    0xe7de, 0x4e03, 0xe7de, 0x4e03,
-    0xe7fb, 0x7822, 0xe7fb, 0x7822,
-    0xe819, 0xaff5, 0xe819, 0xaff5,
-    0xe838, 0xf427, 0xe838, 0xf427,
-    0xe859, 0x435b, 0xe859, 0x435b,
-    0xe87a, 0x9c25, 0xe87a, 0x9c25,
-    0xe89c, 0xfd0e, 0xe89c, 0xfd0e,
-    0xe8c0, 0x6495, 0xe8c0, 0x6495,
-    0xe8e4, 0xd12d, 0xe8e4, 0xd12d,
-    0xe90a, 0x413b, 0xe90a, 0x413b,
-    0xe930, 0xb31c, 0xe930, 0xb31c,
-    0xe958, 0x2521, 0xe958, 0x2521,
-    0xe980, 0x958d, 0xe980, 0x958d,
-    0xe9aa, 0x029b, 0xe9aa, 0x029b,
-    0xe9d4, 0x6a7a, 0xe9d4, 0x6a7a,
-    0xe9ff, 0xcb4d, 0xe9ff, 0xcb4d,
-    0xea2c, 0x232f, 0xea2c, 0x232f,
-    0xea59, 0x702b, 0xea59, 0x702b,
-    0xea87, 0xb046, 0xea87, 0xb046,
-    0xeab6, 0xe179, 0xeab6, 0xe179,
-    0xeae7, 0x01b2, 0xeae7, 0x01b2,
-    0xeb18, 0x0ed3, 0xeb18, 0x0ed3,
-    0xeb4a, 0x06b7, 0xeb4a, 0x06b7,
-    0xeb7c, 0xe72c, 0xeb7c, 0xe72c,
-    0xebb0, 0xadf8, 0xebb0, 0xadf8,
-    0xebe5, 0x58d3, 0xebe5, 0x58d3,
-    0xec1a, 0xe570, 0xec1a, 0xe570,
-    0xec51, 0x5174, 0xec51, 0x5174,
-    0xec88, 0x9a7d, 0xec88, 0x9a7d,
-    0xecc0, 0xbe1e, 0xecc0, 0xbe1e,
-    0xecf9, 0xb9e1, 0xecf9, 0xb9e1,
-    0xed33, 0x8b44, 0xed33, 0x8b44,
-    0xed6e, 0x2fc0, 0xed6e, 0x2fc0,
-    0xeda9, 0xa4c3, 0xeda9, 0xa4c3,
-    0xede5, 0xe7af, 0xede5, 0xe7af,
-    0xee22, 0xf5e0, 0xee22, 0xf5e0,
-    0xee60, 0xcca9, 0xee60, 0xcca9,
-    0xee9f, 0x6954, 0xee9f, 0x6954,
-    0xeede, 0xc922, 0xeede, 0xc922,
-    0xef1e, 0xe949, 0xef1e, 0xe949,
-    0xef5f, 0xc6fc, 0xef5f, 0xc6fc,
-    0xefa1, 0x5f60, 0xefa1, 0x5f60,
-    0xefe3, 0xaf97, 0xefe3, 0xaf97,
-    0xf026, 0xb4b6, 0xf026, 0xb4b6,
-    0xf06a, 0x6bce, 0xf06a, 0x6bce,
-    0xf0ae, 0xd1e5, 0xf0ae, 0xd1e5,
-    0xf0f3, 0xe3fd, 0xf0f3, 0xe3fd,
-    0xf139, 0x9f0d, 0xf139, 0x9f0d,
-    0xf180, 0x0006, 0xf180, 0x0006,
-    0xf1c7, 0x03d2, 0xf1c7, 0x03d2,
-    0xf20e, 0xa754, 0xf20e, 0xa754,
-    0xf256, 0xe767, 0xf256, 0xe767,
-    0xf29f, 0xc0e0, 0xf29f, 0xc0e0,
-    0xf2e9, 0x308c, 0xf2e9, 0x308c,
-    0xf333, 0x3334, 0xf333, 0x3334,
-    0xf37d, 0xc597, 0xf37d, 0xc597,
-    0xf3c8, 0xe472, 0xf3c8, 0xe472,
-    0xf414, 0x8c77, 0xf414, 0x8c77,
-    0xf460, 0xba55, 0xf460, 0xba55,
-    0xf4ad, 0x6ab7, 0xf4ad, 0x6ab7,
-    0xf4fa, 0x9a3c, 0xf4fa, 0x9a3c,
-    0xf548, 0x4584, 0xf548, 0x4584,
-    0xf596, 0x6927, 0xf596, 0x6927,
-    0xf5e5, 0x01b5, 0xf5e5, 0x01b5,
-    0xf634, 0x0bbe, 0xf634, 0x0bbe,
-    0xf683, 0x83c9, 0xf683, 0x83c9,
-    0xf6d3, 0x665a, 0xf6d3, 0x665a,
-    0xf723, 0xaff0, 0xf723, 0xaff0,
-    0xf774, 0x5d06, 0xf774, 0x5d06,
-    0xf7c5, 0x6a12, 0xf7c5, 0x6a12,
-    0xf816, 0xd384, 0xf816, 0xd384,
-    0xf868, 0x95cc, 0xf868, 0x95cc,
-    0xf8ba, 0xad53, 0xf8ba, 0xad53,
-    0xf90d, 0x167f, 0xf90d, 0x167f,
-    0xf95f, 0xcdb3, 0xf95f, 0xcdb3,
-    0xf9b2, 0xcf4e, 0xf9b2, 0xcf4e,
-    0xfa06, 0x17ac, 0xfa06, 0x17ac,
-    0xfa59, 0xa326, 0xfa59, 0xa326,
-    0xfaad, 0x6e11, 0xfaad, 0x6e11,
-    0xfb01, 0x74c1, 0xfb01, 0x74c1,
-    0xfb55, 0xb386, 0xfb55, 0xb386,
-    0xfbaa, 0x26ae, 0xfbaa, 0x26ae,
-    0xfbfe, 0xca85, 0xfbfe, 0xca85,
-    0xfc53, 0x9b55, 0xfc53, 0x9b55,
-    0xfca8, 0x9564, 0xfca8, 0x9564,
-    0xfcfd, 0xb4f9, 0xfcfd, 0xb4f9,
-    0xfd52, 0xf657, 0xfd52, 0xf657,
-    0xfda8, 0x55c2, 0xfda8, 0x55c2,
-    0xfdfd, 0xcf7b, 0xfdfd, 0xcf7b,
-    0xfe53, 0x5fc2, 0xfe53, 0x5fc2,
-    0xfea9, 0x02d7, 0xfea9, 0x02d7,
-    0xfefe, 0xb4f6, 0xfefe, 0xb4f6,
-    0xff54, 0x725f, 0xff54, 0x725f,
-    0xffaa, 0x374e, 0xffaa, 0x374e,
-};
-
-/**
- * Table of PCM samples for single period of stereo / 100Hz sine / -20dBFs / 16-bit
- *
- * Table uses type of uint16_t, so 16-bit samples are directly implemented.  Total length of table is
- * PCM_1KHZ_SINGLE_PERIOD_LENGTH per channel, thus * 2 for stereo.  16-bit words are arranged Left
- * channel first:
- * - Left channel Sample 1
- * - Right channel Sample 1
- * - eft channel Sample 2
- * - ...
- *
- */
-const uint16_t pcm_20dBFs_100Hz_16bit_stereo_single_period[] =
-{
-    0x0000, 0x0000,
-    0x0055, 0x0055,
-    0x00ab, 0x00ab,
-    0x0101, 0x0101,
-    0x0156, 0x0156,
-    0x01ac, 0x01ac,
-    0x0202, 0x0202,
-    0x0257, 0x0257,
-    0x02ad, 0x02ad,
-    0x0302, 0x0302,
-    0x0357, 0x0357,
-    0x03ac, 0x03ac,
-    0x0401, 0x0401,
-    0x0455, 0x0455,
-    0x04aa, 0x04aa,
-    0x04fe, 0x04fe,
-    0x0552, 0x0552,
-    0x05a6, 0x05a6,
-    0x05f9, 0x05f9,
-    0x064d, 0x064d,
-    0x06a0, 0x06a0,
-    0x06f2, 0x06f2,
-    0x0745, 0x0745,
-    0x0797, 0x0797,
-    0x07e9, 0x07e9,
-    0x083a, 0x083a,
-    0x088b, 0x088b,
-    0x08dc, 0x08dc,
-    0x092c, 0x092c,
-    0x097c, 0x097c,
-    0x09cb, 0x09cb,
-    0x0a1a, 0x0a1a,
-    0x0a69, 0x0a69,
-    0x0ab7, 0x0ab7,
-    0x0b05, 0x0b05,
-    0x0b52, 0x0b52,
-    0x0b9f, 0x0b9f,
-    0x0beb, 0x0beb,
-    0x0c37, 0x0c37,
-    0x0c82, 0x0c82,
-    0x0ccc, 0x0ccc,
-    0x0d16, 0x0d16,
-    0x0d60, 0x0d60,
-    0x0da9, 0x0da9,
-    0x0df1, 0x0df1,
-    0x0e38, 0x0e38,
-    0x0e7f, 0x0e7f,
-    0x0ec6, 0x0ec6,
-    0x0f0c, 0x0f0c,
-    0x0f51, 0x0f51,
-    0x0f95, 0x0f95,
-    0x0fd9, 0x0fd9,
-    0x101c, 0x101c,
-    0x105e, 0x105e,
-    0x10a0, 0x10a0,
-    0x10e1, 0x10e1,
-    0x1121, 0x1121,
-    0x1160, 0x1160,
-    0x119f, 0x119f,
-    0x11dd, 0x11dd,
-    0x121a, 0x121a,
-    0x1256, 0x1256,
-    0x1291, 0x1291,
-    0x12cc, 0x12cc,
-    0x1306, 0x1306,
-    0x133f, 0x133f,
-    0x1377, 0x1377,
-    0x13ae, 0x13ae,
-    0x13e5, 0x13e5,
-    0x141a, 0x141a,
-    0x144f, 0x144f,
-    0x1483, 0x1483,
-    0x14b5, 0x14b5,
-    0x14e7, 0x14e7,
-    0x1518, 0x1518,
-    0x1549, 0x1549,
-    0x1578, 0x1578,
-    0x15a6, 0x15a6,
-    0x15d3, 0x15d3,
-    0x1600, 0x1600,
-    0x162b, 0x162b,
-    0x1655, 0x1655,
-    0x167f, 0x167f,
-    0x16a7, 0x16a7,
-    0x16cf, 0x16cf,
-    0x16f5, 0x16f5,
-    0x171b, 0x171b,
-    0x173f, 0x173f,
-    0x1763, 0x1763,
-    0x1785, 0x1785,
-    0x17a6, 0x17a6,
-    0x17c7, 0x17c7,
-    0x17e6, 0x17e6,
-    0x1804, 0x1804,
-    0x1821, 0x1821,
-    0x183d, 0x183d,
-    0x1858, 0x1858,
-    0x1872, 0x1872,
-    0x188b, 0x188b,
-    0x18a3, 0x18a3,
-    0x18ba, 0x18ba,
-    0x18cf, 0x18cf,
-    0x18e4, 0x18e4,
-    0x18f8, 0x18f8,
-    0x190a, 0x190a,
-    0x191b, 0x191b,
-    0x192b, 0x192b,
-    0x193a, 0x193a,
-    0x1948, 0x1948,
-    0x1955, 0x1955,
-    0x1961, 0x1961,
-    0x196c, 0x196c,
-    0x1975, 0x1975,
-    0x197e, 0x197e,
-    0x1985, 0x1985,
-    0x198b, 0x198b,
-    0x1990, 0x1990,
-    0x1994, 0x1994,
-    0x1997, 0x1997,
-    0x1999, 0x1999,
-    0x1999, 0x1999,
-    0x1999, 0x1999,
-    0x1997, 0x1997,
-    0x1994, 0x1994,
-    0x1990, 0x1990,
-    0x198b, 0x198b,
-    0x1985, 0x1985,
-    0x197e, 0x197e,
-    0x1975, 0x1975,
-    0x196c, 0x196c,
-    0x1961, 0x1961,
-    0x1955, 0x1955,
-    0x1948, 0x1948,
-    0x193a, 0x193a,
-    0x192b, 0x192b,
-    0x191b, 0x191b,
-    0x190a, 0x190a,
-    0x18f8, 0x18f8,
-    0x18e4, 0x18e4,
-    0x18cf, 0x18cf,
-    0x18ba, 0x18ba,
-    0x18a3, 0x18a3,
-    0x188b, 0x188b,
-    0x1872, 0x1872,
-    0x1858, 0x1858,
-    0x183d, 0x183d,
-    0x1821, 0x1821,
-    0x1804, 0x1804,
-    0x17e6, 0x17e6,
-    0x17c7, 0x17c7,
-    0x17a6, 0x17a6,
-    0x1785, 0x1785,
-    0x1763, 0x1763,
-    0x173f, 0x173f,
-    0x171b, 0x171b,
-    0x16f5, 0x16f5,
-    0x16cf, 0x16cf,
-    0x16a7, 0x16a7,
-    0x167f, 0x167f,
-    0x1655, 0x1655,
-    0x162b, 0x162b,
-    0x1600, 0x1600,
-    0x15d3, 0x15d3,
-    0x15a6, 0x15a6,
-    0x1578, 0x1578,
-    0x1549, 0x1549,
-    0x1518, 0x1518,
-    0x14e7, 0x14e7,
-    0x14b5, 0x14b5,
-    0x1483, 0x1483,
-    0x144f, 0x144f,
-    0x141a, 0x141a,
-    0x13e5, 0x13e5,
-    0x13ae, 0x13ae,
-    0x1377, 0x1377,
-    0x133f, 0x133f,
-    0x1306, 0x1306,
-    0x12cc, 0x12cc,
-    0x1291, 0x1291,
-    0x1256, 0x1256,
-    0x121a, 0x121a,
-    0x11dd, 0x11dd,
-    0x119f, 0x119f,
-    0x1160, 0x1160,
-    0x1121, 0x1121,
-    0x10e1, 0x10e1,
-    0x10a0, 0x10a0,
-    0x105e, 0x105e,
-    0x101c, 0x101c,
-    0x0fd9, 0x0fd9,
-    0x0f95, 0x0f95,
-    0x0f51, 0x0f51,
-    0x0f0c, 0x0f0c,
-    0x0ec6, 0x0ec6,
-    0x0e7f, 0x0e7f,
-    0x0e38, 0x0e38,
-    0x0df1, 0x0df1,
-    0x0da9, 0x0da9,
-    0x0d60, 0x0d60,
-    0x0d16, 0x0d16,
-    0x0ccc, 0x0ccc,
-    0x0c82, 0x0c82,
-    0x0c37, 0x0c37,
-    0x0beb, 0x0beb,
-    0x0b9f, 0x0b9f,
-    0x0b52, 0x0b52,
-    0x0b05, 0x0b05,
-    0x0ab7, 0x0ab7,
-    0x0a69, 0x0a69,
-    0x0a1a, 0x0a1a,
-    0x09cb, 0x09cb,
-    0x097c, 0x097c,
-    0x092c, 0x092c,
-    0x08dc, 0x08dc,
-    0x088b, 0x088b,
-    0x083a, 0x083a,
-    0x07e9, 0x07e9,
-    0x0797, 0x0797,
-    0x0745, 0x0745,
-    0x06f2, 0x06f2,
-    0x06a0, 0x06a0,
-    0x064d, 0x064d,
-    0x05f9, 0x05f9,
-    0x05a6, 0x05a6,
-    0x0552, 0x0552,
-    0x04fe, 0x04fe,
-    0x04aa, 0x04aa,
-    0x0455, 0x0455,
-    0x0401, 0x0401,
-    0x03ac, 0x03ac,
-    0x0357, 0x0357,
-    0x0302, 0x0302,
-    0x02ad, 0x02ad,
-    0x0257, 0x0257,
-    0x0202, 0x0202,
-    0x01ac, 0x01ac,
-    0x0156, 0x0156,
-    0x0101, 0x0101,
-    0x00ab, 0x00ab,
-    0x0055, 0x0055,
-    0x0000, 0x0000,
-    0xffaa, 0xffaa,
-    0xff54, 0xff54,
-    0xfefe, 0xfefe,
-    0xfea9, 0xfea9,
-    0xfe53, 0xfe53,
-    0xfdfd, 0xfdfd,
-    0xfda8, 0xfda8,
-    0xfd52, 0xfd52,
-    0xfcfd, 0xfcfd,
-    0xfca8, 0xfca8,
-    0xfc53, 0xfc53,
-    0xfbfe, 0xfbfe,
-    0xfbaa, 0xfbaa,
-    0xfb55, 0xfb55,
-    0xfb01, 0xfb01,
-    0xfaad, 0xfaad,
-    0xfa59, 0xfa59,
-    0xfa06, 0xfa06,
-    0xf9b2, 0xf9b2,
-    0xf95f, 0xf95f,
-    0xf90d, 0xf90d,
-    0xf8ba, 0xf8ba,
-    0xf868, 0xf868,
-    0xf816, 0xf816,
-    0xf7c5, 0xf7c5,
-    0xf774, 0xf774,
-    0xf723, 0xf723,
-    0xf6d3, 0xf6d3,
-    0xf683, 0xf683,
-    0xf634, 0xf634,
-    0xf5e5, 0xf5e5,
-    0xf596, 0xf596,
-    0xf548, 0xf548,
-    0xf4fa, 0xf4fa,
-    0xf4ad, 0xf4ad,
-    0xf460, 0xf460,
-    0xf414, 0xf414,
-    0xf3c8, 0xf3c8,
-    0xf37d, 0xf37d,
-    0xf333, 0xf333,
-    0xf2e9, 0xf2e9,
-    0xf29f, 0xf29f,
-    0xf256, 0xf256,
-    0xf20e, 0xf20e,
-    0xf1c7, 0xf1c7,
-    0xf180, 0xf180,
-    0xf139, 0xf139,
-    0xf0f3, 0xf0f3,
-    0xf0ae, 0xf0ae,
-    0xf06a, 0xf06a,
-    0xf026, 0xf026,
-    0xefe3, 0xefe3,
-    0xefa1, 0xefa1,
-    0xef5f, 0xef5f,
-    0xef1e, 0xef1e,
-    0xeede, 0xeede,
-    0xee9f, 0xee9f,
-    0xee60, 0xee60,
-    0xee22, 0xee22,
-    0xede5, 0xede5,
-    0xeda9, 0xeda9,
-    0xed6e, 0xed6e,
-    0xed33, 0xed33,
-    0xecf9, 0xecf9,
-    0xecc0, 0xecc0,
-    0xec88, 0xec88,
-    0xec51, 0xec51,
-    0xec1a, 0xec1a,
-    0xebe5, 0xebe5,
-    0xebb0, 0xebb0,
-    0xeb7c, 0xeb7c,
-    0xeb4a, 0xeb4a,
-    0xeb18, 0xeb18,
-    0xeae7, 0xeae7,
-    0xeab6, 0xeab6,
-    0xea87, 0xea87,
-    0xea59, 0xea59,
-    0xea2c, 0xea2c,
-    0xe9ff, 0xe9ff,
-    0xe9d4, 0xe9d4,
-    0xe9aa, 0xe9aa,
-    0xe980, 0xe980,
-    0xe958, 0xe958,
-    0xe930, 0xe930,
-    0xe90a, 0xe90a,
-    0xe8e4, 0xe8e4,
-    0xe8c0, 0xe8c0,
-    0xe89c, 0xe89c,
-    0xe87a, 0xe87a,
-    0xe859, 0xe859,
-    0xe838, 0xe838,
-    0xe819, 0xe819,
-    0xe7fb, 0xe7fb,
-    0xe7de, 0xe7de,
-    0xe7c2, 0xe7c2,
-    0xe7a7, 0xe7a7,
-    0xe78d, 0xe78d,
-    0xe774, 0xe774,
-    0xe75c, 0xe75c,
-    0xe745, 0xe745,
-    0xe730, 0xe730,
-    0xe71b, 0xe71b,
-    0xe707, 0xe707,
-    0xe6f5, 0xe6f5,
-    0xe6e4, 0xe6e4,
-    0xe6d4, 0xe6d4,
-    0xe6c5, 0xe6c5,
-    0xe6b7, 0xe6b7,
-    0xe6aa, 0xe6aa,
-    0xe69e, 0xe69e,
-    0xe693, 0xe693,
-    0xe68a, 0xe68a,
-    0xe681, 0xe681,
-    0xe67a, 0xe67a,
-    0xe674, 0xe674,
-    0xe66f, 0xe66f,
-    0xe66b, 0xe66b,
-    0xe668, 0xe668,
-    0xe666, 0xe666,
-    0xe666, 0xe666,
-    0xe666, 0xe666,
-    0xe668, 0xe668,
-    0xe66b, 0xe66b,
-    0xe66f, 0xe66f,
-    0xe674, 0xe674,
-    0xe67a, 0xe67a,
-    0xe681, 0xe681,
-    0xe68a, 0xe68a,
-    0xe693, 0xe693,
-    0xe69e, 0xe69e,
-    0xe6aa, 0xe6aa,
-    0xe6b7, 0xe6b7,
-    0xe6c5, 0xe6c5,
-    0xe6d4, 0xe6d4,
-    0xe6e4, 0xe6e4,
-    0xe6f5, 0xe6f5,
-    0xe707, 0xe707,
-    0xe71b, 0xe71b,
-    0xe730, 0xe730,
-    0xe745, 0xe745,
-    0xe75c, 0xe75c,
-    0xe774, 0xe774,
-    0xe78d, 0xe78d,
-    0xe7a7, 0xe7a7,
-    0xe7c2, 0xe7c2,
-    0xe7de, 0xe7de,
-    0xe7fb, 0xe7fb,
-    0xe819, 0xe819,
-    0xe838, 0xe838,
-    0xe859, 0xe859,
-    0xe87a, 0xe87a,
-    0xe89c, 0xe89c,
-    0xe8c0, 0xe8c0,
-    0xe8e4, 0xe8e4,
-    0xe90a, 0xe90a,
-    0xe930, 0xe930,
-    0xe958, 0xe958,
-    0xe980, 0xe980,
-    0xe9aa, 0xe9aa,
-    0xe9d4, 0xe9d4,
-    0xe9ff, 0xe9ff,
-    0xea2c, 0xea2c,
-    0xea59, 0xea59,
-    0xea87, 0xea87,
-    0xeab6, 0xeab6,
-    0xeae7, 0xeae7,
-    0xeb18, 0xeb18,
-    0xeb4a, 0xeb4a,
-    0xeb7c, 0xeb7c,
-    0xebb0, 0xebb0,
-    0xebe5, 0xebe5,
-    0xec1a, 0xec1a,
-    0xec51, 0xec51,
-    0xec88, 0xec88,
-    0xecc0, 0xecc0,
-    0xecf9, 0xecf9,
-    0xed33, 0xed33,
-    0xed6e, 0xed6e,
-    0xeda9, 0xeda9,
-    0xede5, 0xede5,
-    0xee22, 0xee22,
-    0xee60, 0xee60,
-    0xee9f, 0xee9f,
-    0xeede, 0xeede,
-    0xef1e, 0xef1e,
-    0xef5f, 0xef5f,
-    0xefa1, 0xefa1,
-    0xefe3, 0xefe3,
-    0xf026, 0xf026,
-    0xf06a, 0xf06a,
-    0xf0ae, 0xf0ae,
-    0xf0f3, 0xf0f3,
-    0xf139, 0xf139,
-    0xf180, 0xf180,
-    0xf1c7, 0xf1c7,
-    0xf20e, 0xf20e,
-    0xf256, 0xf256,
-    0xf29f, 0xf29f,
-    0xf2e9, 0xf2e9,
-    0xf333, 0xf333,
-    0xf37d, 0xf37d,
-    0xf3c8, 0xf3c8,
-    0xf414, 0xf414,
-    0xf460, 0xf460,
-    0xf4ad, 0xf4ad,
-    0xf4fa, 0xf4fa,
-    0xf548, 0xf548,
-    0xf596, 0xf596,
-    0xf5e5, 0xf5e5,
-    0xf634, 0xf634,
-    0xf683, 0xf683,
-    0xf6d3, 0xf6d3,
-    0xf723, 0xf723,
-    0xf774, 0xf774,
-    0xf7c5, 0xf7c5,
-    0xf816, 0xf816,
-    0xf868, 0xf868,
-    0xf8ba, 0xf8ba,
-    0xf90d, 0xf90d,
-    0xf95f, 0xf95f,
-    0xf9b2, 0xf9b2,
-    0xfa06, 0xfa06,
-    0xfa59, 0xfa59,
-    0xfaad, 0xfaad,
-    0xfb01, 0xfb01,
-    0xfb55, 0xfb55,
-    0xfbaa, 0xfbaa,
-    0xfbfe, 0xfbfe,
-    0xfc53, 0xfc53,
-    0xfca8, 0xfca8,
-    0xfcfd, 0xfcfd,
-    0xfd52, 0xfd52,
-    0xfda8, 0xfda8,
-    0xfdfd, 0xfdfd,
-    0xfe53, 0xfe53,
-    0xfea9, 0xfea9,
-    0xfefe, 0xfefe,
-    0xff54, 0xff54,
-    0xffaa, 0xffaa,
-};
-#endif // TEST_TONES_INCLUDE_100HZ
-
-/**
- * Table of PCM samples for single period of stereo / 1kHz sine / -20dBFs / 32-bit / 8khz sample rate
- *
- * Table uses type of uint16_t, so 32-bit samples are broken into 16-bit words.  Total length of table is
- * PCM_1KTONE_8kHz_SINGLE_PERIOD_LENGTH_2BYTES per channel, thus * 2 for stereo.  16-bit words are arranged MS-Word of Left
- * channel first:
- * - MS-Word of Left channel Sample 1
- * - LS-Word of Left channel Sample 1
- * - MS-Word of Right channel Sample 1
- * - LS-Word of Right channel Sample 1
- * - MS-Word of Left channel Sample 2
- * - ...
- *
- */
-const uint16_t pcm_20dBFs_1kHz_32bit_8000_stereo_single_period[PCM_1KTONE_8kHz_SINGLE_PERIOD_LENGTH_2BYTES * 2] =
-{
-  0x0000, 0x0000, 0x0000, 0x0000,
-  0x090d, 0x0c28, 0x090d, 0x0c28,
-  0x0ccc, 0xcccc, 0x0ccc, 0xcccc,
-  0x090d, 0x0c28, 0x090d, 0x0c28,
-  0x0000, 0x0000, 0x0000, 0x0000,
-  0xf6f2, 0xf3d8, 0xf6f2, 0xf3d8,
-  0xf333, 0x3334, 0xf333, 0x3334,
-  0xf6f2, 0xf3d8, 0xf6f2, 0xf3d8
-};
-
-/**
- * Table of PCM samples for single period of stereo / 1kHz sine / -20dBFs / 16-bit / 8khz sample rate
- *
- */
-const uint16_t pcm_20dBFs_1kHz_16bit_8000_stereo_single_period[PCM_1KTONE_8kHz_SINGLE_PERIOD_LENGTH_2BYTES] =
-{
-  0x0000, 0x0000,
-  0x090e, 0x090d,
-  0x0ccc, 0x0ccc,
-  0x090d, 0x090d,
-  0x0001, 0x0000,
-  0xf6f3, 0xf6f3,
-  0xf333, 0xf333,
-  0xf6f3, 0xf6f2
-};
-/*****************************************************************************
-* Function Definitions
-*****************************************************************************/
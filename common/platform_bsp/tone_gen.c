@@ -0,0 +1,367 @@
+/**
+ * @file tone_gen.c
+ *
+ * @brief Fixed-point test tone generator for Render path Test Tone
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2022 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stddef.h>
+#include <stdbool.h>
+#include <math.h>
+#include "tone_gen.h"
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+/***********************************************************************************************************************
+ * LOCAL LITERAL SUBSTITUTIONS
+ **********************************************************************************************************************/
+#define TONE_GEN_SIN_TABLE_BITS             (7)     ///< Quarter period of sine is split into 2^7 segments
+#define TONE_GEN_SIN_FRAC_BITS              (30 - TONE_GEN_SIN_TABLE_BITS)  ///< Phase bits interpolated in a segment
+#define TONE_GEN_SWEEP_BLOCK_SAMPLES        (32)    ///< Samples between exact sweep frequency updates
+
+/***********************************************************************************************************************
+ * LOCAL VARIABLES
+ **********************************************************************************************************************/
+/**
+ * Quarter period of sine, sin(pi / 2 * i / 128) in Q31 for i = 0 to 128
+ *
+ * Linear interpolation between entries keeps the error below -94dBFS, in 516 bytes of flash.
+ *
+ */
+static const int32_t tone_gen_sin_table[(1 << TONE_GEN_SIN_TABLE_BITS) + 1] =
+{
+    0x00000000, 0x01921D20, 0x03242ABF, 0x04B6195D, 0x0647D97C, 0x07D95B9E,
+    0x096A9049, 0x0AFB6805, 0x0C8BD35E, 0x0E1BC2E4, 0x0FAB272B, 0x1139F0CF,
+    0x12C8106F, 0x145576B1, 0x15E21445, 0x176DD9DE, 0x18F8B83C, 0x1A82A026,
+    0x1C0B826A, 0x1D934FE5, 0x1F19F97B, 0x209F701C, 0x2223A4C5, 0x23A6887F,
+    0x25280C5E, 0x26A82186, 0x2826B928, 0x29A3C485, 0x2B1F34EB, 0x2C98FBBA,
+    0x2E110A62, 0x2F875262, 0x30FBC54D, 0x326E54C7, 0x33DEF287, 0x354D9057,
+    0x36BA2014, 0x382493B0, 0x398CDD32, 0x3AF2EEB7, 0x3C56BA70, 0x3DB832A6,
+    0x3F1749B8, 0x4073F21D, 0x41CE1E65, 0x4325C135, 0x447ACD50, 0x45CD358F,
+    0x471CECE7, 0x4869E665, 0x49B41533, 0x4AFB6C98, 0x4C3FDFF4, 0x4D8162C4,
+    0x4EBFE8A5, 0x4FFB654D, 0x5133CC94, 0x5269126E, 0x539B2AF0, 0x54CA0A4B,
+    0x55F5A4D2, 0x571DEEFA, 0x5842DD54, 0x59646498, 0x5A82799A, 0x5B9D1154,
+    0x5CB420E0, 0x5DC79D7C, 0x5ED77C8A, 0x5FE3B38D, 0x60EC3830, 0x61F1003F,
+    0x62F201AC, 0x63EF3290, 0x64E88926, 0x65DDFBD3, 0x66CF8120, 0x67BD0FBD,
+    0x68A69E81, 0x698C246C, 0x6A6D98A4, 0x6B4AF279, 0x6C242960, 0x6CF934FC,
+    0x6DCA0D14, 0x6E96A99D, 0x6F5F02B2, 0x7023109A, 0x70E2CBC6, 0x719E2CD2,
+    0x72552C85, 0x7307C3D0, 0x73B5EBD1, 0x745F9DD1, 0x7504D345, 0x75A585CF,
+    0x7641AF3D, 0x76D94989, 0x776C4EDB, 0x77FAB989, 0x78848414, 0x7909A92D,
+    0x798A23B1, 0x7A05EEAD, 0x7A7D055B, 0x7AEF6323, 0x7B5D039E, 0x7BC5E290,
+    0x7C29FBEE, 0x7C894BDE, 0x7CE3CEB2, 0x7D3980EC, 0x7D8A5F40, 0x7DD6668F,
+    0x7E1D93EA, 0x7E5FE493, 0x7E9D55FC, 0x7ED5E5C6, 0x7F0991C4, 0x7F3857F6,
+    0x7F62368F, 0x7F872BF3, 0x7FA736B4, 0x7FC25596, 0x7FD8878E, 0x7FE9CBC0,
+    0x7FF62182, 0x7FFD885A, 0x7FFFFFFF,
+};
+
+/***********************************************************************************************************************
+ * LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+/**
+ * Saturating add of Q31 samples
+ *
+ * Uses the single-cycle QADD instruction where the core has the DSP extension.
+ *
+ */
+static inline int32_t tone_gen_qadd(int32_t a, int32_t b)
+{
+#if defined(__ARM_FEATURE_DSP)
+    return __qadd(a, b);
+#else
+    int64_t sum = (int64_t) a + b;
+
+    if (sum > INT32_MAX)
+    {
+        return INT32_MAX;
+    }
+    else if (sum < INT32_MIN)
+    {
+        return INT32_MIN;
+    }
+
+    return (int32_t) sum;
+#endif
+}
+
+/**
+ * Sine of a phase, interpolated from the quarter period table
+ *
+ * @param [in] phase            32-bit fraction of a period
+ *
+ * @return sine in Q31
+ *
+ */
+static inline int32_t tone_gen_sin(uint32_t phase)
+{
+    uint32_t p = phase & 0x3FFFFFFF;
+    uint32_t i;
+    int32_t a, b, s;
+
+    // Second and fourth quarters are the first and third mirrored
+    if (phase & 0x40000000)
+    {
+        p ^= 0x3FFFFFFF;
+    }
+
+    i = p >> TONE_GEN_SIN_FRAC_BITS;
+    a = tone_gen_sin_table[i];
+    b = tone_gen_sin_table[i + 1];
+    s = a + (int32_t) ((((int64_t) (b - a)) * (p & ((1 << TONE_GEN_SIN_FRAC_BITS) - 1))) >> TONE_GEN_SIN_FRAC_BITS);
+
+    // Second half of period is the first half negated
+    return (phase & 0x80000000) ? -s : s;
+}
+
+/**
+ * Generate the next sample, the saturated sum of all sines
+ *
+ * @param [in] gen              Pointer to the generator state
+ *
+ * @return sample in Q31
+ *
+ */
+static inline int32_t tone_gen_next_sample(tone_gen_t *gen)
+{
+    int32_t sum = 0;
+
+    for (uint32_t t = 0; t < gen->num_tones; t++)
+    {
+        int32_t s = tone_gen_sin(gen->phase[t]);
+
+        gen->phase[t] += gen->phase_inc[t];
+        sum = tone_gen_qadd(sum, (int32_t) ((((int64_t) s) * gen->amplitude) >> 31));
+    }
+
+    return sum;
+}
+
+/**
+ * Generate a block of stereo frames
+ *
+ * Each frame is packed so it is stored with whole-word writes: for 16-bit subframes both samples in one word, for
+ * 32-bit subframes the sample with its half-words swapped (a single rotate) written twice.
+ *
+ * @param [in] gen              Pointer to the generator state
+ * @param [out] words           Pointer to buffer for frames
+ * @param [in] frames           Number of stereo frames to generate
+ * @param [in] inc_step         Change in phase increment of first sine per sample, for sweeps
+ *
+ * @return pointer to word after last frame generated
+ *
+ */
+static uint32_t *tone_gen_fill_block(tone_gen_t *gen, uint32_t *words, uint32_t frames, int32_t inc_step)
+{
+    if (gen->subframe_bits == 16)
+    {
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            uint32_t s = (uint32_t) tone_gen_next_sample(gen);
+
+            gen->phase_inc[0] += inc_step;
+            *words++ = (s & 0xFFFF0000) | (s >> 16);
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            uint32_t s = (uint32_t) tone_gen_next_sample(gen);
+
+            gen->phase_inc[0] += inc_step;
+            s = (s << 16) | (s >> 16);
+            *words++ = s;
+            *words++ = s;
+        }
+    }
+
+    return words;
+}
+
+/**
+ * Phase increment per sample at a position in the sweep
+ *
+ * @param [in] gen              Pointer to the generator state
+ * @param [in] pos              Samples from start of sweep
+ *
+ * @return phase increment
+ *
+ */
+static inline uint32_t tone_gen_sweep_inc(tone_gen_t *gen, uint32_t pos)
+{
+    return (uint32_t) (gen->sweep_inc_start * expf(gen->sweep_rate * (float) pos));
+}
+
+/**
+ * Check a frequency can be generated at a sample rate
+ *
+ * @param [in] freq_hz          Frequency in Hz
+ * @param [in] fs_hz            Sample rate in Hz
+ *
+ * @return true if freq_hz is above 0 and below half of fs_hz
+ *
+ */
+static inline bool tone_gen_is_valid_freq(uint32_t freq_hz, uint32_t fs_hz)
+{
+    return (freq_hz > 0) && (((uint64_t) freq_hz * 2) < fs_hz);
+}
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+/**
+ * Initialize the generator for a signal
+ *
+ */
+uint32_t tone_gen_init(tone_gen_t *gen, const tone_gen_config_t *config, uint32_t fs_hz, uint32_t subframe_bits)
+{
+    uint32_t num_tones;
+
+    if ((gen == NULL) || (config == NULL) || ((subframe_bits != 16) && (subframe_bits != 32)))
+    {
+        return TONE_GEN_STATUS_FAIL;
+    }
+
+    switch (config->type)
+    {
+        case TONE_GEN_TYPE_SILENCE:
+            num_tones = 0;
+            break;
+
+        case TONE_GEN_TYPE_SINE:
+            num_tones = 1;
+            break;
+
+        case TONE_GEN_TYPE_MULTITONE:
+            num_tones = config->num_tones;
+            if ((num_tones == 0) || (num_tones > TONE_GEN_TONES_MAX))
+            {
+                return TONE_GEN_STATUS_FAIL;
+            }
+            break;
+
+        case TONE_GEN_TYPE_SWEEP:
+            num_tones = 1;
+            if ((config->sweep_ms == 0) || (!tone_gen_is_valid_freq(config->freq_hz[1], fs_hz)))
+            {
+                return TONE_GEN_STATUS_FAIL;
+            }
+            break;
+
+        default:
+            return TONE_GEN_STATUS_FAIL;
+    }
+
+    for (uint32_t t = 0; t < num_tones; t++)
+    {
+        if (!tone_gen_is_valid_freq(config->freq_hz[t], fs_hz))
+        {
+            return TONE_GEN_STATUS_FAIL;
+        }
+
+        gen->phase[t] = 0;
+        gen->phase_inc[t] = (uint32_t) ((((uint64_t) config->freq_hz[t]) << 32) / fs_hz);
+    }
+
+    gen->type = config->type;
+    gen->num_tones = num_tones;
+    gen->amplitude = (config->amplitude > TONE_GEN_AMPLITUDE_FULL_SCALE) ?
+                     TONE_GEN_AMPLITUDE_FULL_SCALE : config->amplitude;
+    gen->subframe_bits = subframe_bits;
+    gen->sweep_pos = 0;
+
+    if (config->type == TONE_GEN_TYPE_SWEEP)
+    {
+        gen->sweep_len = (uint32_t) (((uint64_t) fs_hz * config->sweep_ms) / 1000);
+        if (gen->sweep_len == 0)
+        {
+            return TONE_GEN_STATUS_FAIL;
+        }
+
+        gen->sweep_inc_start = (float) gen->phase_inc[0];
+        gen->sweep_rate = logf((float) config->freq_hz[1] / (float) config->freq_hz[0]) / (float) gen->sweep_len;
+    }
+
+    return TONE_GEN_STATUS_OK;
+}
+
+/**
+ * Generate the next stereo frames of the signal
+ *
+ */
+void tone_gen_fill(tone_gen_t *gen, void *buffer, uint32_t frames)
+{
+    uint32_t *words = (uint32_t *) buffer;
+
+    if (gen->type != TONE_GEN_TYPE_SWEEP)
+    {
+        tone_gen_fill_block(gen, words, frames, 0);
+
+        return;
+    }
+
+    /*
+     * The exact phase increment is only computed every TONE_GEN_SWEEP_BLOCK_SAMPLES, and is stepped linearly in
+     * between, so the sweep costs one expf() per block and the frequency never drifts from the exact curve.
+     */
+    while (frames > 0)
+    {
+        uint32_t n = frames;
+        uint32_t inc_end;
+
+        if (n > TONE_GEN_SWEEP_BLOCK_SAMPLES)
+        {
+            n = TONE_GEN_SWEEP_BLOCK_SAMPLES;
+        }
+        if (n > (gen->sweep_len - gen->sweep_pos))
+        {
+            n = gen->sweep_len - gen->sweep_pos;
+        }
+
+        inc_end = tone_gen_sweep_inc(gen, gen->sweep_pos + n);
+        words = tone_gen_fill_block(gen, words, n, ((int32_t) (inc_end - gen->phase_inc[0])) / (int32_t) n);
+        gen->phase_inc[0] = inc_end;
+
+        frames -= n;
+        gen->sweep_pos += n;
+        if (gen->sweep_pos >= gen->sweep_len)
+        {
+            gen->sweep_pos = 0;
+            gen->phase_inc[0] = tone_gen_sweep_inc(gen, 0);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Convert a level in dBFS to a tone_gen_config_t amplitude
+ *
+ */
+uint32_t tone_gen_level_to_amplitude(int32_t level_db10)
+{
+    if (level_db10 >= 0)
+    {
+        return TONE_GEN_AMPLITUDE_FULL_SCALE;
+    }
+
+    // 2^31 is exactly representable as a float, and the product is below it for any level below 0dBFS
+    return (uint32_t) (powf(10.0f, (float) level_db10 / 200.0f) * 2147483648.0f);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file tone_gen.h
+ *
+ * @brief Fixed-point test tone generator for Render path Test Tone
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2022 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef TONE_GEN_H
+#define TONE_GEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * LITERALS & CONSTANTS
+ **********************************************************************************************************************/
+/**
+ * @defgroup TONE_GEN_STATUS_
+ * @brief Return values for all public API calls
+ *
+ * @{
+ */
+#define TONE_GEN_STATUS_OK                  (0)
+#define TONE_GEN_STATUS_FAIL                (1)
+/** @} */
+
+/**
+ * @defgroup TONE_GEN_TYPE_
+ * @brief Signals that can be generated
+ *
+ * @see tone_gen_config_t
+ *
+ * @{
+ */
+#define TONE_GEN_TYPE_SILENCE               (0)     ///< All samples 0
+#define TONE_GEN_TYPE_SINE                  (1)     ///< Sine at freq_hz[0]
+#define TONE_GEN_TYPE_MULTITONE             (2)     ///< Sum of sines at freq_hz[0] to freq_hz[num_tones - 1]
+#define TONE_GEN_TYPE_SWEEP                 (3)     ///< Logarithmic sweep from freq_hz[0] to freq_hz[1], repeated
+/** @} */
+
+#define TONE_GEN_TONES_MAX                  (4)             ///< Maximum number of sines in a multitone
+#define TONE_GEN_AMPLITUDE_FULL_SCALE       (0x7FFFFFFF)    ///< Amplitude of a 0dBFS sine
+
+/***********************************************************************************************************************
+ * MACROS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * ENUMS, STRUCTS, UNIONS, TYPEDEFS
+ **********************************************************************************************************************/
+/**
+ * Signal to generate
+ *
+ * The same signal is generated on both channels of each stereo frame.
+ *
+ * @see tone_gen_init
+ */
+typedef struct
+{
+    uint32_t type;                              ///< Signal type - @see TONE_GEN_TYPE_
+    uint32_t freq_hz[TONE_GEN_TONES_MAX];       ///< Sine frequencies, must be below half the sample rate
+    uint32_t num_tones;                         ///< Number of sines for TONE_GEN_TYPE_MULTITONE
+    uint32_t amplitude;                         ///< Peak of each sine, where TONE_GEN_AMPLITUDE_FULL_SCALE is 0dBFS
+    uint32_t sweep_ms;                          ///< Duration of one sweep for TONE_GEN_TYPE_SWEEP
+} tone_gen_config_t;
+
+/**
+ * Generator state
+ *
+ * Phases are 32-bit fractions of a period, so each wraps around at the end of a period.
+ */
+typedef struct
+{
+    uint32_t type;                              ///< Signal type - @see TONE_GEN_TYPE_
+    uint32_t num_tones;                         ///< Number of sines summed for each sample
+    uint32_t amplitude;                         ///< Peak of each sine
+    uint32_t subframe_bits;                     ///< Bits per I2S subframe, either 16 or 32
+    uint32_t phase[TONE_GEN_TONES_MAX];         ///< Current phase of each sine
+    uint32_t phase_inc[TONE_GEN_TONES_MAX];     ///< Phase increment per sample of each sine
+    uint32_t sweep_pos;                         ///< Samples generated in current sweep
+    uint32_t sweep_len;                         ///< Samples in one sweep
+    float sweep_rate;                           ///< Natural log of the sweep frequency ratio per sample
+    float sweep_inc_start;                      ///< Phase increment per sample at start of sweep
+} tone_gen_t;
+
+/***********************************************************************************************************************
+ * GLOBAL VARIABLES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+/**
+ * Initialize the generator for a signal
+ *
+ * All sines start at phase 0.
+ *
+ * @param [out] gen             Pointer to the generator state
+ * @param [in] config           Pointer to the signal to generate
+ * @param [in] fs_hz            Sample rate in Hz
+ * @param [in] subframe_bits    Bits per I2S subframe, either 16 or 32.  24-bit data in a 32-bit subframe uses 32.
+ *
+ * @return
+ * - TONE_GEN_STATUS_FAIL if:
+ *      - type, num_tones or subframe_bits is invalid
+ *      - any frequency used is 0 or not below half the sample rate
+ *      - sweep_ms is 0 for TONE_GEN_TYPE_SWEEP
+ * - TONE_GEN_STATUS_OK         otherwise
+ *
+ */
+uint32_t tone_gen_init(tone_gen_t *gen, const tone_gen_config_t *config, uint32_t fs_hz, uint32_t subframe_bits);
+
+/**
+ * Generate the next stereo frames of the signal
+ *
+ * Frames are written in the layout used by the I2S DMA: for 16-bit subframes, the left then right sample; for 32-bit
+ * subframes, each sample as its most significant then least significant half-word.  Sums of sines that exceed full
+ * scale are saturated.
+ *
+ * @param [in] gen              Pointer to the generator state
+ * @param [out] buffer          Pointer to buffer for frames, aligned to 4 bytes
+ * @param [in] frames           Number of stereo frames to generate
+ *
+ * @return none
+ *
+ */
+void tone_gen_fill(tone_gen_t *gen, void *buffer, uint32_t frames);
+
+/**
+ * Convert a level in dBFS to a tone_gen_config_t amplitude
+ *
+ * @param [in] level_db10       Level in 0.1dBFS steps, e.g. -200 for -20dBFS
+ *
+ * @return amplitude, which is TONE_GEN_AMPLITUDE_FULL_SCALE for levels of 0dBFS and above
+ *
+ */
+uint32_t tone_gen_level_to_amplitude(int32_t level_db10);
+
+/**********************************************************************************************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TONE_GEN_H */
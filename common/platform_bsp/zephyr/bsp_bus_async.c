@@ -0,0 +1,825 @@
+/**
+ * @file bsp_bus_async.c
+ *
+ * @brief Implementation of the Zephyr asynchronous control port bus backend
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2022 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/spi.h>
+#include "bsp_bus_async.h"
+
+/***********************************************************************************************************************
+ * LOCAL LITERAL SUBSTITUTIONS
+ **********************************************************************************************************************/
+#define BSP_BUS_ASYNC_QUEUE_DEPTH       (CONFIG_CIRRUS_LOGIC_BUS_ASYNC_QUEUE_DEPTH)
+#define BSP_BUS_ASYNC_BUFFER_SIZE       (ROUND_UP(CONFIG_CIRRUS_LOGIC_BUS_ASYNC_BUFFER_SIZE, 4))
+#define BSP_BUS_ASYNC_WORKQ_STACK_SIZE  (CONFIG_CIRRUS_LOGIC_BUS_ASYNC_WORKQ_STACK_SIZE)
+#define BSP_BUS_ASYNC_WORKQ_PRIORITY    (CONFIG_CIRRUS_LOGIC_BUS_ASYNC_WORKQ_PRIORITY)
+
+/**
+ * Placement of the DMA buffers
+ *
+ * Firmware and register data are copied into these buffers, so they must be in memory the bus controller DMA can
+ * access, i.e. not flash on the nRF5340.
+ */
+#if defined(CONFIG_CIRRUS_LOGIC_BUS_ASYNC_DMA_NOCACHE)
+#define BSP_BUS_ASYNC_DMA_SECTION       __nocache
+#elif defined(CONFIG_CIRRUS_LOGIC_BUS_ASYNC_DMA_SECTION)
+#define BSP_BUS_ASYNC_DMA_SECTION       __attribute__((section(CONFIG_CIRRUS_LOGIC_BUS_ASYNC_DMA_SECTION_NAME)))
+#else
+#define BSP_BUS_ASYNC_DMA_SECTION
+#endif
+
+/**
+ * @defgroup BSP_BUS_ASYNC_OP_
+ * @brief Type of queued transaction
+ *
+ * @{
+ */
+#define BSP_BUS_ASYNC_OP_BARRIER        (0)     ///< Completes once all previously queued transactions are complete
+#define BSP_BUS_ASYNC_OP_WRITE          (1)
+#define BSP_BUS_ASYNC_OP_READ           (2)
+/** @} */
+
+/**
+ * @defgroup BSP_BUS_ASYNC_SLOT_
+ * @brief State of a queue slot
+ *
+ * @{
+ */
+#define BSP_BUS_ASYNC_SLOT_FREE         (0)
+#define BSP_BUS_ASYNC_SLOT_FILLING      (1)
+#define BSP_BUS_ASYNC_SLOT_QUEUED       (2)
+/** @} */
+
+/***********************************************************************************************************************
+ * LOCAL VARIABLES
+ **********************************************************************************************************************/
+
+/**
+ * Queued transaction
+ *
+ * The header (address and SPI padding) is always copied into the DMA buffer.  Data is copied after it if it fits,
+ * otherwise the caller's buffer is used and the caller waits for completion.
+ */
+typedef struct
+{
+    uint8_t state;                          ///< @see BSP_BUS_ASYNC_SLOT_
+    uint8_t op;                             ///< @see BSP_BUS_ASYNC_OP_
+    bsp_bus_async_dev_t *dev;
+
+    uint8_t *hdr;
+    uint32_t hdr_length;
+    uint8_t *data;
+    uint32_t data_length;
+    uint8_t *read_dest;                     ///< Caller buffer to copy read data into on completion, or NULL
+
+    bsp_callback_t cb;
+    void *cb_arg;
+    struct k_sem *done;                     ///< Given on completion if the caller is waiting, otherwise NULL
+    uint32_t *done_status;
+
+    struct i2c_msg msgs[2];
+    struct spi_buf bufs[3];
+    struct spi_buf_set tx_set;
+    struct spi_buf_set rx_set;
+} bsp_bus_async_slot_t;
+
+static uint8_t bsp_bus_async_buffers[BSP_BUS_ASYNC_QUEUE_DEPTH][BSP_BUS_ASYNC_BUFFER_SIZE]
+    BSP_BUS_ASYNC_DMA_SECTION __aligned(4);
+
+static bsp_bus_async_slot_t bsp_bus_async_slots[BSP_BUS_ASYNC_QUEUE_DEPTH];
+static uint32_t bsp_bus_async_head;
+static uint32_t bsp_bus_async_tail;
+static bool bsp_bus_async_in_flight;
+static bool bsp_bus_async_spi_throttled;
+static struct k_spinlock bsp_bus_async_lock;
+static struct k_sem bsp_bus_async_free_slots;
+static struct k_work bsp_bus_async_submit_work;
+
+/**
+ * Work queue that submits transactions
+ *
+ * Callers block on transactions completing, so submission cannot use the system work queue, where a driver call made
+ * from a work item would block the submit handler forever.
+ */
+static struct k_work_q bsp_bus_async_workq;
+static bool bsp_bus_async_workq_started;
+K_THREAD_STACK_DEFINE(bsp_bus_async_workq_stack, BSP_BUS_ASYNC_WORKQ_STACK_SIZE);
+
+static bsp_bus_async_dev_t *bsp_bus_async_devs;
+static uint32_t bsp_bus_async_num_devs;
+
+static uint32_t (*bsp_bus_async_set_timer_next)(uint32_t duration_ms, bsp_callback_t cb, void *cb_arg);
+static uint32_t (*bsp_bus_async_set_gpio_next)(uint32_t gpio_id, uint8_t gpio_state);
+
+/***********************************************************************************************************************
+ * GLOBAL VARIABLES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+static bsp_bus_async_dev_t *bsp_bus_async_find_dev(uint32_t bsp_dev_id, uint8_t bus_type)
+{
+    for (uint32_t i = 0; i < bsp_bus_async_num_devs; i++)
+    {
+        if ((bsp_bus_async_devs[i].bsp_dev_id == bsp_dev_id) && (bsp_bus_async_devs[i].bus_type == bus_type))
+        {
+            return &(bsp_bus_async_devs[i]);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Complete the transaction at the head of the queue and start the next one
+ *
+ * Called from the completion context of the bus controller driver, or from the submit work handler.
+ *
+ * @param [in] slot             Slot at the head of the queue
+ * @param [in] result           0 on success, otherwise a negative errno
+ *
+ * @return none
+ *
+ */
+static void bsp_bus_async_complete(bsp_bus_async_slot_t *slot, int result)
+{
+    uint32_t status = (result < 0) ? BSP_STATUS_FAIL : BSP_STATUS_OK;
+    k_spinlock_key_t key;
+
+    if ((status == BSP_STATUS_OK) && (slot->read_dest != NULL))
+    {
+        memcpy(slot->read_dest, slot->data, slot->data_length);
+    }
+
+    if (slot->cb != NULL)
+    {
+        slot->cb(status, slot->cb_arg);
+    }
+
+    if (slot->done != NULL)
+    {
+        *(slot->done_status) = status;
+        k_sem_give(slot->done);
+    }
+
+    key = k_spin_lock(&bsp_bus_async_lock);
+    if ((slot->done == NULL) && (slot->cb == NULL) && (status != BSP_STATUS_OK))
+    {
+        // Posted write, so report the failure from the next transaction to the same device that waits
+        slot->dev->write_error = true;
+    }
+    slot->state = BSP_BUS_ASYNC_SLOT_FREE;
+    bsp_bus_async_head = (bsp_bus_async_head + 1) % BSP_BUS_ASYNC_QUEUE_DEPTH;
+    bsp_bus_async_in_flight = false;
+    k_spin_unlock(&bsp_bus_async_lock, key);
+
+    k_sem_give(&bsp_bus_async_free_slots);
+    k_work_submit_to_queue(&bsp_bus_async_workq, &bsp_bus_async_submit_work);
+
+    return;
+}
+
+static void bsp_bus_async_transfer_cb(const struct device *dev, int result, void *data)
+{
+    bsp_bus_async_complete((bsp_bus_async_slot_t *) data, result);
+
+    return;
+}
+
+/**
+ * Submit a queued transaction to the bus controller driver
+ *
+ * If the asynchronous API is not enabled, or not supported by the driver, the transaction is done synchronously from
+ * the submit work handler, which still leaves the calling thread free.
+ *
+ * @param [in] slot             Slot at the head of the queue
+ *
+ * @return none
+ *
+ */
+static void bsp_bus_async_start(bsp_bus_async_slot_t *slot)
+{
+    bsp_bus_async_dev_t *dev = slot->dev;
+    struct spi_config *spi_cfg;
+    bool contiguous = (slot->data == (slot->hdr + slot->hdr_length));
+    uint8_t num_msgs = 0;
+
+    if (slot->op == BSP_BUS_ASYNC_OP_BARRIER)
+    {
+        bsp_bus_async_complete(slot, 0);
+        return;
+    }
+
+    if (dev->bus_type == BSP_BUS_TYPE_I2C)
+    {
+        if (slot->op == BSP_BUS_ASYNC_OP_READ)
+        {
+            slot->msgs[0].buf = slot->hdr;
+            slot->msgs[0].len = slot->hdr_length;
+            slot->msgs[0].flags = I2C_MSG_WRITE;
+            slot->msgs[1].buf = slot->data;
+            slot->msgs[1].len = slot->data_length;
+            slot->msgs[1].flags = I2C_MSG_READ | I2C_MSG_RESTART | I2C_MSG_STOP;
+            num_msgs = 2;
+        }
+        else if (contiguous || (slot->hdr_length == 0))
+        {
+            slot->msgs[0].buf = contiguous ? slot->hdr : slot->data;
+            slot->msgs[0].len = slot->hdr_length + slot->data_length;
+            slot->msgs[0].flags = I2C_MSG_WRITE | I2C_MSG_STOP;
+            num_msgs = 1;
+        }
+        else
+        {
+            slot->msgs[0].buf = slot->hdr;
+            slot->msgs[0].len = slot->hdr_length;
+            slot->msgs[0].flags = I2C_MSG_WRITE;
+            slot->msgs[1].buf = slot->data;
+            slot->msgs[1].len = slot->data_length;
+            slot->msgs[1].flags = I2C_MSG_WRITE | I2C_MSG_STOP;
+            num_msgs = 2;
+        }
+
+#ifdef CONFIG_I2C_CALLBACK
+        int ret = i2c_transfer_cb(dev->bus, slot->msgs, num_msgs, dev->i2c_addr, bsp_bus_async_transfer_cb, slot);
+        if ((ret != -ENOSYS) && (ret != -ENOTSUP))
+        {
+            if (ret < 0)
+            {
+                bsp_bus_async_complete(slot, ret);
+            }
+            return;
+        }
+#endif
+        bsp_bus_async_complete(slot, i2c_transfer(dev->bus, slot->msgs, num_msgs, dev->i2c_addr));
+    }
+    else
+    {
+        spi_cfg = bsp_bus_async_spi_throttled ? &(dev->spi_cfg_throttled) : &(dev->spi_cfg);
+
+        slot->bufs[0].buf = slot->hdr;
+        slot->bufs[0].len = slot->hdr_length;
+        slot->tx_set.buffers = &(slot->bufs[0]);
+        if (slot->op == BSP_BUS_ASYNC_OP_READ)
+        {
+            // Clock out the address and padding, discarding what is received
+            slot->bufs[1].buf = NULL;
+            slot->bufs[1].len = slot->hdr_length;
+            slot->bufs[2].buf = slot->data;
+            slot->bufs[2].len = slot->data_length;
+            slot->tx_set.count = 1;
+            slot->rx_set.buffers = &(slot->bufs[1]);
+            slot->rx_set.count = 2;
+        }
+        else if (contiguous)
+        {
+            slot->bufs[0].len += slot->data_length;
+            slot->tx_set.count = 1;
+        }
+        else
+        {
+            slot->bufs[1].buf = slot->data;
+            slot->bufs[1].len = slot->data_length;
+            slot->tx_set.count = 2;
+        }
+
+#ifdef CONFIG_SPI_ASYNC
+        int ret = spi_transceive_cb(dev->bus,
+                                    spi_cfg,
+                                    &(slot->tx_set),
+                                    (slot->op == BSP_BUS_ASYNC_OP_READ) ? &(slot->rx_set) : NULL,
+                                    bsp_bus_async_transfer_cb,
+                                    slot);
+        if ((ret != -ENOSYS) && (ret != -ENOTSUP))
+        {
+            if (ret < 0)
+            {
+                bsp_bus_async_complete(slot, ret);
+            }
+            return;
+        }
+#endif
+        bsp_bus_async_complete(slot,
+                               spi_transceive(dev->bus,
+                                              spi_cfg,
+                                              &(slot->tx_set),
+                                              (slot->op == BSP_BUS_ASYNC_OP_READ) ? &(slot->rx_set) : NULL));
+    }
+
+    return;
+}
+
+/**
+ * Submit the transaction at the head of the queue, if the bus is idle
+ *
+ * Runs on bsp_bus_async_workq, since the bus controller drivers cannot start a transfer from their own completion
+ * callback.
+ *
+ */
+static void bsp_bus_async_submit_handler(struct k_work *work)
+{
+    bsp_bus_async_slot_t *slot = NULL;
+    k_spinlock_key_t key;
+
+    key = k_spin_lock(&bsp_bus_async_lock);
+    if ((!bsp_bus_async_in_flight) && \
+        (bsp_bus_async_slots[bsp_bus_async_head].state == BSP_BUS_ASYNC_SLOT_QUEUED))
+    {
+        bsp_bus_async_in_flight = true;
+        slot = &(bsp_bus_async_slots[bsp_bus_async_head]);
+    }
+    k_spin_unlock(&bsp_bus_async_lock, key);
+
+    if (slot != NULL)
+    {
+        bsp_bus_async_start(slot);
+    }
+
+    return;
+}
+
+/**
+ * Take the next free slot at the tail of the queue
+ *
+ * Blocks while the queue is full, unless called from an ISR.
+ *
+ * @return                      Pointer to the slot, or NULL if the queue is full and the caller cannot block
+ *
+ */
+static bsp_bus_async_slot_t *bsp_bus_async_alloc(void)
+{
+    bsp_bus_async_slot_t *slot;
+    k_spinlock_key_t key;
+
+    if (k_sem_take(&bsp_bus_async_free_slots, k_is_in_isr() ? K_NO_WAIT : K_FOREVER))
+    {
+        return NULL;
+    }
+
+    key = k_spin_lock(&bsp_bus_async_lock);
+    slot = &(bsp_bus_async_slots[bsp_bus_async_tail]);
+    bsp_bus_async_tail = (bsp_bus_async_tail + 1) % BSP_BUS_ASYNC_QUEUE_DEPTH;
+    slot->state = BSP_BUS_ASYNC_SLOT_FILLING;
+    k_spin_unlock(&bsp_bus_async_lock, key);
+
+    slot->dev = NULL;
+    slot->hdr = bsp_bus_async_buffers[slot - bsp_bus_async_slots];
+    slot->hdr_length = 0;
+    slot->data = NULL;
+    slot->data_length = 0;
+    slot->read_dest = NULL;
+    slot->cb = NULL;
+    slot->cb_arg = NULL;
+    slot->done = NULL;
+    slot->done_status = NULL;
+
+    return slot;
+}
+
+static void bsp_bus_async_queue(bsp_bus_async_slot_t *slot)
+{
+    k_spinlock_key_t key;
+
+    key = k_spin_lock(&bsp_bus_async_lock);
+    slot->state = BSP_BUS_ASYNC_SLOT_QUEUED;
+    k_spin_unlock(&bsp_bus_async_lock, key);
+
+    k_work_submit_to_queue(&bsp_bus_async_workq, &bsp_bus_async_submit_work);
+
+    return;
+}
+
+/**
+ * Check if the caller cannot wait for a transaction to complete
+ *
+ * Transactions complete on bsp_bus_async_workq or in the bus controller ISR, so neither can wait for them.
+ *
+ */
+static bool bsp_bus_async_cannot_wait(void)
+{
+    return k_is_in_isr() || (k_current_get() == k_work_queue_thread_get(&bsp_bus_async_workq));
+}
+
+/**
+ * Queue a transaction, and wait for it if required
+ *
+ * @param [in] dev              Device
+ * @param [in] op               BSP_BUS_ASYNC_OP_WRITE or BSP_BUS_ASYNC_OP_READ
+ * @param [in] hdr              Address bytes, copied into the DMA buffer
+ * @param [in] hdr_length       Number of address bytes
+ * @param [in] pad_len          Number of zero padding bytes to follow the address
+ * @param [in] data             Data to write, or buffer to read into
+ * @param [in] data_length      Number of data bytes
+ * @param [in] cb               Completion callback, or NULL
+ * @param [in] cb_arg           Argument for cb
+ *
+ * @return
+ * - BSP_STATUS_FAIL            if the transaction cannot be queued, if it must be waited for by a caller that cannot
+ *                              wait, if a waited transaction fails, or if a posted write to the same device failed
+ *                              since the last transaction to it that waited
+ * - BSP_STATUS_OK              otherwise
+ *
+ */
+static uint32_t bsp_bus_async_transfer(bsp_bus_async_dev_t *dev,
+                                       uint8_t op,
+                                       uint8_t *hdr,
+                                       uint32_t hdr_length,
+                                       uint32_t pad_len,
+                                       uint8_t *data,
+                                       uint32_t data_length,
+                                       bsp_callback_t cb,
+                                       void *cb_arg)
+{
+    bsp_bus_async_slot_t *slot;
+    struct k_sem done;
+    uint32_t status = BSP_STATUS_FAIL;
+    k_spinlock_key_t key;
+    bool copied, wait;
+
+    if ((dev == NULL) || ((hdr_length + pad_len) > BSP_BUS_ASYNC_BUFFER_SIZE))
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    copied = (data_length <= (BSP_BUS_ASYNC_BUFFER_SIZE - (hdr_length + pad_len)));
+#ifdef CONFIG_CIRRUS_LOGIC_BUS_ASYNC_POSTED_WRITES
+    wait = (cb == NULL) && ((op == BSP_BUS_ASYNC_OP_READ) || !copied);
+#else
+    wait = (cb == NULL);
+#endif
+    if (wait && bsp_bus_async_cannot_wait())
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    slot = bsp_bus_async_alloc();
+    if (slot == NULL)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    slot->dev = dev;
+    slot->op = op;
+    memcpy(slot->hdr, hdr, hdr_length);
+    memset(slot->hdr + hdr_length, 0, pad_len);
+    slot->hdr_length = hdr_length + pad_len;
+    slot->data_length = data_length;
+    slot->cb = cb;
+    slot->cb_arg = cb_arg;
+
+    if (!copied)
+    {
+        slot->data = data;
+    }
+    else
+    {
+        slot->data = slot->hdr + slot->hdr_length;
+        if (op == BSP_BUS_ASYNC_OP_READ)
+        {
+            slot->read_dest = data;
+        }
+        else
+        {
+            memcpy(slot->data, data, data_length);
+        }
+    }
+
+    if (wait)
+    {
+        k_sem_init(&done, 0, 1);
+        slot->done = &done;
+        slot->done_status = &status;
+    }
+
+    bsp_bus_async_queue(slot);
+
+    if (!wait)
+    {
+        return BSP_STATUS_OK;
+    }
+
+    k_sem_take(&done, K_FOREVER);
+
+    key = k_spin_lock(&bsp_bus_async_lock);
+    if (dev->write_error)
+    {
+        dev->write_error = false;
+        status = BSP_STATUS_FAIL;
+    }
+    k_spin_unlock(&bsp_bus_async_lock, key);
+
+    return status;
+}
+
+/**
+ * Wait for all queued transactions to complete, leaving any posted write failure to be reported later
+ *
+ */
+static void bsp_bus_async_drain(void)
+{
+    bsp_bus_async_slot_t *slot;
+    struct k_sem done;
+    uint32_t status;
+
+    if ((bsp_bus_async_devs == NULL) || bsp_bus_async_cannot_wait())
+    {
+        return;
+    }
+
+    slot = bsp_bus_async_alloc();
+    if (slot == NULL)
+    {
+        return;
+    }
+
+    k_sem_init(&done, 0, 1);
+    slot->op = BSP_BUS_ASYNC_OP_BARRIER;
+    slot->done = &done;
+    slot->done_status = &status;
+    bsp_bus_async_queue(slot);
+
+    k_sem_take(&done, K_FOREVER);
+
+    return;
+}
+
+static uint32_t bsp_bus_async_set_timer(uint32_t duration_ms, bsp_callback_t cb, void *cb_arg)
+{
+    bsp_bus_async_drain();
+
+    return bsp_bus_async_set_timer_next(duration_ms, cb, cb_arg);
+}
+
+static uint32_t bsp_bus_async_set_gpio(uint32_t gpio_id, uint8_t gpio_state)
+{
+    bsp_bus_async_drain();
+
+    return bsp_bus_async_set_gpio_next(gpio_id, gpio_state);
+}
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Initialize the asynchronous bus backend
+ *
+ */
+uint32_t bsp_bus_async_initialize(bsp_bus_async_dev_t *devs, uint32_t num_devs)
+{
+    if (devs == NULL)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    for (uint32_t i = 0; i < num_devs; i++)
+    {
+        if (!device_is_ready(devs[i].bus))
+        {
+            return BSP_STATUS_FAIL;
+        }
+
+        devs[i].spi_cfg_throttled = devs[i].spi_cfg;
+        devs[i].write_error = false;
+    }
+
+    memset(bsp_bus_async_slots, 0, sizeof(bsp_bus_async_slots));
+    bsp_bus_async_head = 0;
+    bsp_bus_async_tail = 0;
+    bsp_bus_async_in_flight = false;
+    bsp_bus_async_spi_throttled = false;
+    k_sem_init(&bsp_bus_async_free_slots, BSP_BUS_ASYNC_QUEUE_DEPTH, BSP_BUS_ASYNC_QUEUE_DEPTH);
+    k_work_init(&bsp_bus_async_submit_work, bsp_bus_async_submit_handler);
+
+    if (!bsp_bus_async_workq_started)
+    {
+        k_work_queue_start(&bsp_bus_async_workq,
+                           bsp_bus_async_workq_stack,
+                           K_THREAD_STACK_SIZEOF(bsp_bus_async_workq_stack),
+                           BSP_BUS_ASYNC_WORKQ_PRIORITY,
+                           NULL);
+        k_thread_name_set(k_work_queue_thread_get(&bsp_bus_async_workq), "bsp_bus_async");
+        bsp_bus_async_workq_started = true;
+    }
+
+    bsp_bus_async_devs = devs;
+    bsp_bus_async_num_devs = num_devs;
+
+    return BSP_STATUS_OK;
+}
+
+/**
+ * Install the asynchronous bus backend in a BSP-to-Driver API implementation
+ *
+ */
+uint32_t bsp_bus_async_attach(bsp_driver_if_t *bsp_if)
+{
+    if (bsp_if == NULL)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    if (bsp_if->set_timer != &bsp_bus_async_set_timer)
+    {
+        bsp_bus_async_set_timer_next = bsp_if->set_timer;
+        bsp_if->set_timer = &bsp_bus_async_set_timer;
+    }
+    if (bsp_if->set_gpio != &bsp_bus_async_set_gpio)
+    {
+        bsp_bus_async_set_gpio_next = bsp_if->set_gpio;
+        bsp_if->set_gpio = &bsp_bus_async_set_gpio;
+    }
+
+    bsp_if->i2c_reset = &bsp_bus_async_i2c_reset;
+    bsp_if->i2c_read_repeated_start = &bsp_bus_async_i2c_read_repeated_start;
+    bsp_if->i2c_write = &bsp_bus_async_i2c_write;
+    bsp_if->i2c_db_write = &bsp_bus_async_i2c_db_write;
+    bsp_if->spi_read = &bsp_bus_async_spi_read;
+    bsp_if->spi_write = &bsp_bus_async_spi_write;
+    bsp_if->spi_throttle_speed = &bsp_bus_async_spi_throttle_speed;
+    bsp_if->spi_restore_speed = &bsp_bus_async_spi_restore_speed;
+
+    return BSP_STATUS_OK;
+}
+
+/**
+ * Wait for all queued transactions to complete
+ *
+ */
+uint32_t bsp_bus_async_flush(void)
+{
+    uint32_t ret = BSP_STATUS_OK;
+    k_spinlock_key_t key;
+
+    bsp_bus_async_drain();
+
+    key = k_spin_lock(&bsp_bus_async_lock);
+    for (uint32_t i = 0; i < bsp_bus_async_num_devs; i++)
+    {
+        if (bsp_bus_async_devs[i].write_error)
+        {
+            bsp_bus_async_devs[i].write_error = false;
+            ret = BSP_STATUS_FAIL;
+        }
+    }
+    k_spin_unlock(&bsp_bus_async_lock, key);
+
+    return ret;
+}
+
+uint32_t bsp_bus_async_i2c_reset(uint32_t bsp_dev_id, bool *was_i2c_busy)
+{
+    bsp_bus_async_dev_t *dev = bsp_bus_async_find_dev(bsp_dev_id, BSP_BUS_TYPE_I2C);
+
+    if (dev == NULL)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    if (was_i2c_busy != NULL)
+    {
+        *was_i2c_busy = bsp_bus_async_in_flight;
+    }
+
+    i2c_recover_bus(dev->bus);
+
+    return BSP_STATUS_OK;
+}
+
+uint32_t bsp_bus_async_i2c_read_repeated_start(uint32_t bsp_dev_id,
+                                               uint8_t *write_buffer,
+                                               uint32_t write_length,
+                                               uint8_t *read_buffer,
+                                               uint32_t read_length,
+                                               bsp_callback_t cb,
+                                               void *cb_arg)
+{
+    return bsp_bus_async_transfer(bsp_bus_async_find_dev(bsp_dev_id, BSP_BUS_TYPE_I2C),
+                                  BSP_BUS_ASYNC_OP_READ,
+                                  write_buffer,
+                                  write_length,
+                                  0,
+                                  read_buffer,
+                                  read_length,
+                                  cb,
+                                  cb_arg);
+}
+
+uint32_t bsp_bus_async_i2c_write(uint32_t bsp_dev_id,
+                                 uint8_t *write_buffer,
+                                 uint32_t write_length,
+                                 bsp_callback_t cb,
+                                 void *cb_arg)
+{
+    return bsp_bus_async_transfer(bsp_bus_async_find_dev(bsp_dev_id, BSP_BUS_TYPE_I2C),
+                                  BSP_BUS_ASYNC_OP_WRITE,
+                                  NULL,
+                                  0,
+                                  0,
+                                  write_buffer,
+                                  write_length,
+                                  cb,
+                                  cb_arg);
+}
+
+uint32_t bsp_bus_async_i2c_db_write(uint32_t bsp_dev_id,
+                                    uint8_t *write_buffer_0,
+                                    uint32_t write_length_0,
+                                    uint8_t *write_buffer_1,
+                                    uint32_t write_length_1,
+                                    bsp_callback_t cb,
+                                    void *cb_arg)
+{
+    return bsp_bus_async_transfer(bsp_bus_async_find_dev(bsp_dev_id, BSP_BUS_TYPE_I2C),
+                                  BSP_BUS_ASYNC_OP_WRITE,
+                                  write_buffer_0,
+                                  write_length_0,
+                                  0,
+                                  write_buffer_1,
+                                  write_length_1,
+                                  cb,
+                                  cb_arg);
+}
+
+uint32_t bsp_bus_async_spi_read(uint32_t bsp_dev_id,
+                                uint8_t *addr_buffer,
+                                uint32_t addr_length,
+                                uint8_t *data_buffer,
+                                uint32_t data_length,
+                                uint32_t pad_len)
+{
+    return bsp_bus_async_transfer(bsp_bus_async_find_dev(bsp_dev_id, BSP_BUS_TYPE_SPI),
+                                  BSP_BUS_ASYNC_OP_READ,
+                                  addr_buffer,
+                                  addr_length,
+                                  pad_len,
+                                  data_buffer,
+                                  data_length,
+                                  NULL,
+                                  NULL);
+}
+
+uint32_t bsp_bus_async_spi_write(uint32_t bsp_dev_id,
+                                 uint8_t *addr_buffer,
+                                 uint32_t addr_length,
+                                 uint8_t *data_buffer,
+                                 uint32_t data_length,
+                                 uint32_t pad_len)
+{
+    return bsp_bus_async_transfer(bsp_bus_async_find_dev(bsp_dev_id, BSP_BUS_TYPE_SPI),
+                                  BSP_BUS_ASYNC_OP_WRITE,
+                                  addr_buffer,
+                                  addr_length,
+                                  pad_len,
+                                  data_buffer,
+                                  data_length,
+                                  NULL,
+                                  NULL);
+}
+
+uint32_t bsp_bus_async_spi_throttle_speed(uint32_t speed_hz)
+{
+    // Transactions already queued complete at the current speed
+    bsp_bus_async_drain();
+
+    for (uint32_t i = 0; i < bsp_bus_async_num_devs; i++)
+    {
+        bsp_bus_async_devs[i].spi_cfg_throttled.frequency = MIN(speed_hz, bsp_bus_async_devs[i].spi_cfg.frequency);
+    }
+    bsp_bus_async_spi_throttled = true;
+
+    return BSP_STATUS_OK;
+}
+
+uint32_t bsp_bus_async_spi_restore_speed(void)
+{
+    bsp_bus_async_drain();
+    bsp_bus_async_spi_throttled = false;
+
+    return BSP_STATUS_OK;
+}
@@ -0,0 +1,169 @@
+/**
+ * @file bsp_bus_async.h
+ *
+ * @brief Functions and prototypes exported by the Zephyr asynchronous control port bus backend
+ *
+ * Implements the control port members of bsp_driver_if_t with the Zephyr callback-based asynchronous I2C and SPI
+ * APIs.  Transactions are copied into a queue of DMA buffers and submitted in order from the system work queue, so
+ * that the calling thread does not wait for the bus:
+ * - transactions with a bsp_callback_t complete through the callback
+ * - writes without a callback are posted, and any failure is reported by the next transaction that waits
+ * - reads without a callback, and transactions too large for a DMA buffer, wait for completion
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2022 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef BSP_BUS_ASYNC_H
+#define BSP_BUS_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/spi.h>
+#include "bsp_driver_if.h"
+
+/***********************************************************************************************************************
+ * LITERALS & CONSTANTS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * ENUMS, STRUCTS, UNIONS, TYPEDEFS
+ **********************************************************************************************************************/
+
+/**
+ * Control port device served by the asynchronous bus backend
+ *
+ * @see bsp_bus_async_initialize
+ */
+typedef struct
+{
+    uint32_t bsp_dev_id;                    ///< ID passed by the drivers, i.e. BSP_DUT_DEV_ID
+    uint8_t bus_type;                       ///< Control port bus type - @see BSP_BUS_TYPE_
+    const struct device *bus;               ///< I2C or SPI controller
+    uint16_t i2c_addr;                      ///< 7-bit I2C address, for BSP_BUS_TYPE_I2C
+    struct spi_config spi_cfg;              ///< SPI configuration, for BSP_BUS_TYPE_SPI
+
+    struct spi_config spi_cfg_throttled;    ///< Private - SPI configuration used after spi_throttle_speed
+    bool write_error;                       ///< Private - A posted write failed and has not yet been reported
+} bsp_bus_async_dev_t;
+
+/***********************************************************************************************************************
+ * GLOBAL VARIABLES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Initialize the asynchronous bus backend
+ *
+ * @param [in] devs             Array of control port devices, which must remain valid while the backend is in use
+ * @param [in] num_devs         Number of entries in devs
+ *
+ * @return
+ * - BSP_STATUS_FAIL            if devs is NULL, or if any bus controller is not ready
+ * - BSP_STATUS_OK              otherwise
+ *
+ */
+uint32_t bsp_bus_async_initialize(bsp_bus_async_dev_t *devs, uint32_t num_devs);
+
+/**
+ * Install the asynchronous bus backend in a BSP-to-Driver API implementation
+ *
+ * Replaces the I2C and SPI members of bsp_if.  Since writes may be posted, set_timer and set_gpio are wrapped so that
+ * all queued transactions complete before a delay is started or a GPIO is changed, i.e. in the reset and boot
+ * sequences of the drivers.
+ *
+ * @param [in] bsp_if           Pointer to the BSP-to-Driver API implementation, i.e. bsp_driver_if_g
+ *
+ * @return
+ * - BSP_STATUS_FAIL            if bsp_if is NULL
+ * - BSP_STATUS_OK              otherwise
+ *
+ */
+uint32_t bsp_bus_async_attach(bsp_driver_if_t *bsp_if);
+
+/**
+ * Wait for all queued transactions to complete
+ *
+ * @return
+ * - BSP_STATUS_FAIL            if a posted write to any device failed since the last transaction to that device that
+ *                              waited
+ * - BSP_STATUS_OK              otherwise
+ *
+ */
+uint32_t bsp_bus_async_flush(void);
+
+/**
+ * BSP-to-Driver control port implementations
+ *
+ * @see bsp_driver_if_t
+ *
+ * Callbacks are called from the completion context of the bus controller driver, which may be an ISR, or from the
+ * backend's work queue thread.  Transactions made from a callback must not need to wait for completion, i.e. must be
+ * writes with a callback or posted writes, otherwise they return BSP_STATUS_FAIL.
+ *
+ */
+uint32_t bsp_bus_async_i2c_reset(uint32_t bsp_dev_id, bool *was_i2c_busy);
+uint32_t bsp_bus_async_i2c_read_repeated_start(uint32_t bsp_dev_id,
+                                               uint8_t *write_buffer,
+                                               uint32_t write_length,
+                                               uint8_t *read_buffer,
+                                               uint32_t read_length,
+                                               bsp_callback_t cb,
+                                               void *cb_arg);
+uint32_t bsp_bus_async_i2c_write(uint32_t bsp_dev_id,
+                                 uint8_t *write_buffer,
+                                 uint32_t write_length,
+                                 bsp_callback_t cb,
+                                 void *cb_arg);
+uint32_t bsp_bus_async_i2c_db_write(uint32_t bsp_dev_id,
+                                    uint8_t *write_buffer_0,
+                                    uint32_t write_length_0,
+                                    uint8_t *write_buffer_1,
+                                    uint32_t write_length_1,
+                                    bsp_callback_t cb,
+                                    void *cb_arg);
+uint32_t bsp_bus_async_spi_read(uint32_t bsp_dev_id,
+                                uint8_t *addr_buffer,
+                                uint32_t addr_length,
+                                uint8_t *data_buffer,
+                                uint32_t data_length,
+                                uint32_t pad_len);
+uint32_t bsp_bus_async_spi_write(uint32_t bsp_dev_id,
+                                 uint8_t *addr_buffer,
+                                 uint32_t addr_length,
+                                 uint8_t *data_buffer,
+                                 uint32_t data_length,
+                                 uint32_t pad_len);
+uint32_t bsp_bus_async_spi_throttle_speed(uint32_t speed_hz);
+uint32_t bsp_bus_async_spi_restore_speed(void);
+
+/**********************************************************************************************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BSP_BUS_ASYNC_H
@@ -0,0 +1,354 @@
+/**
+ * @file power_policy.c
+ *
+ * @brief The hibernation residency manager
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2021 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "power_policy.h"
+
+/***********************************************************************************************************************
+ * LOCAL LITERAL SUBSTITUTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Check if time 'a' is at or after time 'b', allowing for wrap of the millisecond time
+ */
+#define POWER_POLICY_TIME_AFTER_EQ(a, b)    ((int32_t) ((a) - (b)) >= 0)
+
+/***********************************************************************************************************************
+ * LOCAL VARIABLES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * GLOBAL VARIABLES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Add the time spent in the current power state to the residency statistics
+ *
+ * @param [in] pp               Pointer to the power policy state
+ * @param [in] now              Current time in ms
+ *
+ * @return none
+ *
+ */
+static void power_policy_update_residency(power_policy_t *pp, uint32_t now)
+{
+    uint32_t elapsed = now - pp->state_start;
+
+    if (pp->state == POWER_POLICY_STATE_HIBERNATE)
+    {
+        pp->stats.hibernate_ms += elapsed;
+    }
+    else
+    {
+        pp->stats.awake_ms += elapsed;
+    }
+
+    pp->state_start = now;
+}
+
+/**
+ * Hibernate the device
+ *
+ * @param [in] pp               Pointer to the power policy state
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if the driver power function fails
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+static uint32_t power_policy_hibernate(power_policy_t *pp)
+{
+    uint32_t ret;
+
+    ret = pp->config.power(pp->config.arg, pp->config.power_hibernate);
+    if (ret)
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    power_policy_update_residency(pp, pp->config.get_time_ms());
+    pp->state = POWER_POLICY_STATE_HIBERNATE;
+    pp->prewoken = false;
+    pp->stats.hibernate_count++;
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/**
+ * Wake the device and measure the wake latency
+ *
+ * The time spent waking is counted as awake residency.
+ *
+ * @param [in] pp               Pointer to the power policy state
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if the driver power function fails
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+static uint32_t power_policy_wake(power_policy_t *pp)
+{
+    uint32_t ret, start, latency;
+
+    start = pp->config.get_time_ms();
+
+    ret = pp->config.power(pp->config.arg, pp->config.power_wake);
+    if (ret)
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    power_policy_update_residency(pp, start);
+    pp->state = POWER_POLICY_STATE_AWAKE;
+    pp->idle_start = pp->config.get_time_ms();
+
+    latency = pp->idle_start - start;
+    pp->stats.wake_count++;
+    pp->stats.wake_latency_last_ms = latency;
+    pp->stats.wake_latency_total_ms += latency;
+    if (latency > pp->stats.wake_latency_max_ms)
+    {
+        pp->stats.wake_latency_max_ms = latency;
+    }
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Initialize power policy state
+ *
+ */
+uint32_t power_policy_initialize(power_policy_t *pp)
+{
+    if (pp == NULL)
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    memset(pp, 0, sizeof(power_policy_t));
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/**
+ * Configure power policy
+ *
+ */
+uint32_t power_policy_configure(power_policy_t *pp, power_policy_config_t *config)
+{
+    if ((pp == NULL) || (config == NULL) || (config->power == NULL) || (config->get_time_ms == NULL))
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    pp->config = *config;
+    pp->state = POWER_POLICY_STATE_AWAKE;
+    pp->active_count = 0;
+    pp->prewake_pending = false;
+    pp->prewoken = false;
+    pp->idle_start = config->get_time_ms();
+    pp->state_start = pp->idle_start;
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/**
+ * Notify the power policy that audio or haptic activity is starting
+ *
+ */
+uint32_t power_policy_activity_start(power_policy_t *pp)
+{
+    uint32_t ret;
+
+    if ((pp == NULL) || (pp->config.get_time_ms == NULL))
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    pp->prewake_pending = false;
+
+    if (pp->state == POWER_POLICY_STATE_HIBERNATE)
+    {
+        ret = power_policy_wake(pp);
+        if (ret)
+        {
+            return ret;
+        }
+        pp->stats.late_wake_count++;
+    }
+    else if (pp->prewoken)
+    {
+        pp->stats.prewake_hit_count++;
+    }
+
+    pp->prewoken = false;
+    pp->active_count++;
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/**
+ * Notify the power policy that audio or haptic activity has stopped
+ *
+ */
+uint32_t power_policy_activity_stop(power_policy_t *pp)
+{
+    if ((pp == NULL) || (pp->config.get_time_ms == NULL) || (pp->active_count == 0))
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    pp->active_count--;
+    if (pp->active_count == 0)
+    {
+        pp->idle_start = pp->config.get_time_ms();
+    }
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/**
+ * Hint that activity is expected to start soon
+ *
+ */
+uint32_t power_policy_prewake(power_policy_t *pp, uint32_t activity_in_ms)
+{
+    uint32_t now, lead = 0;
+
+    if ((pp == NULL) || (pp->config.get_time_ms == NULL))
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    now = pp->config.get_time_ms();
+
+    // If already awake, stay awake until the idle threshold expires after the expected activity
+    if (pp->state == POWER_POLICY_STATE_AWAKE)
+    {
+        if ((pp->active_count == 0) && POWER_POLICY_TIME_AFTER_EQ(now + activity_in_ms, pp->idle_start))
+        {
+            pp->idle_start = now + activity_in_ms;
+        }
+
+        return POWER_POLICY_STATUS_OK;
+    }
+
+    // Start waking early enough for an average wake to complete before the expected activity
+    if (pp->stats.wake_count > 0)
+    {
+        lead = pp->stats.wake_latency_total_ms / pp->stats.wake_count;
+    }
+
+    pp->prewake_at = now + ((activity_in_ms > lead) ? (activity_in_ms - lead) : 0);
+    pp->prewake_pending = true;
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/**
+ * Process power policy
+ *
+ */
+uint32_t power_policy_process(power_policy_t *pp)
+{
+    uint32_t ret, now;
+
+    if ((pp == NULL) || (pp->config.get_time_ms == NULL))
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    now = pp->config.get_time_ms();
+
+    if (pp->state == POWER_POLICY_STATE_HIBERNATE)
+    {
+        if (pp->prewake_pending && POWER_POLICY_TIME_AFTER_EQ(now, pp->prewake_at))
+        {
+            pp->prewake_pending = false;
+
+            ret = power_policy_wake(pp);
+            if (ret)
+            {
+                return ret;
+            }
+
+            pp->prewoken = true;
+            pp->stats.prewake_count++;
+        }
+    }
+    else if ((pp->active_count == 0) && \
+             POWER_POLICY_TIME_AFTER_EQ(now, pp->idle_start + pp->config.idle_threshold_ms))
+    {
+        ret = power_policy_hibernate(pp);
+        if (ret)
+        {
+            return ret;
+        }
+    }
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/**
+ * Get residency and wake latency statistics
+ *
+ */
+uint32_t power_policy_get_stats(power_policy_t *pp, power_policy_stats_t *stats)
+{
+    if ((pp == NULL) || (stats == NULL) || (pp->config.get_time_ms == NULL))
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    power_policy_update_residency(pp, pp->config.get_time_ms());
+    *stats = pp->stats;
+
+    return POWER_POLICY_STATUS_OK;
+}
+
+/**
+ * Reset residency and wake latency statistics
+ *
+ */
+uint32_t power_policy_reset_stats(power_policy_t *pp)
+{
+    if ((pp == NULL) || (pp->config.get_time_ms == NULL))
+    {
+        return POWER_POLICY_STATUS_FAIL;
+    }
+
+    memset(&pp->stats, 0, sizeof(power_policy_stats_t));
+    pp->state_start = pp->config.get_time_ms();
+
+    return POWER_POLICY_STATUS_OK;
+}
@@ -0,0 +1,269 @@
+/**
+ * @file power_policy.h
+ *
+ * @brief
+ * Hibernation residency manager for the Cirrus Logic amplifier and haptic drivers.
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2021 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef POWER_POLICY_H
+#define POWER_POLICY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+ * LITERALS & CONSTANTS
+ **********************************************************************************************************************/
+
+/**
+ * @defgroup POWER_POLICY_STATUS_
+ * @brief Return values for all public API calls
+ *
+ * @{
+ */
+#define POWER_POLICY_STATUS_OK              (0)
+#define POWER_POLICY_STATUS_FAIL            (1)
+/** @} */
+
+/**
+ * @defgroup POWER_POLICY_STATE_
+ * @brief Power state of the managed device
+ *
+ * @{
+ */
+#define POWER_POLICY_STATE_AWAKE            (0)
+#define POWER_POLICY_STATE_HIBERNATE        (1)
+/** @} */
+
+/***********************************************************************************************************************
+ * ENUMS, STRUCTS, UNIONS, TYPEDEFS
+ **********************************************************************************************************************/
+
+/**
+ * Function to change the power state of the managed device
+ *
+ * The driver power() APIs take a typed driver handle, so must not be cast to this type.  Instead, pass a wrapper that
+ * casts arg back to the driver handle, e.g. for CS35L41:
+ *
+ *     static uint32_t app_cs35l41_power(void *arg, uint32_t power_state)
+ *     {
+ *         return cs35l41_power((cs35l41_t *) arg, power_state);
+ *     }
+ */
+typedef uint32_t (*power_policy_power_t)(void *arg, uint32_t power_state);
+
+/**
+ * Function returning a free-running millisecond time, allowed to wrap
+ */
+typedef uint32_t (*power_policy_get_time_t)(void);
+
+/**
+ * Power policy configuration
+ *
+ * @see power_policy_configure
+ */
+typedef struct
+{
+    void *arg;                              ///< Argument passed to power, i.e. the driver handle
+    power_policy_power_t power;             ///< Wrapper for the driver power function
+    uint32_t power_hibernate;               ///< power_state passed to power to hibernate, i.e. CS35L41_POWER_HIBERNATE
+    uint32_t power_wake;                    ///< power_state passed to power to wake, i.e. CS35L41_POWER_WAKE
+    power_policy_get_time_t get_time_ms;    ///< Millisecond time source
+    uint32_t idle_threshold_ms;             ///< Idle time after which the device is hibernated
+} power_policy_config_t;
+
+/**
+ * Residency and wake latency statistics
+ *
+ * @see power_policy_get_stats
+ */
+typedef struct
+{
+    uint32_t awake_ms;                      ///< Total time spent awake
+    uint32_t hibernate_ms;                  ///< Total time spent in hibernate
+    uint32_t hibernate_count;               ///< Number of times the device was hibernated
+    uint32_t wake_count;                    ///< Number of times the device was woken
+    uint32_t prewake_count;                 ///< Number of wakes started by a pre-wake hint
+    uint32_t prewake_hit_count;             ///< Number of pre-wakes followed by activity before the device hibernated
+    uint32_t late_wake_count;               ///< Number of wakes started by activity, i.e. on the critical path
+    uint32_t wake_latency_last_ms;          ///< Duration of the last wake
+    uint32_t wake_latency_max_ms;           ///< Longest wake
+    uint32_t wake_latency_total_ms;         ///< Sum of all wake durations, for computing the average
+} power_policy_stats_t;
+
+/**
+ * Power policy state
+ *
+ * One instance manages one device.  All API calls for an instance must be made from the same context.
+ */
+typedef struct
+{
+    power_policy_config_t config;
+
+    uint32_t state;                         ///< Current power state - @see POWER_POLICY_STATE_
+    uint32_t active_count;                  ///< Number of activities started and not yet stopped
+    uint32_t idle_start;                    ///< Time at which the device last became idle
+    uint32_t state_start;                   ///< Time of the last power state change or statistics update
+    bool prewake_pending;                   ///< (True) A pre-wake is scheduled for prewake_at
+    uint32_t prewake_at;                    ///< Time at which to start the scheduled pre-wake
+    bool prewoken;                          ///< (True) The device is awake due to a pre-wake with no activity yet
+
+    power_policy_stats_t stats;
+} power_policy_t;
+
+/***********************************************************************************************************************
+ * GLOBAL VARIABLES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+
+/**
+ * Initialize power policy state
+ *
+ * Sets all power policy state members to 0.
+ *
+ * @param [in] pp               Pointer to the power policy state
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if pointer to pp is NULL
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+uint32_t power_policy_initialize(power_policy_t *pp);
+
+/**
+ * Configure power policy
+ *
+ * The device is assumed to be awake and idle when configured, i.e. after the driver boot and power up sequence.
+ *
+ * @param [in] pp               Pointer to the power policy state
+ * @param [in] config           Pointer to the power policy configuration
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if any pointer is NULL
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+uint32_t power_policy_configure(power_policy_t *pp, power_policy_config_t *config);
+
+/**
+ * Notify the power policy that audio or haptic activity is starting
+ *
+ * If the device is in hibernate it is woken before returning, which puts the wake latency on the critical path and is
+ * counted in late_wake_count.  Calls may be nested with power_policy_activity_stop.
+ *
+ * @param [in] pp               Pointer to the power policy state
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if pp is NULL or not configured, or if waking the device fails
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+uint32_t power_policy_activity_start(power_policy_t *pp);
+
+/**
+ * Notify the power policy that audio or haptic activity has stopped
+ *
+ * The idle threshold is timed from the last call that leaves no activity outstanding.
+ *
+ * @param [in] pp               Pointer to the power policy state
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if pp is NULL or not configured, or if there is no activity outstanding
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+uint32_t power_policy_activity_stop(power_policy_t *pp);
+
+/**
+ * Hint that activity is expected to start soon
+ *
+ * Schedules a wake so that it completes by the time activity is expected, using the average wake latency measured so
+ * far.  The wake is done from power_policy_process, so the application can overlap it with its own work before
+ * calling power_policy_activity_start.  If no activity follows, the device hibernates again once the idle threshold
+ * expires after the wake.
+ *
+ * @param [in] pp               Pointer to the power policy state
+ * @param [in] activity_in_ms   Time until activity is expected to start, or 0 to wake on the next call to
+ *                              power_policy_process
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if pp is NULL
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+uint32_t power_policy_prewake(power_policy_t *pp, uint32_t activity_in_ms);
+
+/**
+ * Process power policy
+ *
+ * Starts any scheduled pre-wake that is due, and hibernates the device once it has been idle for the configured
+ * threshold.  Should be called periodically from the same context as the driver process() API, with a period well
+ * below idle_threshold_ms.
+ *
+ * @param [in] pp               Pointer to the power policy state
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if pp is NULL or not configured, or if changing the device power state fails
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+uint32_t power_policy_process(power_policy_t *pp);
+
+/**
+ * Get residency and wake latency statistics
+ *
+ * Residency includes the time spent in the current state up to the call.
+ *
+ * @param [in] pp               Pointer to the power policy state
+ * @param [out] stats           Pointer to the statistics
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if any pointer is NULL
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+uint32_t power_policy_get_stats(power_policy_t *pp, power_policy_stats_t *stats);
+
+/**
+ * Reset residency and wake latency statistics
+ *
+ * @param [in] pp               Pointer to the power policy state
+ *
+ * @return
+ * - POWER_POLICY_STATUS_FAIL   if pp is NULL
+ * - POWER_POLICY_STATUS_OK     otherwise
+ *
+ */
+uint32_t power_policy_reset_stats(power_policy_t *pp);
+
+/**********************************************************************************************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POWER_POLICY_H
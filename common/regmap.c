@@ -29,6 +29,11 @@
  * LOCAL LITERAL SUBSTITUTIONS
  **********************************************************************************************************************/
 
+/**
+ * BSP bus type to arbitrate for a control port configuration
+ */
+#define REGMAP_BSP_BUS_TYPE(A)      (((A)->bus_type == REGMAP_BUS_TYPE_I2C) ? BSP_BUS_TYPE_I2C : BSP_BUS_TYPE_SPI)
+
 /***********************************************************************************************************************
  * MACROS
  **********************************************************************************************************************/
@@ -97,6 +102,136 @@ static uint32_t regmap_virtual_write(regmap_cp_config_t *cp, uint32_t addr, uint
     return ret;
 }
 
+/**
+ * Lock the control port bus, if the BSP arbitrates bus access
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] priority         Priority of the request - @see BSP_BUS_PRIORITY_
+ *
+ * @return
+ * - BSP_STATUS_FAIL            if the call to BSP failed
+ * - BSP_STATUS_OK              otherwise
+ *
+ */
+static uint32_t regmap_bus_lock(regmap_cp_config_t *cp, uint8_t priority)
+{
+    if ((cp->bus_type == REGMAP_BUS_TYPE_VIRTUAL) || (bsp_driver_if_g->bus_lock == NULL))
+    {
+        return BSP_STATUS_OK;
+    }
+
+    return bsp_driver_if_g->bus_lock(cp->dev_id, REGMAP_BSP_BUS_TYPE(cp), priority);
+}
+
+/**
+ * Unlock the control port bus, if the BSP arbitrates bus access
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ *
+ * @return
+ * - BSP_STATUS_FAIL            if the call to BSP failed
+ * - BSP_STATUS_OK              otherwise
+ *
+ */
+static uint32_t regmap_bus_unlock(regmap_cp_config_t *cp)
+{
+    if ((cp->bus_type == REGMAP_BUS_TYPE_VIRTUAL) || (bsp_driver_if_g->bus_unlock == NULL))
+    {
+        return BSP_STATUS_OK;
+    }
+
+    return bsp_driver_if_g->bus_unlock(cp->dev_id, REGMAP_BSP_BUS_TYPE(cp));
+}
+
+/**
+ * Look up the addresses of a list of firmware controls and sort them into address order
+ *
+ * The symbol table is scanned once for the whole list, rather than once per control.  The sort is stable, so if a
+ * symbol_id is in the list more than once, its accesses stay in list order.
+ *
+ * @param [in] f                Pointer to fw_img_info struct
+ * @param [in] symbol_ids       Pointer to the first symbol_id
+ * @param [in] stride           Number of words from one symbol_id to the next
+ * @param [in] count            Number of symbol_ids
+ * @param [out] addrs           Address of each symbol_id, in list order
+ * @param [out] order           List indices sorted by address
+ * @param [out] failed_symbol_id    Set to the first symbol_id not found - may be NULL
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL         if f is NULL, or if any symbol_id is not in the symbol table
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+static uint32_t regmap_find_fw_controls(fw_img_info_t *f,
+                                        const uint32_t *symbol_ids,
+                                        uint32_t stride,
+                                        uint32_t count,
+                                        uint32_t *addrs,
+                                        uint8_t *order,
+                                        uint32_t *failed_symbol_id)
+{
+    uint32_t i, j;
+
+    if (f == NULL)
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        addrs[i] = 0;
+    }
+
+    for (j = 0; j < f->header.sym_table_size; j++)
+    {
+        for (i = 0; i < count; i++)
+        {
+            if ((addrs[i] == 0) && (symbol_ids[i * stride] == f->sym_table[j].sym_id))
+            {
+                addrs[i] = f->sym_table[j].sym_addr;
+            }
+        }
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (addrs[i] == 0)
+        {
+            if (failed_symbol_id != NULL)
+            {
+                *failed_symbol_id = symbol_ids[i * stride];
+            }
+            return REGMAP_STATUS_FAIL;
+        }
+
+        // Insertion sort, as lists are short
+        for (j = i; (j > 0) && (addrs[order[j - 1]] > addrs[i]); j--)
+        {
+            order[j] = order[j - 1];
+        }
+        order[j] = (uint8_t) i;
+    }
+
+    return REGMAP_STATUS_OK;
+}
+
+/**
+ * Number of controls from a position in the sorted list that are at consecutive addresses
+ *
+ */
+static uint32_t regmap_fw_controls_run_length(uint32_t *addrs, uint8_t *order, uint32_t start, uint32_t count)
+{
+    uint32_t length = 1;
+
+    while (((start + length) < count) &&
+           (addrs[order[start + length]] == (addrs[order[start]] + (length * 4))))
+    {
+        length++;
+    }
+
+    return length;
+}
+
 /***********************************************************************************************************************
  * API FUNCTIONS
  **********************************************************************************************************************/
@@ -113,6 +248,11 @@ uint32_t regmap_read(regmap_cp_config_t *cp, uint32_t addr, uint32_t *val)
 
     *val = 0;
 
+    if (regmap_bus_lock(cp, cp->bus_priority))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
     // Currently only I2C and SPI transactions are supported
     switch (cp->bus_type)
     {
@@ -202,6 +342,11 @@ uint32_t regmap_read(regmap_cp_config_t *cp, uint32_t addr, uint32_t *val)
             break;
     }
 
+    if (regmap_bus_unlock(cp))
+    {
+        ret = REGMAP_STATUS_FAIL;
+    }
+
     if (ret)
     {
         ret = REGMAP_STATUS_FAIL;
@@ -223,6 +368,11 @@ uint32_t regmap_write(regmap_cp_config_t *cp, uint32_t addr, uint32_t val)
     uint32_t ret = REGMAP_STATUS_FAIL;
     uint8_t write_buffer[8];
 
+    if (regmap_bus_lock(cp, cp->bus_priority))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
     switch (cp->bus_type)
     {
         case REGMAP_BUS_TYPE_I2C:
@@ -299,6 +449,11 @@ uint32_t regmap_write(regmap_cp_config_t *cp, uint32_t addr, uint32_t val)
             break;
     }
 
+    if (regmap_bus_unlock(cp))
+    {
+        ret = REGMAP_STATUS_FAIL;
+    }
+
     if (ret)
     {
         ret = REGMAP_STATUS_FAIL;
@@ -320,22 +475,29 @@ uint32_t regmap_update_reg(regmap_cp_config_t *cp, uint32_t addr, uint32_t mask,
     uint32_t ret = REGMAP_STATUS_FAIL;
     uint32_t temp_val, data;
 
-    ret = regmap_read(cp, addr, &data);
-
-    if (ret)
+    // Hold the bus so that no other task can write the register between the read and the write
+    if (regmap_bus_lock(cp, cp->bus_priority))
     {
-        return ret;
+        return REGMAP_STATUS_FAIL;
     }
 
-    temp_val = data & ~(mask);
-    temp_val |= val;
+    ret = regmap_read(cp, addr, &data);
 
-    if (data == temp_val)
+    if (ret == REGMAP_STATUS_OK)
     {
-        return REGMAP_STATUS_OK;
+        temp_val = data & ~(mask);
+        temp_val |= val;
+
+        if (data != temp_val)
+        {
+            ret = regmap_write(cp, addr, temp_val);
+        }
     }
 
-    ret = regmap_write(cp, addr, temp_val);
+    if (regmap_bus_unlock(cp))
+    {
+        ret = REGMAP_STATUS_FAIL;
+    }
 
     return ret;
 }
@@ -416,6 +578,11 @@ uint32_t regmap_read_block(regmap_cp_config_t *cp, uint32_t addr, uint8_t *bytes
     uint32_t ret = REGMAP_STATUS_FAIL;
     uint8_t write_buffer[4];
 
+    if (regmap_bus_lock(cp, cp->bus_priority))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
     switch (cp->bus_type)
     {
         case REGMAP_BUS_TYPE_I2C:
@@ -459,6 +626,11 @@ uint32_t regmap_read_block(regmap_cp_config_t *cp, uint32_t addr, uint8_t *bytes
             break;
     }
 
+    if (regmap_bus_unlock(cp))
+    {
+        ret = REGMAP_STATUS_FAIL;
+    }
+
     if (ret)
     {
         ret = REGMAP_STATUS_FAIL;
@@ -480,6 +652,11 @@ uint32_t regmap_write_block(regmap_cp_config_t *cp, uint32_t addr, uint8_t *byte
     uint32_t ret = REGMAP_STATUS_FAIL;
     uint8_t write_buffer[4];
 
+    if (regmap_bus_lock(cp, cp->bus_priority))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
     switch (cp->bus_type)
     {
         case REGMAP_BUS_TYPE_I2C:
@@ -520,6 +697,11 @@ uint32_t regmap_write_block(regmap_cp_config_t *cp, uint32_t addr, uint8_t *byte
             break;
     }
 
+    if (regmap_bus_unlock(cp))
+    {
+        ret = REGMAP_STATUS_FAIL;
+    }
+
     if (ret)
     {
         ret = REGMAP_STATUS_FAIL;
@@ -532,32 +714,215 @@ uint32_t regmap_write_block(regmap_cp_config_t *cp, uint32_t addr, uint8_t *byte
     return ret;
 }
 
+/**
+ * Reads a consecutive number of 32-bit registers into a word array
+ *
+ */
+uint32_t regmap_read_words(regmap_cp_config_t *cp, uint32_t addr, uint32_t *vals, uint32_t count)
+{
+    uint32_t ret;
+    uint8_t *bytes = (uint8_t *) vals;
+
+    if (count == 0)
+    {
+        return REGMAP_STATUS_OK;
+    }
+
+    // Virtual and 16-bit registers cannot be read as packed big-endian words, so read them one at a time
+    if ((cp->bus_type == REGMAP_BUS_TYPE_VIRTUAL) ||
+        ((cp->bus_type == REGMAP_BUS_TYPE_SPI_3000) && (addr < 0x3000)))
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            ret = regmap_read(cp, addr + (i * 4), &(vals[i]));
+            if (ret)
+            {
+                return REGMAP_STATUS_FAIL;
+            }
+        }
+
+        return REGMAP_STATUS_OK;
+    }
+
+    ret = regmap_read_block(cp, addr, bytes, count * 4);
+    if (ret)
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    // Convert in place from bus (big-endian) byte order
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t temp_val = 0;
+
+        ADD_BYTE_TO_WORD(temp_val, bytes[(i * 4)], 3);
+        ADD_BYTE_TO_WORD(temp_val, bytes[(i * 4) + 1], 2);
+        ADD_BYTE_TO_WORD(temp_val, bytes[(i * 4) + 2], 1);
+        ADD_BYTE_TO_WORD(temp_val, bytes[(i * 4) + 3], 0);
+        vals[i] = temp_val;
+    }
+
+    return REGMAP_STATUS_OK;
+}
+
+/**
+ * Writes a word array to a consecutive number of 32-bit registers
+ *
+ */
+uint32_t regmap_write_words(regmap_cp_config_t *cp, uint32_t addr, uint32_t *vals, uint32_t count)
+{
+    uint32_t ret;
+    uint8_t write_buffer[REGMAP_WORDS_MAX * 4];
+
+    // Virtual and 16-bit registers cannot be written as packed big-endian words, so write them one at a time
+    if ((cp->bus_type == REGMAP_BUS_TYPE_VIRTUAL) ||
+        ((cp->bus_type == REGMAP_BUS_TYPE_SPI_3000) && (addr < 0x3000)))
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            ret = regmap_write(cp, addr + (i * 4), vals[i]);
+            if (ret)
+            {
+                return REGMAP_STATUS_FAIL;
+            }
+        }
+
+        return REGMAP_STATUS_OK;
+    }
+
+    while (count > 0)
+    {
+        uint32_t chunk = (count > REGMAP_WORDS_MAX) ? REGMAP_WORDS_MAX : count;
+
+        for (uint32_t i = 0; i < chunk; i++)
+        {
+            write_buffer[(i * 4)] = GET_BYTE_FROM_WORD(vals[i], 3);
+            write_buffer[(i * 4) + 1] = GET_BYTE_FROM_WORD(vals[i], 2);
+            write_buffer[(i * 4) + 2] = GET_BYTE_FROM_WORD(vals[i], 1);
+            write_buffer[(i * 4) + 3] = GET_BYTE_FROM_WORD(vals[i], 0);
+        }
+
+        ret = regmap_write_block(cp, addr, write_buffer, chunk * 4);
+        if (ret)
+        {
+            return REGMAP_STATUS_FAIL;
+        }
+
+        addr += chunk * 4;
+        vals += chunk;
+        count -= chunk;
+    }
+
+    return REGMAP_STATUS_OK;
+}
+
+/**
+ * Reads selected registers from a consecutive range, coalescing adjacent registers into block reads
+ *
+ */
+uint32_t regmap_read_words_masked(regmap_cp_config_t *cp,
+                                  uint32_t addr,
+                                  uint32_t *vals,
+                                  uint32_t count,
+                                  uint32_t word_mask)
+{
+    uint32_t i = 0;
+
+    if (count > REGMAP_WORDS_MAX)
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    while (i < count)
+    {
+        uint32_t start = i;
+
+        if (!(word_mask & ((uint32_t) 1 << i)))
+        {
+            i++;
+            continue;
+        }
+
+        while ((i < count) && (word_mask & ((uint32_t) 1 << i)))
+        {
+            i++;
+        }
+
+        if (regmap_read_words(cp, addr + (start * 4), &(vals[start]), i - start))
+        {
+            return REGMAP_STATUS_FAIL;
+        }
+    }
+
+    return REGMAP_STATUS_OK;
+}
+
+/**
+ * Writes selected registers in a consecutive range, coalescing adjacent registers into block writes
+ *
+ */
+uint32_t regmap_write_words_masked(regmap_cp_config_t *cp,
+                                   uint32_t addr,
+                                   uint32_t *vals,
+                                   uint32_t count,
+                                   uint32_t word_mask)
+{
+    uint32_t i = 0;
+
+    if (count > REGMAP_WORDS_MAX)
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    while (i < count)
+    {
+        uint32_t start = i;
+
+        if (!(word_mask & ((uint32_t) 1 << i)))
+        {
+            i++;
+            continue;
+        }
+
+        while ((i < count) && (word_mask & ((uint32_t) 1 << i)))
+        {
+            i++;
+        }
+
+        if (regmap_write_words(cp, addr + (start * 4), &(vals[start]), i - start))
+        {
+            return REGMAP_STATUS_FAIL;
+        }
+    }
+
+    return REGMAP_STATUS_OK;
+}
+
 /**
  * Writes a value in a list to corresponding address. Data can be encoded to perform specific operations.
  *
  */
 uint32_t regmap_write_array(regmap_cp_config_t *cp, uint32_t * array, uint32_t array_len)
 {
-    uint32_t ret;
-    for (uint32_t i = 0; i < array_len;)
+    uint32_t ret = REGMAP_STATUS_OK;
+
+    // Hold the bus for the whole array, i.e. for test key unlock, writes and test key lock sequences
+    if (regmap_bus_lock(cp, cp->bus_priority))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    for (uint32_t i = 0; (i < array_len) && (ret == REGMAP_STATUS_OK);)
     {
         switch (array[i])
         {
             case REGMAP_ARRAY_RMODW:
                 ret = regmap_update_reg(cp, array[i + 1], array[i + 3], array[i + 2]);
-                if (ret)
-                {
-                    return REGMAP_STATUS_FAIL;
-                }
                 i += 4;
                 break;
 
             case REGMAP_ARRAY_BLOCK_WRITE:
                 ret = regmap_write_block(cp, array[i + 1], (uint8_t *) &array[i + 3], array[i + 2] * 4);
-                if (ret)
-                {
-                    return REGMAP_STATUS_FAIL;
-                }
                 i += array[i + 2] + 3;
                 break;
 
@@ -568,15 +933,17 @@ uint32_t regmap_write_array(regmap_cp_config_t *cp, uint32_t * array, uint32_t a
 
             default:
                 ret = regmap_write(cp, array[i], array[i + 1]);
-                if (ret)
-                {
-                    return REGMAP_STATUS_FAIL;
-                }
                 i += 2;
                 break;
         }
     }
-    return REGMAP_STATUS_OK;
+
+    if (regmap_bus_unlock(cp))
+    {
+        ret = REGMAP_STATUS_FAIL;
+    }
+
+    return ret;
 }
 
 /**
@@ -743,3 +1110,189 @@ uint32_t regmap_write_fw_vals(regmap_cp_config_t *cp,
 
     return REGMAP_STATUS_OK;
 }
+
+/**
+ * Writes a list of firmware controls
+ *
+ */
+uint32_t regmap_write_fw_controls(regmap_cp_config_t *cp,
+                                  fw_img_info_t *f,
+                                  const uint32_t *controls,
+                                  uint32_t count,
+                                  uint32_t *failed_symbol_id)
+{
+    uint32_t ret = REGMAP_STATUS_OK;
+    uint32_t addrs[REGMAP_FW_CONTROLS_MAX];
+    uint32_t vals[REGMAP_FW_CONTROLS_MAX];
+    uint8_t order[REGMAP_FW_CONTROLS_MAX];
+    uint32_t length;
+
+    if (count > REGMAP_FW_CONTROLS_MAX)
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    // Resolve every control before writing any, so an unknown symbol_id leaves the firmware untouched
+    if (regmap_find_fw_controls(f, controls, 2, count, addrs, order, failed_symbol_id))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    if (regmap_bus_lock(cp, cp->bus_priority))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    for (uint32_t i = 0; (i < count) && (ret == REGMAP_STATUS_OK); i += length)
+    {
+        length = regmap_fw_controls_run_length(addrs, order, i, count);
+
+        for (uint32_t j = 0; j < length; j++)
+        {
+            vals[j] = controls[(order[i + j] * 2) + 1];
+        }
+
+        if (length == 1)
+        {
+            ret = regmap_write(cp, addrs[order[i]], vals[0]);
+        }
+        else
+        {
+            ret = regmap_write_words(cp, addrs[order[i]], vals, length);
+        }
+
+        if ((ret != REGMAP_STATUS_OK) && (failed_symbol_id != NULL))
+        {
+            *failed_symbol_id = controls[order[i] * 2];
+        }
+    }
+
+    if (regmap_bus_unlock(cp))
+    {
+        ret = REGMAP_STATUS_FAIL;
+    }
+
+    return (ret == REGMAP_STATUS_OK) ? REGMAP_STATUS_OK : REGMAP_STATUS_FAIL;
+}
+
+/**
+ * Reads a list of firmware controls
+ *
+ */
+uint32_t regmap_read_fw_controls(regmap_cp_config_t *cp,
+                                 fw_img_info_t *f,
+                                 const uint32_t *symbol_ids,
+                                 uint32_t *vals,
+                                 uint32_t count,
+                                 uint32_t *failed_symbol_id)
+{
+    uint32_t ret = REGMAP_STATUS_OK;
+    uint32_t addrs[REGMAP_FW_CONTROLS_MAX];
+    uint32_t run_vals[REGMAP_FW_CONTROLS_MAX];
+    uint8_t order[REGMAP_FW_CONTROLS_MAX];
+    uint32_t length;
+
+    if (count > REGMAP_FW_CONTROLS_MAX)
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    if (regmap_find_fw_controls(f, symbol_ids, 1, count, addrs, order, failed_symbol_id))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    if (regmap_bus_lock(cp, cp->bus_priority))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    for (uint32_t i = 0; (i < count) && (ret == REGMAP_STATUS_OK); i += length)
+    {
+        length = regmap_fw_controls_run_length(addrs, order, i, count);
+
+        if (length == 1)
+        {
+            ret = regmap_read(cp, addrs[order[i]], &(run_vals[0]));
+        }
+        else
+        {
+            ret = regmap_read_words(cp, addrs[order[i]], run_vals, length);
+        }
+
+        if (ret != REGMAP_STATUS_OK)
+        {
+            if (failed_symbol_id != NULL)
+            {
+                *failed_symbol_id = symbol_ids[order[i]];
+            }
+            break;
+        }
+
+        for (uint32_t j = 0; j < length; j++)
+        {
+            vals[order[i + j]] = run_vals[j];
+        }
+    }
+
+    if (regmap_bus_unlock(cp))
+    {
+        ret = REGMAP_STATUS_FAIL;
+    }
+
+    return (ret == REGMAP_STATUS_OK) ? REGMAP_STATUS_OK : REGMAP_STATUS_FAIL;
+}
+
+/**
+ * Lock the control port bus for a sequence of transactions
+ *
+ */
+uint32_t regmap_lock(regmap_cp_config_t *cp, uint8_t priority)
+{
+    if (regmap_bus_lock(cp, priority))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    return REGMAP_STATUS_OK;
+}
+
+/**
+ * Unlock the control port bus after a sequence of transactions
+ *
+ */
+uint32_t regmap_unlock(regmap_cp_config_t *cp)
+{
+    if (regmap_bus_unlock(cp))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    return REGMAP_STATUS_OK;
+}
+
+/**
+ * Set the SPI clock speed for a change in the power/clocking state of the device
+ *
+ */
+uint32_t regmap_set_clock_state(regmap_cp_config_t *cp, uint8_t clock_state)
+{
+    if (clock_state >= BSP_CLOCK_STATE_TOTAL)
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    if (((cp->bus_type != REGMAP_BUS_TYPE_SPI) && (cp->bus_type != REGMAP_BUS_TYPE_SPI_3000)) ||
+        (cp->spi_max_speed_hz == NULL) ||
+        (bsp_driver_if_g->spi_set_max_speed == NULL))
+    {
+        return REGMAP_STATUS_OK;
+    }
+
+    if (bsp_driver_if_g->spi_set_max_speed(cp->dev_id, cp->spi_max_speed_hz[clock_state]))
+    {
+        return REGMAP_STATUS_FAIL;
+    }
+
+    return REGMAP_STATUS_OK;
+}
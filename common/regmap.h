@@ -81,6 +81,20 @@ extern "C" {
 #define REGMAP_ARRAY_DELAY                 (0x80000003)
 /** @} */
 
+/**
+ * Maximum number of 32-bit words handled by a single masked transfer, and the size in words of the staging buffer used
+ * by regmap_write_words
+ *
+ * @see regmap_read_words_masked
+ * @see regmap_write_words_masked
+ */
+#define REGMAP_WORDS_MAX                   (32)
+
+/**
+ * Maximum number of firmware controls in a single call to regmap_write_fw_controls or regmap_read_fw_controls
+ */
+#define REGMAP_FW_CONTROLS_MAX             (REGMAP_WORDS_MAX)
+
 /***********************************************************************************************************************
  * MACROS
  **********************************************************************************************************************/
@@ -103,6 +117,8 @@ typedef struct
     uint8_t bus_type;                                   ///< Control Port type - I2C or SPI
     uint16_t receive_max;                               ///< Number of bytes available in receive buffer
     uint32_t spi_pad_len;                               ///< Number of bytes to pad for SPI transactions
+    uint8_t bus_priority;                               ///< Bus arbitration priority - @see BSP_BUS_PRIORITY_
+    const uint32_t *spi_max_speed_hz;                   ///< Fastest SPI clock in each BSP_CLOCK_STATE_, or NULL
 } regmap_cp_config_t;
 
 typedef uint32_t (*regmap_vread_t)(void *self, uint32_t *val);
@@ -160,7 +176,8 @@ uint32_t regmap_write(regmap_cp_config_t *cp, uint32_t addr, uint32_t val);
 /**
  * Read-Modify-Write of register using 32-bit mask
  *
- * The main purpose is to handle buffering and BSP calls required for RMW a single memory address.
+ * The main purpose is to handle buffering and BSP calls required for RMW a single memory address.  The bus is held
+ * from the read to the write.
  *
  * @param [in] cp               Pointer to the BSP control port configuration
  * @param [in] addr             32-bit address to be read
@@ -246,9 +263,96 @@ uint32_t regmap_read_block(regmap_cp_config_t *cp, uint32_t addr, uint8_t *bytes
  */
 uint32_t regmap_write_block(regmap_cp_config_t *cp, uint32_t addr, uint8_t *bytes, uint32_t length);
 
+/**
+ * Reads a consecutive number of 32-bit registers into a word array
+ *
+ * All registers are read with a single call to regmap_read_block and converted to host word order, so that a range of
+ * status/mask registers can be snapshot in one bus transaction.  For virtual register files and 16-bit registers,
+ * each register is read individually.
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] addr             32-bit address of first register
+ * @param [out] vals            Pointer to array of words to hold register values
+ * @param [in] count            Number of registers to read
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL         if the call to BSP failed
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_read_words(regmap_cp_config_t *cp, uint32_t addr, uint32_t *vals, uint32_t count);
+
+/**
+ * Writes a word array to a consecutive number of 32-bit registers
+ *
+ * Words are staged in bus byte order and written with a call to regmap_write_block for every REGMAP_WORDS_MAX words.
+ * For virtual register files and 16-bit registers, each register is written individually.
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] addr             32-bit address of first register
+ * @param [in] vals             Pointer to array of words to write
+ * @param [in] count            Number of registers to write
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL         if the call to BSP failed
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_write_words(regmap_cp_config_t *cp, uint32_t addr, uint32_t *vals, uint32_t count);
+
+/**
+ * Reads selected registers from a consecutive range, coalescing adjacent registers into block reads
+ *
+ * Bit n of \b word_mask selects the register at (addr + 4n).  Each run of adjacent selected registers is read with one
+ * call to regmap_read_words.  Entries of \b vals for unselected registers are left unchanged.
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] addr             32-bit address of first register in range
+ * @param [out] vals            Pointer to array of words to hold register values
+ * @param [in] count            Number of registers in range, at most REGMAP_WORDS_MAX
+ * @param [in] word_mask        Bitmask of registers in range to read
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL         if the call to BSP failed, or if 'count' exceeds REGMAP_WORDS_MAX
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_read_words_masked(regmap_cp_config_t *cp,
+                                  uint32_t addr,
+                                  uint32_t *vals,
+                                  uint32_t count,
+                                  uint32_t word_mask);
+
+/**
+ * Writes selected registers in a consecutive range, coalescing adjacent registers into block writes
+ *
+ * Bit n of \b word_mask selects the register at (addr + 4n).  Each run of adjacent selected registers is written with
+ * one call to regmap_write_words.  This is used to clear write-1-to-clear flags in a snapshot of IRQ status registers
+ * without touching registers that have no flags to clear.
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] addr             32-bit address of first register in range
+ * @param [in] vals             Pointer to array of words to write
+ * @param [in] count            Number of registers in range, at most REGMAP_WORDS_MAX
+ * @param [in] word_mask        Bitmask of registers in range to write
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL         if the call to BSP failed, or if 'count' exceeds REGMAP_WORDS_MAX
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_write_words_masked(regmap_cp_config_t *cp,
+                                   uint32_t addr,
+                                   uint32_t *vals,
+                                   uint32_t count,
+                                   uint32_t word_mask);
+
 /**
  * Writes a value in a list to corresponding address. Data can be encoded to perform specific operations.
  *
+ * The bus is held for the whole array, including any REGMAP_ARRAY_DELAY, so that sequences such as test key unlock,
+ * writes and test key lock are not interleaved with transactions from other tasks.
+ *
  * @param [in] cp               Pointer to the BSP control port configuration
  * @param [in] array            Pointer to value list.
  * @param [in] array_len        Size of array list.
@@ -377,6 +481,112 @@ uint32_t regmap_write_fw_vals(regmap_cp_config_t *cp,
                               uint32_t *val,
                               uint32_t size);
 
+/**
+ * Writes a list of firmware controls
+ *
+ * All symbol_ids are looked up in a single pass over the symbol table before anything is written, so an unknown
+ * symbol_id writes nothing.  The controls are then written in address order, with controls at consecutive addresses
+ * merged into a single block write, so the order of writes to different controls is not the order of the list.  Use
+ * separate calls where the order matters, i.e. when writing a control that tells the firmware to act on others.  The
+ * bus is held for the whole list.
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] f                Pointer to fw_img_info struct
+ * @param [in] controls         Pointer to list of symbol_id and value pairs
+ * @param [in] count            Number of pairs in controls, up to REGMAP_FW_CONTROLS_MAX
+ * @param [out] failed_symbol_id    Set to the first symbol_id not found, or in the first write that failed - may be
+ *                                  NULL
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL if:
+ *      - count is greater than REGMAP_FW_CONTROLS_MAX
+ *      - any symbol_id is not in the symbol table
+ *      - the call to BSP failed
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_write_fw_controls(regmap_cp_config_t *cp,
+                                  fw_img_info_t *f,
+                                  const uint32_t *controls,
+                                  uint32_t count,
+                                  uint32_t *failed_symbol_id);
+
+/**
+ * Reads a list of firmware controls
+ *
+ * Looks up and reads the controls as regmap_write_fw_controls writes them, with controls at consecutive addresses read
+ * in a single block read.  vals[i] is the value of symbol_ids[i], so vals can be i.e. the words of a status struct.
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] f                Pointer to fw_img_info struct
+ * @param [in] symbol_ids       Pointer to list of symbol_ids
+ * @param [out] vals            Pointer to list of values read, in the same order as symbol_ids
+ * @param [in] count            Number of symbol_ids, up to REGMAP_FW_CONTROLS_MAX
+ * @param [out] failed_symbol_id    Set to the first symbol_id not found, or in the first read that failed - may be
+ *                                  NULL
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL if:
+ *      - count is greater than REGMAP_FW_CONTROLS_MAX
+ *      - any symbol_id is not in the symbol table
+ *      - the call to BSP failed
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_read_fw_controls(regmap_cp_config_t *cp,
+                                 fw_img_info_t *f,
+                                 const uint32_t *symbol_ids,
+                                 uint32_t *vals,
+                                 uint32_t count,
+                                 uint32_t *failed_symbol_id);
+
+/**
+ * Lock the control port bus for a sequence of transactions
+ *
+ * Transactions from other tasks to any device on the same bus are held off until the matching regmap_unlock.  Calls
+ * may be nested, and the priority of the outermost call is used to arbitrate for the bus.  Has no effect if the BSP
+ * does not implement bus_lock, or for virtual regmaps.
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] priority         Priority of the request - @see BSP_BUS_PRIORITY_
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL         if the call to BSP failed
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_lock(regmap_cp_config_t *cp, uint8_t priority);
+
+/**
+ * Unlock the control port bus after a sequence of transactions
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL         if the call to BSP failed
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_unlock(regmap_cp_config_t *cp);
+
+/**
+ * Set the SPI clock speed for a change in the power/clocking state of the device
+ *
+ * Tells the BSP the fastest SPI clock the device can take in the new state, from cp->spi_max_speed_hz.  Drivers call
+ * this as the device moves between states, so that i.e. firmware downloads run at the fastest speed that is safe at
+ * the time.  Has no effect for I2C and virtual regmaps, if cp->spi_max_speed_hz is NULL, or if the BSP does not
+ * implement spi_set_max_speed.
+ *
+ * @param [in] cp               Pointer to the BSP control port configuration
+ * @param [in] clock_state      New power/clocking state of the device - @see BSP_CLOCK_STATE_
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL         if clock_state is invalid, or if the call to BSP failed
+ * - REGMAP_STATUS_OK           otherwise
+ *
+ */
+uint32_t regmap_set_clock_state(regmap_cp_config_t *cp, uint8_t clock_state);
+
 /**********************************************************************************************************************/
 #ifdef __cplusplus
 }
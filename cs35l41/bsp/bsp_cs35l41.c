@@ -28,18 +28,31 @@
 #include "platform_bsp.h"
 #include "cs35l41.h"
 #include "cs35l41_ext.h"
+#ifndef CONFIG_FW_IMG_EEPROM
 #include "cs35l41_fw_img.h"
 #include "cs35l41_tune_fw_img.h"
+#include "cs35l41_cal_fw_img.h"
+#endif
 #include "cs35l41_tune_48_fw_img.h"
 #include "cs35l41_tune_44p1_fw_img.h"
-#include "cs35l41_cal_fw_img.h"
-#include "test_tone_tables.h"
 #include "cs35l41_fs_switch_syscfg.h"
 #include "bridge.h"
 
 /***********************************************************************************************************************
  * LOCAL LITERAL SUBSTITUTIONS
  **********************************************************************************************************************/
+#ifdef CONFIG_FW_IMG_EEPROM
+/*
+ * Index of each fw_img in the EEPROM, i.e. the order the .bin files were passed to tools/fw_img_eeprom.  The 48kHz
+ * and 44.1kHz tunings stay in MCU flash, as cs35l41_fs_switch_prepare() compares them in place.
+ */
+#define BSP_DUT_EEPROM_FW_IMG_INDEX             (0)
+#define BSP_DUT_EEPROM_TUNE_FW_IMG_INDEX        (1)
+#define BSP_DUT_EEPROM_CAL_FW_IMG_INDEX         (2)
+
+// Size of each EEPROM read, the next chunk is read into a second buffer while the current one is processed
+#define BSP_DUT_EEPROM_CHUNK_SIZE_BYTES         (1024)
+#endif
 
 /***********************************************************************************************************************
  * LOCAL VARIABLES
@@ -47,6 +60,11 @@
 static cs35l41_t cs35l41_driver;
 static fw_img_info_t fw_img_info;
 static uint32_t bsp_dut_dig_gain = CS35L42_AMP_VOL_PCM_0DB;
+static uint32_t bsp_dut_fs_hz = 0;                  // Fs of the current tuning, or 0 if not 48kHz or 44.1kHz
+static cs35l41_fs_switch_t bsp_dut_fs_switch_to_48;
+static cs35l41_fs_switch_t bsp_dut_fs_switch_to_44p1;
+static bool bsp_dut_fs_switch_is_valid = false;
+static uint32_t bsp_dut_fs_switch_gap_ms = 0;
 
 static cs35l41_bsp_config_t bsp_config =
 {
@@ -203,6 +221,112 @@ uint32_t bsp_dut_write_fw_img(const uint8_t *fw_img, fw_img_info_t *fw_img_info)
     return ret;
 }
 
+#ifdef CONFIG_FW_IMG_EEPROM
+static uint32_t bsp_dut_eeprom_read_start(void *arg, uint32_t addr, uint8_t *buffer, uint32_t length)
+{
+    return bsp_eeprom_read_start(addr, buffer, length);
+}
+
+static uint32_t bsp_dut_eeprom_read_wait(void *arg)
+{
+    return bsp_eeprom_read_wait();
+}
+
+uint32_t bsp_dut_write_fw_img_eeprom(uint32_t eeprom_index, fw_img_info_t *fw_img_info)
+{
+    uint32_t ret;
+    fw_img_boot_state_t boot_state;
+    fw_img_source_t source;
+
+    // Ensure your fw_img_boot_state_t and fw_img_source_t structs are initialised to zero.
+    memset(&boot_state, 0, sizeof(fw_img_boot_state_t));
+    memset(&source, 0, sizeof(fw_img_source_t));
+
+    // Look up where the fw_img is in the EEPROM
+    if (bsp_eeprom_fw_img_find(eeprom_index, &source.img_addr, &source.img_size))
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    source.read_start = &bsp_dut_eeprom_read_start;
+    source.read_wait = &bsp_dut_eeprom_read_wait;
+    source.buffer_size = BSP_DUT_EEPROM_CHUNK_SIZE_BYTES;
+    source.buffers[0] = (uint8_t *) bsp_malloc(source.buffer_size);
+    source.buffers[1] = (uint8_t *) bsp_malloc(source.buffer_size);
+    boot_state.source = &source;
+
+    // Get pointers to buffers for Symbol and Algorithm list
+    if (fw_img_info != NULL)
+    {
+        boot_state.fw_info = *fw_img_info;
+    }
+
+    // Read in the fw_img header, which also starts reading the next chunk from the EEPROM
+    ret = fw_img_read_header(&boot_state);
+    if (ret == FW_IMG_STATUS_OK)
+    {
+        if (boot_state.fw_info.preheader.img_format_rev == 1)
+        {
+            boot_state.block_data_size = CS35L41_CONTROL_PORT_MAX_PAYLOAD_BYTES;
+        }
+        else
+        {
+            boot_state.block_data_size = boot_state.fw_info.header.max_block_size;
+        }
+        boot_state.block_data = (uint8_t *) bsp_malloc(boot_state.block_data_size);
+        if (boot_state.block_data == NULL)
+        {
+            ret = FW_IMG_STATUS_FAIL;
+        }
+    }
+
+    // fw_img_process() fetches each chunk from the source itself, so only returns for data to send, or at the end
+    while (ret == FW_IMG_STATUS_OK)
+    {
+        ret = fw_img_process(&boot_state);
+        if (ret == FW_IMG_STATUS_DATA_READY)
+        {
+            ret = regmap_write_block(&(cs35l41_driver.config.bsp_config.cp_config),
+                                       boot_state.block.block_addr,
+                                       boot_state.block_data,
+                                       boot_state.block.block_size);
+            if (ret != CS35L41_STATUS_OK)
+            {
+                ret = FW_IMG_STATUS_FAIL;
+            }
+        }
+        else if (ret == FW_IMG_STATUS_OK)
+        {
+            break;
+        }
+    }
+
+    if (fw_img_source_stop(&boot_state))
+    {
+        ret = FW_IMG_STATUS_FAIL;
+    }
+
+    if ((fw_img_info != NULL) && (ret == FW_IMG_STATUS_OK))
+    {
+        *fw_img_info = boot_state.fw_info;
+    }
+
+    if (boot_state.block_data)
+        bsp_free(boot_state.block_data);
+    if (source.buffers[0])
+        bsp_free(source.buffers[0]);
+    if (source.buffers[1])
+        bsp_free(source.buffers[1]);
+
+    if (ret != FW_IMG_STATUS_OK)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    return BSP_STATUS_OK;
+}
+#endif
+
 /***********************************************************************************************************************
  * API FUNCTIONS
  **********************************************************************************************************************/
@@ -227,6 +351,23 @@ uint32_t bsp_dut_initialize(void)
         ret = cs35l41_configure(&cs35l41_driver, &amp_config);
     }
 
+    // Pre-compute the deltas between 48kHz and 44.1kHz configurations, to shorten the silence when switching
+    bsp_dut_fs_switch_is_valid = \
+        ((CS35L41_STATUS_OK == cs35l41_fs_switch_prepare(&bsp_dut_fs_switch_to_48,
+                                                         cs35l41_fs_44p1kHz_syscfg,
+                                                         CS35L41_FS_44P1KHZ_SYSCFG_REGS_TOTAL,
+                                                         cs35l41_tune_44p1_fw_img,
+                                                         cs35l41_fs_48kHz_syscfg,
+                                                         CS35L41_FS_48KHZ_SYSCFG_REGS_TOTAL,
+                                                         cs35l41_tune_48_fw_img)) && \
+         (CS35L41_STATUS_OK == cs35l41_fs_switch_prepare(&bsp_dut_fs_switch_to_44p1,
+                                                         cs35l41_fs_48kHz_syscfg,
+                                                         CS35L41_FS_48KHZ_SYSCFG_REGS_TOTAL,
+                                                         cs35l41_tune_48_fw_img,
+                                                         cs35l41_fs_44p1kHz_syscfg,
+                                                         CS35L41_FS_44P1KHZ_SYSCFG_REGS_TOTAL,
+                                                         cs35l41_tune_44p1_fw_img)));
+
     if (ret != CS35L41_STATUS_OK)
     {
         ret = BSP_STATUS_FAIL;
@@ -280,6 +421,21 @@ uint32_t bsp_dut_reset(void)
 uint32_t bsp_dut_boot(bool cal_boot)
 {
     uint32_t ret;
+#ifdef CONFIG_FW_IMG_EEPROM
+    uint32_t tune_index;
+    uint32_t header_buffer[(sizeof(fw_img_preheader_t) + sizeof(fw_img_v2_header_t)) / sizeof(uint32_t)];
+    uint32_t img_addr;
+    uint32_t img_size;
+
+    if (!cal_boot)
+    {
+        tune_index = BSP_DUT_EEPROM_TUNE_FW_IMG_INDEX;
+    }
+    else
+    {
+        tune_index = BSP_DUT_EEPROM_CAL_FW_IMG_INDEX;
+    }
+#else
     const uint8_t *fw_img;
     const uint8_t *tune_img;
 
@@ -293,8 +449,10 @@ uint32_t bsp_dut_boot(bool cal_boot)
     {
         tune_img = cs35l41_cal_fw_img;
     }
+#endif
 
     cs35l41_driver.is_cal_boot = cal_boot;
+    bsp_dut_fs_hz = 0;
 
     // Inform the driver that any current firmware is no longer available by passing a NULL
     // fw_info pointer to cs35l41_boot
@@ -316,10 +474,21 @@ uint32_t bsp_dut_boot(bool cal_boot)
     // Read in fw_img header to get sizes of Symbol ID and Algo List tables
     fw_img_boot_state_t temp_boot_state = {0};
 
+#ifdef CONFIG_FW_IMG_EEPROM
+    // Only the pre-header and header are needed here, so read just those from the EEPROM
+    if (bsp_eeprom_fw_img_find(BSP_DUT_EEPROM_FW_IMG_INDEX, &img_addr, &img_size) ||
+        bsp_eeprom_read(img_addr, (uint8_t *) header_buffer, sizeof(header_buffer)))
+    {
+        return BSP_STATUS_FAIL;
+    }
+    temp_boot_state.fw_img_blocks = (uint8_t *) header_buffer;
+    temp_boot_state.fw_img_blocks_size = sizeof(header_buffer);
+#else
     // Initialise pointer to the currently available fw_img data and set fw_img_blocks_size
     // to the size of fw_img_v1_header_t
     temp_boot_state.fw_img_blocks = (uint8_t *) fw_img;
     temp_boot_state.fw_img_blocks_size = 1024;
+#endif
 
     // Read in the fw_img header
     ret = fw_img_read_header(&temp_boot_state);
@@ -345,8 +514,13 @@ uint32_t bsp_dut_boot(bool cal_boot)
         return BSP_STATUS_FAIL;
     }
 
+#ifdef CONFIG_FW_IMG_EEPROM
+    bsp_dut_write_fw_img_eeprom(BSP_DUT_EEPROM_FW_IMG_INDEX, &fw_img_info);
+    bsp_dut_write_fw_img_eeprom(tune_index, NULL);
+#else
     bsp_dut_write_fw_img(fw_img, &fw_img_info);
     bsp_dut_write_fw_img(tune_img, NULL);
+#endif
 
     // fw_img processing is complete, so inform the driver and pass it the fw_info block
     ret = cs35l41_boot(&cs35l41_driver, &fw_img_info);
@@ -513,6 +687,8 @@ uint32_t bsp_dut_change_fs(uint32_t fs_hz)
     const uint8_t *tune_img;
     const uint32_t *cfg;
     uint16_t cfg_length;
+    uint32_t start_ms;
+    uint32_t current_fs_hz;
 
     // Validate Fs
     if (fs_hz == 48000)
@@ -532,30 +708,62 @@ uint32_t bsp_dut_change_fs(uint32_t fs_hz)
         return BSP_STATUS_FAIL;
     }
 
-    ret = cs35l41_start_tuning_switch(&cs35l41_driver);
-    if (ret)
+    if (fs_hz == bsp_dut_fs_hz)
     {
-        return BSP_STATUS_FAIL;
+        return BSP_STATUS_OK;
     }
 
-    ret = cs35l41_send_syscfg(&cs35l41_driver, cfg, cfg_length);
-    if (ret)
+    start_ms = bsp_get_time_ms();
+    // The current Fs tuning is unknown until the switch completes
+    current_fs_hz = bsp_dut_fs_hz;
+    bsp_dut_fs_hz = 0;
+
+    // If switching between 48kHz and 44.1kHz tunings, only write the pre-computed delta
+    if (bsp_dut_fs_switch_is_valid && (current_fs_hz != 0))
     {
-        return BSP_STATUS_FAIL;
+        ret = cs35l41_switch_fs(&cs35l41_driver,
+                                (fs_hz == 48000) ? &bsp_dut_fs_switch_to_48 : &bsp_dut_fs_switch_to_44p1);
+        if (ret)
+        {
+            return BSP_STATUS_FAIL;
+        }
     }
+    else
+    {
+        ret = cs35l41_start_tuning_switch(&cs35l41_driver);
+        if (ret)
+        {
+            return BSP_STATUS_FAIL;
+        }
 
-    // Load new Fs tuning
-    bsp_dut_write_fw_img(tune_img, NULL);
+        ret = cs35l41_send_syscfg(&cs35l41_driver, cfg, cfg_length);
+        if (ret)
+        {
+            return BSP_STATUS_FAIL;
+        }
 
-    ret = cs35l41_finish_tuning_switch(&cs35l41_driver);
-    if (ret)
-    {
-        return BSP_STATUS_FAIL;
+        // Load new Fs tuning
+        bsp_dut_write_fw_img(tune_img, NULL);
+
+        ret = cs35l41_finish_tuning_switch(&cs35l41_driver);
+        if (ret)
+        {
+            return BSP_STATUS_FAIL;
+        }
     }
 
+    // Playback is paused for at most the duration of the switch
+    bsp_dut_fs_switch_gap_ms = bsp_get_time_ms() - start_ms;
+    bsp_dut_fs_hz = fs_hz;
+
     return BSP_STATUS_OK;
 }
 
+uint32_t bsp_dut_get_fs_switch_gap_ms(void)
+{
+    return bsp_dut_fs_switch_gap_ms;
+}
+
 uint32_t bsp_dut_process(void)
 {
     bridge_process();
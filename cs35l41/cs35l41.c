@@ -150,6 +150,17 @@
  */
 #define CS35L41_OTP_READ_MAX_SPI_CLOCK_HZ       (4000000)
 
+/**
+ * Maximum SPI clock speed in each power/clocking state
+ *
+ * @see cs35l41_spi_max_speed_hz
+ *
+ */
+#define CS35L41_SPI_MAX_CLOCK_HZ_RESET          (4000000)
+#define CS35L41_SPI_MAX_CLOCK_HZ_OTP_BOOT       (12000000)
+#define CS35L41_SPI_MAX_CLOCK_HZ_PLL_LOCKED     (25000000)
+#define CS35L41_SPI_MAX_CLOCK_HZ_HIBERNATE      (4000000)
+
 #define CS35L41_OTP_MAP_BIT_OFFSET              (80)
 
 /**
@@ -166,6 +177,21 @@ typedef struct
  * LOCAL VARIABLES
  **********************************************************************************************************************/
 
+/**
+ * Default maximum SPI clock speed in each power/clocking state, used unless the BSP gives its own in
+ * cp_config.spi_max_speed_hz
+ *
+ * @see regmap_set_clock_state
+ *
+ */
+static const uint32_t cs35l41_spi_max_speed_hz[BSP_CLOCK_STATE_TOTAL] =
+{
+    [BSP_CLOCK_STATE_RESET] = CS35L41_SPI_MAX_CLOCK_HZ_RESET,
+    [BSP_CLOCK_STATE_OTP_BOOT] = CS35L41_SPI_MAX_CLOCK_HZ_OTP_BOOT,
+    [BSP_CLOCK_STATE_PLL_LOCKED] = CS35L41_SPI_MAX_CLOCK_HZ_PLL_LOCKED,
+    [BSP_CLOCK_STATE_HIBERNATE] = CS35L41_SPI_MAX_CLOCK_HZ_HIBERNATE,
+};
+
 /**
  * CS35L41 RevB2 Register Patch Errata
  *
@@ -1253,48 +1279,48 @@ static uint32_t cs35l41_event_handler(void *driver)
     uint32_t ret = CS35L41_STATUS_OK;
     uint32_t irq_statuses[4];
     uint32_t irq_masks[4];
+    uint32_t flags_to_clear[4];
+    uint32_t clear_mask = 0;
 
     cs35l41_t *d = driver;
     regmap_cp_config_t *cp = REGMAP_GET_CP(d);
 
-    // Read the IRQ1 flag and mask registers
-    uint32_t irq1_eint_1_flags_to_clear = 0;
-
-    for (i = 0; i < (sizeof(irq_statuses)/sizeof(uint32_t)); i++)
+    // Snapshot the IRQ1 flag and mask registers
+    ret = regmap_read_words(cp, IRQ1_IRQ1_EINT_1_REG, irq_statuses, (sizeof(irq_statuses)/sizeof(uint32_t)));
+    if (ret)
     {
-        uint32_t flags_to_clear = 0;
+        return ret;
+    }
 
-        ret = regmap_read(cp, (IRQ1_IRQ1_EINT_1_REG + (i * 4)), &(irq_statuses[i]));
-        if (ret)
-        {
-            return ret;
-        }
+    ret = regmap_read_words(cp, IRQ1_IRQ1_MASK_1_REG, irq_masks, (sizeof(irq_masks)/sizeof(uint32_t)));
+    if (ret)
+    {
+        return ret;
+    }
 
-        ret = regmap_read(cp, (IRQ1_IRQ1_MASK_1_REG + (i * 4)), &(irq_masks[i]));
-        if (ret)
-        {
-            return ret;
-        }
+    for (i = 0; i < (sizeof(irq_statuses)/sizeof(uint32_t)); i++)
+    {
+        flags_to_clear[i] = irq_statuses[i] & ~(irq_masks[i]);
 
-        flags_to_clear = irq_statuses[i] & ~(irq_masks[i]);
-        if (i == 0)
+        // If there are unmasked IRQs, then mark register to be cleared
+        if (flags_to_clear[i])
         {
-            irq1_eint_1_flags_to_clear = flags_to_clear;
+            clear_mask |= (1 << i);
         }
+    }
 
-        // If there are unmasked IRQs, then process
-        if (flags_to_clear)
-        {
-            // Clear any IRQ1 flags from first register
-            ret = regmap_write(cp, (IRQ1_IRQ1_EINT_1_REG + (i * 4)), flags_to_clear);
-            if (ret)
-            {
-                return ret;
-            }
-        }
+    // Clear any unmasked IRQ1 flags
+    ret = regmap_write_words_masked(cp,
+                                    IRQ1_IRQ1_EINT_1_REG,
+                                    flags_to_clear,
+                                    (sizeof(flags_to_clear)/sizeof(uint32_t)),
+                                    clear_mask);
+    if (ret)
+    {
+        return ret;
     }
 
-    if (!irq1_eint_1_flags_to_clear)
+    if (!flags_to_clear[0])
     {
         return CS35L41_STATUS_OK;
     }
@@ -1430,31 +1456,97 @@ static uint32_t cs35l41_wait_for_pwrmgt_sts(cs35l41_t *driver)
 }
 
 /**
- * Apply trims read from OTP to bitfields indicated in OTP Map
+ * Get length of run of contiguous trimmed register addresses
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] index            Index into otp_trim_addrs of first register of the run
+ *
+ * @return Number of registers in the run, at most REGMAP_WORDS_MAX
+ *
+ */
+static uint32_t cs35l41_otp_trim_run(cs35l41_t *driver, uint32_t index)
+{
+    uint32_t run = 1;
+
+    while (((index + run) < driver->otp_trim_count) &&
+           (run < REGMAP_WORDS_MAX) &&
+           (driver->otp_trim_addrs[index + run] == (driver->otp_trim_addrs[index + run - 1] + 4)))
+    {
+        run++;
+    }
+
+    return run;
+}
+
+/**
+ * Compute trimmed register values from OTP contents
+ *
+ * Builds the ascending list of unique registers in the OTP Map, reads their current values with one block read per
+ * run of contiguous addresses, then applies every OTP bit-field locally.  The results are left in otp_trim_addrs and
+ * otp_trim_vals so that later calls to cs35l41_otp_unpack only need to write them back.
  *
  * @param [in] driver           Pointer to the driver state
  *
  * @return
- * - CS35L41_STATUS_FAI         Control port activity fails
+ * - CS35L41_STATUS_FAIL        if Control port activity fails, or if the OTP Map trims more than
+ *                              CS35L41_OTP_TRIM_REGS_MAX registers
  * - CS35L41_STATUS_OK          otherwise
  *
  */
-static uint32_t cs35l41_otp_unpack(cs35l41_t *driver)
+static uint32_t cs35l41_otp_trim_compute(cs35l41_t *driver)
 {
     uint32_t ret;
-    uint32_t temp_reg_val, i;
+    uint32_t i, j, count = 0;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
-    // Unlock register file to apply OTP trims
-    ret = regmap_write(cp, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_UNLOCK_1);
-    if (ret)
+    driver->otp_trim_count = 0;
+
+    // Insert each unique trimmed register address in ascending order
+    for (i = 0; i < (sizeof(otp_map)/sizeof(cs35l41_otp_packed_entry_t)); i++)
     {
-        return ret;
+        uint32_t reg = otp_map[i].reg;
+
+        // If the entry's 'reg' member is 0x0, it means skip that trim
+        if (reg == 0x00000000)
+        {
+            continue;
+        }
+
+        // Find the sorted insertion point for reg
+        j = 0;
+        while ((j < count) && (driver->otp_trim_addrs[j] < reg))
+        {
+            j++;
+        }
+
+        if ((j < count) && (driver->otp_trim_addrs[j] == reg))
+        {
+            continue;
+        }
+
+        if (count >= CS35L41_OTP_TRIM_REGS_MAX)
+        {
+            return CS35L41_STATUS_FAIL;
+        }
+
+        memmove(&driver->otp_trim_addrs[j + 1], &driver->otp_trim_addrs[j], (count - j) * sizeof(uint32_t));
+        driver->otp_trim_addrs[j] = reg;
+        count++;
     }
-    ret = regmap_write(cp, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_UNLOCK_2);
-    if (ret)
+
+    driver->otp_trim_count = count;
+
+    // Read current register values, one block read per run of contiguous addresses
+    for (i = 0; i < count; i += j)
     {
-        return ret;
+        j = cs35l41_otp_trim_run(driver, i);
+
+        ret = regmap_read_words(cp, driver->otp_trim_addrs[i], &driver->otp_trim_vals[i], j);
+        if (ret)
+        {
+            driver->otp_trim_count = 0;
+            return ret;
+        }
     }
 
     // Initialize OTP unpacking state - otp_bit_count.  There are bits in OTP to skip to reach the trims
@@ -1465,37 +1557,83 @@ static uint32_t cs35l41_otp_unpack(cs35l41_t *driver)
         // Get trim entry
         cs35l41_otp_packed_entry_t temp_trim_entry = otp_map[i];
 
-        // If the entry's 'reg' member is 0x0, it means skip that trim
         if (temp_trim_entry.reg != 0x00000000)
         {
-            // Read the first register to be trimmed
-            ret = regmap_read(cp, temp_trim_entry.reg, &temp_reg_val);
-            if (ret)
+            // Find the cached value for this trim's register, added by the loop above
+            j = 0;
+            while (driver->otp_trim_addrs[j] != temp_trim_entry.reg)
             {
-                return ret;
+                j++;
             }
 
-            /*
-             * Apply OTP trim bit-field to recently read trim register value.  OTP contents is saved in
-             * cp_read_buffer + CS35L41_CP_REG_READ_LENGTH_BYTES
-             */
+            // Apply OTP trim bit-field to the cached register value
             cs35l41_apply_trim_word(driver->otp_contents,
                                     otp_bit_count,
-                                    &temp_reg_val,
+                                    &driver->otp_trim_vals[j],
                                     temp_trim_entry.shift,
                                     temp_trim_entry.size);
-            // Write new trimmed register value back
-            ret = regmap_write(cp, temp_trim_entry.reg, temp_reg_val);
-            if (ret)
-            {
-                return ret;
-            }
         }
 
         // Inrement the OTP unpacking state variable otp_bit_count
         otp_bit_count += temp_trim_entry.size;
     }
 
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Apply trims read from OTP to bitfields indicated in OTP Map
+ *
+ * On the first call after OTP contents are read, the trimmed register values are computed with
+ * cs35l41_otp_trim_compute.  Every call then writes the cached values back, one block write per run of contiguous
+ * addresses, so restoring after hibernation does not need to read any trim registers.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS35L41_STATUS_FAI         Control port activity fails
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_otp_unpack(cs35l41_t *driver)
+{
+    uint32_t ret;
+    uint32_t i, run;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    // Unlock register file to apply OTP trims
+    ret = regmap_write(cp, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_UNLOCK_1);
+    if (ret)
+    {
+        return ret;
+    }
+    ret = regmap_write(cp, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_UNLOCK_2);
+    if (ret)
+    {
+        return ret;
+    }
+
+    if (driver->otp_trim_count == 0)
+    {
+        ret = cs35l41_otp_trim_compute(driver);
+        if (ret)
+        {
+            return ret;
+        }
+    }
+
+    // Write trimmed register values back, one block write per run of contiguous addresses
+    for (i = 0; i < driver->otp_trim_count; i += run)
+    {
+        run = cs35l41_otp_trim_run(driver, i);
+
+        ret = regmap_write_words(cp, driver->otp_trim_addrs[i], &driver->otp_trim_vals[i], run);
+        if (ret)
+        {
+            return ret;
+        }
+    }
+
     // Lock register file
     ret = regmap_write(cp, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_LOCK_1);
     if (ret)
@@ -1508,6 +1646,7 @@ static uint32_t cs35l41_otp_unpack(cs35l41_t *driver)
         return ret;
     }
 
+
     return CS35L41_STATUS_OK;
 }
 
@@ -1597,160 +1736,756 @@ static uint32_t cs35l41_write_post_boot_config(cs35l41_t *driver)
 }
 
 /**
- * Restore HW regsiters to pre-hibernation state
+ * Pause playback and stop the PLL ahead of a tuning switch
  *
  * @param [in] driver           Pointer to the driver state
  *
  * @return
- * - CS35L41_STATUS_FAI         Control port activity fails
+ * - CS35L41_STATUS_FAIL if:
+ *      - Control port activity fails
+ *      - Polling of MSM_PDN_DONE times out
+ *      - Incorrect/unexpected values of Virtual MBOX transactions
  * - CS35L41_STATUS_OK          otherwise
  *
  */
-static uint32_t cs35l41_restore(cs35l41_t *driver)
+static uint32_t cs35l41_tuning_switch_stop(cs35l41_t *driver)
 {
     uint32_t ret;
-    uint32_t mtl_revid, chipid_match;
+    uint8_t i;
+    uint32_t temp_reg_val;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
-    mtl_revid = driver->revid & 0x0F;
-    chipid_match = (mtl_revid % 2) ? CS35L41R_DEVID : CS35L41_DEVID;
-    if (driver->devid != chipid_match)
+    /*
+     * The Host (i.e. the AP or the Codec driving the amp) sends a PAUSE request to the Prince FW and Pauses the
+     * current playback.
+     */
+    ret = cs35l41_send_acked_mbox_cmd(driver, CS35L41_DSP_MBOX_CMD_PAUSE);
+    if (ret)
     {
-        return CS35L41_STATUS_FAIL;
+        return ret;
     }
 
-    // Send errata
-    ret = cs35l41_write_errata(driver);
+    // The Host ensures both PLL_FORCE_EN and GLOBAL_EN are set to 0
+    // The Host checks the Power Down Done flag on Prince (MSM_PDN_DONE) to ensure that the PLL has stopped.
+    // Read GLOBAL_EN register in order to clear GLOBAL_EN
+    ret = regmap_read(cp, MSM_GLOBAL_ENABLES_REG, &temp_reg_val);
     if (ret)
     {
         return ret;
     }
 
-    // OTP unpack
-    ret = cs35l41_otp_unpack(driver);
+    // Clear GLOBAL_EN
+    temp_reg_val &= ~(MSM_GLOBAL_ENABLES_GLOBAL_EN_BITMASK);
+    ret = regmap_write(cp, MSM_GLOBAL_ENABLES_REG, temp_reg_val);
     if (ret)
     {
         return ret;
     }
 
-    // Write all post-boot configs
-    ret = cs35l41_write_post_boot_config(driver);
+    // Read IRQ1 flag register to poll MSM_PDN_DONE bit
+    i = 100;
+    do
+    {
+        ret = regmap_read(cp, IRQ1_IRQ1_EINT_1_REG, &temp_reg_val);
+        if (ret)
+        {
+            return ret;
+        }
+
+        if (temp_reg_val & IRQ1_IRQ1_EINT_1_MSM_PDN_DONE_EINT1_BITMASK)
+        {
+            break;
+        }
+
+        bsp_driver_if_g->set_timer(BSP_TIMER_DURATION_1MS, NULL, NULL);
+
+        i--;
+    } while (i > 0);
+
+    if (i == 0)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    // Clear MSM_PDN_DONE IRQ flag
+    ret = regmap_write(cp, IRQ1_IRQ1_EINT_1_REG, IRQ1_IRQ1_EINT_1_MSM_PDN_DONE_EINT1_BITMASK);
     if (ret)
     {
         return ret;
     }
 
-    return ret;
+    return CS35L41_STATUS_OK;
 }
 
 /**
- * Wakes device from hibernate
+ * Locate the data blocks of a fw_img
  *
- * @param [in] driver           Pointer to the driver state
+ * @param [in] fw_img           Pointer to the fw_img
+ * @param [out] blocks          Pointer to the first data block header
+ * @param [out] block_count     Number of data blocks
  *
  * @return
- * - CS35L41_STATUS_FAI         Control port activity fails
+ * - CS35L41_STATUS_FAIL        if the fw_img header is invalid, or if the data blocks overrun the fw_img
  * - CS35L41_STATUS_OK          otherwise
  *
  */
-static uint32_t cs35l41_wake(cs35l41_t *driver)
+static uint32_t cs35l41_fw_img_get_blocks(const uint8_t *fw_img, const uint8_t **blocks, uint32_t *block_count)
 {
-    uint32_t timeout = 10, ret;
-    uint32_t status = CS35L41_DSP_MBOX_STATUS_HIBERNATE;
-    int8_t retries = 5;
-    uint32_t mbox_cmd_drv_shift = 1 << 20;
-    uint32_t mbox_cmd_fw_shift = 1 << 21;
-    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+    fw_img_boot_state_t state;
+    const uint8_t *block, *fw_img_end;
+    uint32_t i;
 
-    do {
-        do {
-            ret = regmap_write(cp,
-                               DSP_VIRTUAL1_MBOX_DSP_VIRTUAL1_MBOX_1_REG,
-                               CS35L41_DSP_MBOX_CMD_OUT_OF_HIBERNATE);
+    memset(&state, 0, sizeof(fw_img_boot_state_t));
+    state.fw_img_blocks = (uint8_t *) fw_img;
+    state.fw_img_blocks_size = FW_IMG_SIZE(fw_img);
+    fw_img_end = fw_img + state.fw_img_blocks_size;
 
-            bsp_driver_if_g->set_timer(4, NULL, NULL);
+    fw_img_read_header(&state);
+    if ((state.fw_info.preheader.img_magic_number_1 != FW_IMG_BOOT_FW_IMG_V1_MAGIC_1) || \
+        ((state.fw_info.preheader.img_format_rev != 1) && (state.fw_info.preheader.img_format_rev != 2)))
+    {
+        return CS35L41_STATUS_FAIL;
+    }
 
-            if (ret != CS35L41_STATUS_FAIL)
-            {
-                ret = regmap_read(cp, DSP_MBOX_DSP_MBOX_2_REG,  &status);
-                if (ret)
-                {
-                  return ret;
-                }
-            }
+    // Skip the symbol table and algorithm ID list
+    block = state.fw_img_blocks;
+    block += state.fw_info.header.sym_table_size * sizeof(fw_img_v1_sym_table_t);
+    block += state.fw_info.header.alg_id_list_size * sizeof(uint32_t);
 
-        } while (status != CS35L41_DSP_MBOX_STATUS_PAUSED && --timeout > 0);
+    *blocks = block;
+    *block_count = state.fw_info.header.data_blocks;
 
-        if (timeout != 0)
-        {
-            break;
-        }
+    // Check that all data blocks are within the fw_img
+    for (i = 0; i < *block_count; i++)
+    {
+        fw_img_v1_data_block_t header;
 
-        ret = cs35l41_wait_for_pwrmgt_sts(driver);
-        if (ret)
-        {
-            return ret;
-        }
-        ret = regmap_write(cp, PWRMGT_WAKESRC_CTL, 0x0088);
-        if (ret)
-        {
-            return ret;
-        }
-        ret = cs35l41_wait_for_pwrmgt_sts(driver);
-        if (ret)
-        {
-            return ret;
-        }
-        ret = regmap_write(cp, PWRMGT_WAKESRC_CTL, 0x0188);
-        if (ret)
+        if ((block + sizeof(fw_img_v1_data_block_t)) > fw_img_end)
         {
-            return ret;
+            return CS35L41_STATUS_FAIL;
         }
-        ret = cs35l41_wait_for_pwrmgt_sts(driver);
-        if (ret)
+
+        memcpy(&header, block, sizeof(fw_img_v1_data_block_t));
+        block += sizeof(fw_img_v1_data_block_t) + ((header.block_size + 3) & ~0x3);
+
+        if (block > fw_img_end)
         {
-            return ret;
+            return CS35L41_STATUS_FAIL;
         }
-        ret = regmap_write(cp, PWRMGT_PWRMGT_CTL, 0x3);
+    }
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Get a fw_img data block and advance to the next one
+ *
+ * @param [in] block            Pointer to the data block header
+ * @param [out] header          Pointer to the data block header contents
+ * @param [out] data            Pointer to the data block data
+ *
+ * @return Pointer to the next data block header
+ *
+ */
+static const uint8_t *cs35l41_fw_img_next_block(const uint8_t *block,
+                                                fw_img_v1_data_block_t *header,
+                                                const uint8_t **data)
+{
+    memcpy(header, block, sizeof(fw_img_v1_data_block_t));
+    *data = block + sizeof(fw_img_v1_data_block_t);
+
+    return *data + ((header->block_size + 3) & ~0x3);
+}
+
+/**
+ * Check that a syscfg array holds only address/value pairs
+ *
+ * @param [in] cfg              Pointer to the syscfg array
+ * @param [in] cfg_length       Number of words in cfg
+ *
+ * @return true if there are no encoded operations in cfg, false otherwise
+ *
+ */
+static bool cs35l41_syscfg_is_pairs(const uint32_t *cfg, uint16_t cfg_length)
+{
+    uint16_t i;
+
+    if (cfg_length % 2)
+    {
+        return false;
+    }
+
+    for (i = 0; i < cfg_length; i += 2)
+    {
+        if ((cfg[i] == REGMAP_ARRAY_RMODW) || \
+            (cfg[i] == REGMAP_ARRAY_BLOCK_WRITE) || \
+            (cfg[i] == REGMAP_ARRAY_DELAY))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Add tuning data to an Fs switch delta
+ *
+ * @param [in] sw               Pointer to the delta
+ * @param [in] addr             Control port address of the first word
+ * @param [in] data             Pointer to the data
+ * @param [in] size             Size of data in bytes
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL        if the delta already holds CS35L41_FS_SWITCH_TUNE_BLOCKS_MAX blocks
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_fs_switch_add_block(cs35l41_fs_switch_t *sw, uint32_t addr, const uint8_t *data, uint32_t size)
+{
+    if (sw->tune_block_count >= CS35L41_FS_SWITCH_TUNE_BLOCKS_MAX)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    sw->tune_blocks[sw->tune_block_count].addr = addr;
+    sw->tune_blocks[sw->tune_block_count].data = data;
+    sw->tune_blocks[sw->tune_block_count].size = size;
+    sw->tune_block_count++;
+    sw->tune_bytes += size;
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Add the runs of words that differ between two tuning blocks to an Fs switch delta
+ *
+ * Runs separated by no more than CS35L41_FS_SWITCH_TUNE_GAP_WORDS unchanged words are merged into one block.
+ *
+ * @param [in] sw               Pointer to the delta
+ * @param [in] addr             Control port address of the blocks
+ * @param [in] from             Pointer to the block data of the current rate
+ * @param [in] to               Pointer to the block data of the new rate
+ * @param [in] size             Size of both blocks in bytes
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL        if the delta already holds CS35L41_FS_SWITCH_TUNE_BLOCKS_MAX blocks
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_fs_switch_diff_block(cs35l41_fs_switch_t *sw,
+                                             uint32_t addr,
+                                             const uint8_t *from,
+                                             const uint8_t *to,
+                                             uint32_t size)
+{
+    uint32_t ret;
+    uint32_t i, run_start = 0, run_end = 0;
+    uint32_t words = (size + 3) / 4;
+    bool in_run = false;
+
+    for (i = 0; i < words; i++)
+    {
+        if (memcmp(&from[i * 4], &to[i * 4], 4) == 0)
+        {
+            continue;
+        }
+
+        if (in_run && ((i - run_end) <= CS35L41_FS_SWITCH_TUNE_GAP_WORDS))
+        {
+            run_end = i + 1;
+            continue;
+        }
+
+        if (in_run)
+        {
+            ret = cs35l41_fs_switch_add_block(sw, addr + (run_start * 4), &to[run_start * 4], (run_end - run_start) * 4);
+            if (ret)
+            {
+                return ret;
+            }
+        }
+
+        in_run = true;
+        run_start = i;
+        run_end = i + 1;
+    }
+
+    if (in_run)
+    {
+        // The last word of the block may be partial
+        uint32_t run_size = (((run_end * 4) > size) ? size : (run_end * 4)) - (run_start * 4);
+
+        ret = cs35l41_fs_switch_add_block(sw, addr + (run_start * 4), &to[run_start * 4], run_size);
         if (ret)
         {
             return ret;
         }
+    }
 
-        timeout = 10;
+    return CS35L41_STATUS_OK;
+}
 
-    } while (--retries > 0);
+/**
+ * Append a register write to the hibernation restore image
+ *
+ * The write extends the last run if it targets the register following the last run, otherwise it starts a new run.
+ * Only consecutive writes are coalesced, so the image replays writes in the same order they were added.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] addr             Address of the register
+ * @param [in] val              Value to write
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL        if the image exceeds CS35L41_RESTORE_IMAGE_WORDS_MAX or CS35L41_RESTORE_IMAGE_RUNS_MAX
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_restore_image_add(cs35l41_t *driver, uint32_t addr, uint32_t val)
+{
+    cs35l41_restore_run_t *run = NULL;
 
-    ret = regmap_write(cp, IRQ2_IRQ2_EINT_2_REG, mbox_cmd_drv_shift);
+    if (driver->restore_val_count >= CS35L41_RESTORE_IMAGE_WORDS_MAX)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    if (driver->restore_run_count > 0)
+    {
+        run = &driver->restore_runs[driver->restore_run_count - 1];
+    }
+
+    if ((run == NULL) || (run->count == 0) || ((run->addr + (run->count * 4)) != addr))
+    {
+        if (driver->restore_run_count >= CS35L41_RESTORE_IMAGE_RUNS_MAX)
+        {
+            return CS35L41_STATUS_FAIL;
+        }
+
+        run = &driver->restore_runs[driver->restore_run_count++];
+        run->addr = addr;
+        run->count = 0;
+    }
+
+    run->count++;
+    driver->restore_vals[driver->restore_val_count++] = val;
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Append a register array to the hibernation restore image
+ *
+ * Accepts the same encoding as regmap_write_array.  Read-modify-write entries depend on the register contents at
+ * the time of the write, so they cannot be staged in the image.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] array            Pointer to array of address/value pairs and encoded operations
+ * @param [in] array_len        Number of words in array
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL        if the array contains REGMAP_ARRAY_RMODW, or if the image is full
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_restore_image_add_array(cs35l41_t *driver, const uint32_t *array, uint32_t array_len)
+{
+    uint32_t ret;
+    uint32_t i, j;
+
+    for (i = 0; i < array_len;)
+    {
+        switch (array[i])
+        {
+            case REGMAP_ARRAY_RMODW:
+                return CS35L41_STATUS_FAIL;
+
+            case REGMAP_ARRAY_BLOCK_WRITE:
+                // Block write data is held in bus byte order
+                for (j = 0; j < array[i + 2]; j++)
+                {
+                    const uint8_t *bytes = (const uint8_t *) &array[i + 3 + j];
+                    uint32_t val = 0;
+
+                    ADD_BYTE_TO_WORD(val, bytes[0], 3);
+                    ADD_BYTE_TO_WORD(val, bytes[1], 2);
+                    ADD_BYTE_TO_WORD(val, bytes[2], 1);
+                    ADD_BYTE_TO_WORD(val, bytes[3], 0);
+
+                    ret = cs35l41_restore_image_add(driver, array[i + 1] + (j * 4), val);
+                    if (ret)
+                    {
+                        return ret;
+                    }
+                }
+                i += array[i + 2] + 3;
+                break;
+
+            case REGMAP_ARRAY_DELAY:
+                if (driver->restore_run_count >= CS35L41_RESTORE_IMAGE_RUNS_MAX)
+                {
+                    return CS35L41_STATUS_FAIL;
+                }
+                driver->restore_runs[driver->restore_run_count].addr = array[i + 1];
+                driver->restore_runs[driver->restore_run_count].count = 0;
+                driver->restore_run_count++;
+                i += 2;
+                break;
+
+            default:
+                ret = cs35l41_restore_image_add(driver, array[i], array[i + 1]);
+                if (ret)
+                {
+                    return ret;
+                }
+                i += 2;
+                break;
+        }
+    }
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Build the hibernation restore image
+ *
+ * Stages the writes done by cs35l41_write_errata, cs35l41_otp_unpack and cs35l41_write_post_boot_config, in the same
+ * order, so that they can be replayed with one block write per run of contiguous registers.  The image is built from
+ * the known write sequence rather than read back from the device, since some of the registers restored are only
+ * accessible while the register file is unlocked.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL        if OTP trims have not been computed yet, or if the sequence cannot be staged
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_restore_image_build(cs35l41_t *driver)
+{
+    uint32_t ret;
+    uint32_t i;
+
+    driver->restore_run_count = 0;
+    driver->restore_val_count = 0;
+
+    if (driver->otp_trim_count == 0)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    // Errata
+    ret = cs35l41_restore_image_add_array(driver,
+                                          cs35l41_revb2_errata_patch,
+                                          (sizeof(cs35l41_revb2_errata_patch)/sizeof(uint32_t)));
+
+    // Trimmed register values, with the register file unlocked
+    ret |= cs35l41_restore_image_add(driver, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_UNLOCK_1);
+    ret |= cs35l41_restore_image_add(driver, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_UNLOCK_2);
+    for (i = 0; (ret == CS35L41_STATUS_OK) && (i < driver->otp_trim_count); i++)
+    {
+        ret = cs35l41_restore_image_add(driver, driver->otp_trim_addrs[i], driver->otp_trim_vals[i]);
+    }
+    ret |= cs35l41_restore_image_add(driver, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_LOCK_1);
+    ret |= cs35l41_restore_image_add(driver, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_LOCK_2);
+
+    // Post-boot configuration, then configuration data with the register file unlocked
+    ret |= cs35l41_restore_image_add_array(driver,
+                                           cs35l41_post_boot_config,
+                                           (sizeof(cs35l41_post_boot_config)/sizeof(uint32_t)));
+    ret |= cs35l41_restore_image_add(driver, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_UNLOCK_1);
+    ret |= cs35l41_restore_image_add(driver, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_UNLOCK_2);
+    ret |= cs35l41_restore_image_add_array(driver, driver->config.syscfg_regs, driver->config.syscfg_regs_total);
+    ret |= cs35l41_restore_image_add(driver, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_LOCK_1);
+    ret |= cs35l41_restore_image_add(driver, CS35L41_CTRL_KEYS_TEST_KEY_CTRL_REG, CS35L41_TEST_KEY_CTRL_LOCK_2);
+
+    if (ret)
+    {
+        driver->restore_run_count = 0;
+        driver->restore_val_count = 0;
+        return CS35L41_STATUS_FAIL;
+    }
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Write the hibernation restore image
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL        Control port activity fails
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_restore_image_write(cs35l41_t *driver)
+{
+    uint32_t ret;
+    uint32_t i, offset = 0;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    for (i = 0; i < driver->restore_run_count; i++)
+    {
+        cs35l41_restore_run_t *run = &driver->restore_runs[i];
+
+        if (run->count == 0)
+        {
+            bsp_driver_if_g->set_timer(run->addr, NULL, NULL);
+            continue;
+        }
+
+        if (run->count == 1)
+        {
+            ret = regmap_write(cp, run->addr, driver->restore_vals[offset]);
+        }
+        else
+        {
+            ret = regmap_write_words(cp, run->addr, &driver->restore_vals[offset], run->count);
+        }
+        if (ret)
+        {
+            return CS35L41_STATUS_FAIL;
+        }
+
+        offset += run->count;
+    }
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Restore HW regsiters to pre-hibernation state
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS35L41_STATUS_FAI         Control port activity fails
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_restore(cs35l41_t *driver)
+{
+    uint32_t ret;
+    uint32_t mtl_revid, chipid_match;
+
+    mtl_revid = driver->revid & 0x0F;
+    chipid_match = (mtl_revid % 2) ? CS35L41R_DEVID : CS35L41_DEVID;
+    if (driver->devid != chipid_match)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    // Stage the restore image once, then replay it on every wake
+    if (!driver->restore_image_valid)
+    {
+        driver->restore_image_valid = (cs35l41_restore_image_build(driver) == CS35L41_STATUS_OK);
+    }
+
+    if (driver->restore_image_valid)
+    {
+        return cs35l41_restore_image_write(driver);
+    }
+
+    // Send errata
+    ret = cs35l41_write_errata(driver);
     if (ret)
     {
         return ret;
     }
-    ret = regmap_write(cp, IRQ1_IRQ1_EINT_2_REG, mbox_cmd_fw_shift);
+
+    // OTP unpack
+    ret = cs35l41_otp_unpack(driver);
+    if (ret)
+    {
+        return ret;
+    }
+
+    // Write all post-boot configs
+    ret = cs35l41_write_post_boot_config(driver);
     if (ret)
     {
         return ret;
     }
 
-    retries = 5;
+    return ret;
+}
+
+/**
+ * Wakes device from hibernate
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS35L41_STATUS_FAI         Control port activity fails
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_wake(cs35l41_t *driver)
+{
+    uint32_t timeout, ret;
+    uint32_t status = CS35L41_DSP_MBOX_STATUS_HIBERNATE;
+    int8_t retries = 5;
+    uint32_t mbox_cmd_drv_shift = 1 << 20;
+    uint32_t mbox_cmd_fw_shift = 1 << 21;
+    bool cmd_sent;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
     do {
-        ret = cs35l41_restore(driver);
+        cmd_sent = false;
+
+        for (timeout = 0; timeout < CS35L41_POLL_WAKE_MAX; timeout++)
+        {
+            // (Re)send the command until it is acknowledged on the bus, then periodically while waiting
+            if (!cmd_sent || ((timeout % CS35L41_POLL_WAKE_CMD_RESEND) == 0))
+            {
+                ret = regmap_write(cp,
+                                   DSP_VIRTUAL1_MBOX_DSP_VIRTUAL1_MBOX_1_REG,
+                                   CS35L41_DSP_MBOX_CMD_OUT_OF_HIBERNATE);
+                cmd_sent = (ret == CS35L41_STATUS_OK);
+            }
+
+            bsp_driver_if_g->set_timer(CS35L41_POLL_WAKE_MS, NULL, NULL);
+
+            if (cmd_sent)
+            {
+                ret = regmap_read(cp, DSP_MBOX_DSP_MBOX_2_REG,  &status);
+                if (ret)
+                {
+                  return ret;
+                }
+
+                if (status == CS35L41_DSP_MBOX_STATUS_PAUSED)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (timeout < CS35L41_POLL_WAKE_MAX)
+        {
+            break;
+        }
+
+        ret = cs35l41_wait_for_pwrmgt_sts(driver);
+        if (ret)
+        {
+            return ret;
+        }
+        ret = regmap_write(cp, PWRMGT_WAKESRC_CTL, 0x0088);
+        if (ret)
+        {
+            return ret;
+        }
+        ret = cs35l41_wait_for_pwrmgt_sts(driver);
+        if (ret)
+        {
+            return ret;
+        }
+        ret = regmap_write(cp, PWRMGT_WAKESRC_CTL, 0x0188);
+        if (ret)
+        {
+            return ret;
+        }
+        ret = cs35l41_wait_for_pwrmgt_sts(driver);
+        if (ret)
+        {
+            return ret;
+        }
+        ret = regmap_write(cp, PWRMGT_PWRMGT_CTL, 0x3);
         if (ret)
         {
             return ret;
         }
-        bsp_driver_if_g->set_timer(4, NULL, NULL);
-    } while (ret != 0 && --retries > 0);
 
-    if (retries < 0)
+    } while (--retries > 0);
+
+    ret = regmap_write(cp, IRQ2_IRQ2_EINT_2_REG, mbox_cmd_drv_shift);
+    if (ret)
     {
-        //Failed to wake
-        ret = CS35L41_STATUS_FAIL;
+        return ret;
+    }
+    ret = regmap_write(cp, IRQ1_IRQ1_EINT_2_REG, mbox_cmd_fw_shift);
+    if (ret)
+    {
+        return ret;
     }
 
+    ret = cs35l41_restore(driver);
+
     return ret;
 }
 
+/**
+ * Take a DSP Telemetry sample if one is due
+ *
+ * Reads all DSP status controls, one block read per run of contiguous addresses, and pushes them to the ring buffer.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL        Control port activity fails
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs35l41_telemetry_process(cs35l41_t *driver)
+{
+    uint32_t ret, i, run, now;
+    cs35l41_telemetry_sample_t *sample;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    now = bsp_driver_if_g->get_time_ms();
+    if (((int32_t) (now - driver->telemetry_deadline) < 0) || (driver->state != CS35L41_STATE_DSP_POWER_UP))
+    {
+        return CS35L41_STATUS_OK;
+    }
+
+    // Skip any periods missed while the control path was busy
+    while ((int32_t) (now - driver->telemetry_deadline) >= 0)
+    {
+        driver->telemetry_deadline += driver->telemetry_period;
+    }
+
+    if ((driver->telemetry_head - driver->telemetry_tail) >= CS35L41_TELEMETRY_DEPTH)
+    {
+        driver->telemetry_dropped++;
+        return CS35L41_STATUS_OK;
+    }
+
+    sample = &(driver->telemetry_buffer[driver->telemetry_head & (CS35L41_TELEMETRY_DEPTH - 1)]);
+    sample->timestamp_ms = now - driver->telemetry_start;
+
+    // Read each run of contiguous status controls with a single block read
+    for (i = 0; i < CS35L41_DSP_STATUS_WORDS_TOTAL; i += run)
+    {
+        uint32_t words[CS35L41_DSP_STATUS_WORDS_TOTAL];
+        uint8_t *order = &(driver->telemetry_order[i]);
+
+        for (run = 1; (i + run) < CS35L41_DSP_STATUS_WORDS_TOTAL; run++)
+        {
+            if (driver->telemetry_addrs[order[run]] != (driver->telemetry_addrs[order[run - 1]] + 4))
+            {
+                break;
+            }
+        }
+
+        ret = regmap_read_words(cp, driver->telemetry_addrs[order[0]], words, run);
+        if (ret)
+        {
+            return CS35L41_STATUS_FAIL;
+        }
+
+        for (uint32_t j = 0; j < run; j++)
+        {
+            sample->data.words[order[j]] = words[j];
+        }
+    }
+
+    driver->telemetry_head++;
+
+    return CS35L41_STATUS_OK;
+}
+
 /***********************************************************************************************************************
  * API FUNCTIONS
  **********************************************************************************************************************/
@@ -1789,6 +2524,13 @@ uint32_t cs35l41_configure(cs35l41_t *driver, cs35l41_config_t *config)
         (NULL != config))
     {
         driver->config = *config;
+        driver->restore_image_valid = false;
+
+        // Use the SPI clock speeds of the driver unless the BSP gives its own
+        if (driver->config.bsp_config.cp_config.spi_max_speed_hz == NULL)
+        {
+            driver->config.bsp_config.cp_config.spi_max_speed_hz = cs35l41_spi_max_speed_hz;
+        }
 
         // Advance driver to CONFIGURED state
         driver->state = CS35L41_STATE_CONFIGURED;
@@ -1812,18 +2554,32 @@ uint32_t cs35l41_configure(cs35l41_t *driver, cs35l41_config_t *config)
  */
 uint32_t cs35l41_process(cs35l41_t *driver)
 {
+    uint32_t ret;
+
     // check for driver state
     if ((driver->state != CS35L41_STATE_UNCONFIGURED) && (driver->state != CS35L41_STATE_ERROR))
     {
         // check for driver mode
         if (driver->mode == CS35L41_MODE_HANDLING_EVENTS)
         {
-            // run through event handler
-            if (CS35L41_STATUS_OK == cs35l41_event_handler(driver))
+            // run through event handler, ahead of lower priority transactions from other tasks on the same bus
+            regmap_lock(REGMAP_GET_CP(driver), BSP_BUS_PRIORITY_HIGH);
+            ret = cs35l41_event_handler(driver);
+            regmap_unlock(REGMAP_GET_CP(driver));
+
+            if (CS35L41_STATUS_OK == ret)
             {
                 driver->mode = CS35L41_MODE_HANDLING_CONTROLS;
             }
-            else
+            else
+            {
+                driver->state = CS35L41_STATE_ERROR;
+            }
+        }
+
+        if (driver->telemetry_enabled)
+        {
+            if (cs35l41_telemetry_process(driver))
             {
                 driver->state = CS35L41_STATE_ERROR;
             }
@@ -1860,6 +2616,12 @@ uint32_t cs35l41_reset(cs35l41_t *driver)
     uint32_t temp_reg_val;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
+    ret = regmap_set_clock_state(cp, BSP_CLOCK_STATE_RESET);
+    if (ret)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
     // Drive RESET low for at least T_RLPW (1ms)
     bsp_driver_if_g->set_gpio(driver->config.bsp_config.reset_gpio_id, BSP_GPIO_LOW);
     bsp_driver_if_g->set_timer(CS35L41_T_RLPW_MS, NULL, NULL);
@@ -1890,6 +2652,12 @@ uint32_t cs35l41_reset(cs35l41_t *driver)
         return CS35L41_STATUS_FAIL;
     }
 
+    ret = regmap_set_clock_state(cp, BSP_CLOCK_STATE_OTP_BOOT);
+    if (ret)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
     // Read DEVID
     ret = regmap_read(cp, CS35L41_SW_RESET_DEVID_REG, &(driver->devid));
     if (ret)
@@ -1942,6 +2710,10 @@ uint32_t cs35l41_reset(cs35l41_t *driver)
         return ret;
     }
 
+    // Invalidate trimmed register values and restore image computed from any previous OTP contents
+    driver->otp_trim_count = 0;
+    driver->restore_image_valid = false;
+
     if(driver->config.bsp_config.cp_config.bus_type == REGMAP_BUS_TYPE_SPI)
     {
         bsp_driver_if_g->spi_restore_speed();
@@ -1997,28 +2769,15 @@ uint32_t cs35l41_boot(cs35l41_t *driver, fw_img_info_t *fw_info)
     // If calibration data is valid
     if ((!driver->is_cal_boot) && (driver->config.cal_data.is_valid))
     {
-        // Write calibrated load impedance
-        ret = regmap_write_fw_control(cp, driver->fw_info, CS35L41_SYM_CSPL_CAL_R, driver->config.cal_data.r);
-        if (ret)
+        // Write calibrated load impedance, CAL_STATUS and CAL_CHECKSUM
+        uint32_t cal_controls[] =
         {
-            return CS35L41_STATUS_FAIL;
-        }
-
-        // Write CAL_STATUS
-        ret = regmap_write_fw_control(cp,
-                                      driver->fw_info,
-                                      CS35L41_SYM_CSPL_CAL_STATUS,
-                                      CS35L41_CAL_STATUS_CALIB_SUCCESS);
-        if (ret)
-        {
-            return CS35L41_STATUS_FAIL;
-        }
+            CS35L41_SYM_CSPL_CAL_R, driver->config.cal_data.r,
+            CS35L41_SYM_CSPL_CAL_STATUS, CS35L41_CAL_STATUS_CALIB_SUCCESS,
+            CS35L41_SYM_CSPL_CAL_CHECKSUM, (driver->config.cal_data.r + CS35L41_CAL_STATUS_CALIB_SUCCESS)
+        };
 
-        // Write CAL_CHECKSUM
-        ret = regmap_write_fw_control(cp,
-                                      driver->fw_info,
-                                      CS35L41_SYM_CSPL_CAL_CHECKSUM,
-                                      (driver->config.cal_data.r + CS35L41_CAL_STATUS_CALIB_SUCCESS));
+        ret = regmap_write_fw_controls(cp, driver->fw_info, cal_controls, 3, NULL);
         if (ret)
         {
             return CS35L41_STATUS_FAIL;
@@ -2039,6 +2798,7 @@ uint32_t cs35l41_power(cs35l41_t *driver, uint32_t power_state)
     uint32_t ret;
     uint32_t (*fp)(cs35l41_t *driver) = NULL;
     uint32_t next_state = CS35L41_STATE_UNCONFIGURED;
+    uint8_t next_clock_state = BSP_CLOCK_STATE_OTP_BOOT;
 
     switch (power_state)
     {
@@ -2047,6 +2807,7 @@ uint32_t cs35l41_power(cs35l41_t *driver, uint32_t power_state)
                 (driver->state == CS35L41_STATE_DSP_STANDBY))
             {
                 fp = &cs35l41_power_up;
+                next_clock_state = BSP_CLOCK_STATE_PLL_LOCKED;
 
                 if (driver->state == CS35L41_STATE_STANDBY)
                 {
@@ -2081,6 +2842,7 @@ uint32_t cs35l41_power(cs35l41_t *driver, uint32_t power_state)
             {
                 fp = &cs35l41_hibernate;
                 next_state = CS35L41_STATE_HIBERNATE;
+                next_clock_state = BSP_CLOCK_STATE_HIBERNATE;
             }
             break;
 
@@ -2103,6 +2865,13 @@ uint32_t cs35l41_power(cs35l41_t *driver, uint32_t power_state)
     if (ret == CS35L41_STATUS_OK)
     {
         driver->state = next_state;
+
+        // PLL locks on power up, and stops again on power down or hibernate
+        ret = regmap_set_clock_state(REGMAP_GET_CP(driver), next_clock_state);
+        if (ret)
+        {
+            ret = CS35L41_STATUS_FAIL;
+        }
     }
 
     return ret;
@@ -2114,7 +2883,8 @@ uint32_t cs35l41_power(cs35l41_t *driver, uint32_t power_state)
  */
 uint32_t cs35l41_calibrate(cs35l41_t *driver, uint32_t ambient_temp_deg_c)
 {
-    uint32_t temp_reg_val;
+    const uint32_t cal_controls[] = {CS35L41_SYM_CSPL_CAL_R, CS35L41_SYM_CSPL_CAL_STATUS, CS35L41_SYM_CSPL_CAL_CHECKSUM};
+    uint32_t cal_vals[3];
     uint32_t ret = CS35L41_STATUS_OK;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
@@ -2128,35 +2898,21 @@ uint32_t cs35l41_calibrate(cs35l41_t *driver, uint32_t ambient_temp_deg_c)
     // Wait for at least 2 seconds while DSP FW performs calibration
     bsp_driver_if_g->set_timer(BSP_TIMER_DURATION_2S, NULL, NULL);
 
-    // Read the Calibration Load Impedance "R"
-    ret = regmap_read_fw_control(cp, driver->fw_info, CS35L41_SYM_CSPL_CAL_R, &temp_reg_val);
-    if (ret)
-    {
-        return CS35L41_STATUS_FAIL;
-    }
-    driver->config.cal_data.r = temp_reg_val;
-
-    // Read the Calibration Status
-    ret = regmap_read_fw_control(cp, driver->fw_info, CS35L41_SYM_CSPL_CAL_STATUS, &temp_reg_val);
+    // Read the Calibration Load Impedance "R", Calibration Status and Calibration Checksum
+    ret = regmap_read_fw_controls(cp, driver->fw_info, cal_controls, cal_vals, 3, NULL);
     if (ret)
     {
         return CS35L41_STATUS_FAIL;
     }
+    driver->config.cal_data.r = cal_vals[0];
 
-    if (temp_reg_val != CS35L41_CAL_STATUS_CALIB_SUCCESS)
-    {
-        return CS35L41_STATUS_FAIL;
-    }
-
-    // Read the Calibration Checksum
-    ret = regmap_read_fw_control(cp, driver->fw_info, CS35L41_SYM_CSPL_CAL_CHECKSUM, &temp_reg_val);
-    if (ret)
+    if (cal_vals[1] != CS35L41_CAL_STATUS_CALIB_SUCCESS)
     {
         return CS35L41_STATUS_FAIL;
     }
 
     // Verify the Calibration Checksum
-    if (temp_reg_val == (driver->config.cal_data.r + CS35L41_CAL_STATUS_CALIB_SUCCESS))
+    if (cal_vals[2] == (driver->config.cal_data.r + CS35L41_CAL_STATUS_CALIB_SUCCESS))
     {
         driver->config.cal_data.is_valid = true;
     }
@@ -2193,64 +2949,8 @@ uint32_t cs35l41_send_syscfg(cs35l41_t *driver, const uint32_t *cfg, uint16_t cf
 uint32_t cs35l41_start_tuning_switch(cs35l41_t *driver)
 {
     uint32_t ret;
-    uint8_t i;
-    uint32_t temp_reg_val;
-    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
-
-    /*
-     * The Host (i.e. the AP or the Codec driving the amp) sends a PAUSE request to the Prince FW and Pauses the
-     * current playback.
-     */
-    ret = cs35l41_send_acked_mbox_cmd(driver, CS35L41_DSP_MBOX_CMD_PAUSE);
-    if (ret)
-    {
-        return ret;
-    }
-
-    // The Host ensures both PLL_FORCE_EN and GLOBAL_EN are set to 0
-    // The Host checks the Power Down Done flag on Prince (MSM_PDN_DONE) to ensure that the PLL has stopped.
-    // Read GLOBAL_EN register in order to clear GLOBAL_EN
-    ret = regmap_read(cp, MSM_GLOBAL_ENABLES_REG, &temp_reg_val);
-    if (ret)
-    {
-        return ret;
-    }
-
-    // Clear GLOBAL_EN
-    temp_reg_val &= ~(MSM_GLOBAL_ENABLES_GLOBAL_EN_BITMASK);
-    ret = regmap_write(cp, MSM_GLOBAL_ENABLES_REG, temp_reg_val);
-    if (ret)
-    {
-        return ret;
-    }
-
-    // Read IRQ1 flag register to poll MSM_PDN_DONE bit
-    i = 100;
-    do
-    {
-        ret = regmap_read(cp, IRQ1_IRQ1_EINT_1_REG, &temp_reg_val);
-        if (ret)
-        {
-            return ret;
-        }
-
-        if (temp_reg_val & IRQ1_IRQ1_EINT_1_MSM_PDN_DONE_EINT1_BITMASK)
-        {
-            break;
-        }
-
-        bsp_driver_if_g->set_timer(BSP_TIMER_DURATION_1MS, NULL, NULL);
-
-        i--;
-    } while (i > 0);
 
-    if (i == 0)
-    {
-        return CS35L41_STATUS_FAIL;
-    }
-
-    // Clear MSM_PDN_DONE IRQ flag
-    ret = regmap_write(cp, IRQ1_IRQ1_EINT_1_REG, IRQ1_IRQ1_EINT_1_MSM_PDN_DONE_EINT1_BITMASK);
+    ret = cs35l41_tuning_switch_stop(driver);
     if (ret)
     {
         return ret;
@@ -2321,6 +3021,163 @@ uint32_t cs35l41_finish_tuning_switch(cs35l41_t *driver)
     return CS35L41_STATUS_OK;
 }
 
+/**
+ * Pre-compute the delta for switching between two sample rates
+ *
+ */
+uint32_t cs35l41_fs_switch_prepare(cs35l41_fs_switch_t *sw,
+                                   const uint32_t *from_syscfg,
+                                   uint16_t from_length,
+                                   const uint8_t *from_tune,
+                                   const uint32_t *to_syscfg,
+                                   uint16_t to_length,
+                                   const uint8_t *to_tune)
+{
+    uint32_t ret;
+    uint32_t i, j;
+    const uint8_t *from_blocks, *to_block, *from_block;
+    uint32_t from_count, to_count;
+
+    if ((sw == NULL) || (from_syscfg == NULL) || (from_tune == NULL) || (to_syscfg == NULL) || (to_tune == NULL))
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    memset(sw, 0, sizeof(cs35l41_fs_switch_t));
+
+    if (!cs35l41_syscfg_is_pairs(from_syscfg, from_length) || !cs35l41_syscfg_is_pairs(to_syscfg, to_length))
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    // Keep only the registers that are not already at the new value
+    for (i = 0; i < to_length; i += 2)
+    {
+        j = 0;
+        while ((j < from_length) && (from_syscfg[j] != to_syscfg[i]))
+        {
+            j += 2;
+        }
+
+        if ((j < from_length) && (from_syscfg[j + 1] == to_syscfg[i + 1]))
+        {
+            continue;
+        }
+
+        if (sw->syscfg_regs >= CS35L41_FS_SWITCH_SYSCFG_REGS_MAX)
+        {
+            return CS35L41_STATUS_FAIL;
+        }
+
+        sw->syscfg[sw->syscfg_regs * 2] = to_syscfg[i];
+        sw->syscfg[(sw->syscfg_regs * 2) + 1] = to_syscfg[i + 1];
+        sw->syscfg_regs++;
+    }
+
+    ret = cs35l41_fw_img_get_blocks(from_tune, &from_blocks, &from_count);
+    if (ret)
+    {
+        return ret;
+    }
+    ret = cs35l41_fw_img_get_blocks(to_tune, &to_block, &to_count);
+    if (ret)
+    {
+        return ret;
+    }
+
+    // Keep only the tuning words that differ from the block at the same address and size in the current tuning
+    for (i = 0; i < to_count; i++)
+    {
+        fw_img_v1_data_block_t to_header, from_header;
+        const uint8_t *to_data, *from_data = NULL;
+
+        to_block = cs35l41_fw_img_next_block(to_block, &to_header, &to_data);
+
+        from_block = from_blocks;
+        for (j = 0; j < from_count; j++)
+        {
+            const uint8_t *data;
+
+            from_block = cs35l41_fw_img_next_block(from_block, &from_header, &data);
+            if ((from_header.block_addr == to_header.block_addr) && (from_header.block_size == to_header.block_size))
+            {
+                from_data = data;
+                break;
+            }
+        }
+
+        if (from_data == NULL)
+        {
+            ret = cs35l41_fs_switch_add_block(sw, to_header.block_addr, to_data, to_header.block_size);
+        }
+        else
+        {
+            ret = cs35l41_fs_switch_diff_block(sw, to_header.block_addr, from_data, to_data, to_header.block_size);
+        }
+
+        if (ret)
+        {
+            return ret;
+        }
+    }
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Switch sample rate
+ *
+ */
+uint32_t cs35l41_switch_fs(cs35l41_t *driver, const cs35l41_fs_switch_t *sw)
+{
+    uint32_t ret;
+    uint32_t i;
+    regmap_cp_config_t *cp;
+
+    if ((driver == NULL) || (sw == NULL))
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    cp = REGMAP_GET_CP(driver);
+
+    ret = cs35l41_tuning_switch_stop(driver);
+    if (ret)
+    {
+        return ret;
+    }
+
+    // Write the syscfg delta while the PLL is stopped, ahead of the wait for STOP_PRE_REINIT
+    ret = regmap_write_array(cp, (uint32_t *) sw->syscfg, sw->syscfg_regs * 2);
+    if (ret)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    bsp_driver_if_g->set_timer(10, NULL, NULL);
+
+    ret = cs35l41_send_acked_mbox_cmd(driver, CS35L41_DSP_MBOX_CMD_STOP_PRE_REINIT);
+    if (ret)
+    {
+        return ret;
+    }
+
+    // Write the tuning delta
+    for (i = 0; i < sw->tune_block_count; i++)
+    {
+        ret = regmap_write_block(cp,
+                                 sw->tune_blocks[i].addr,
+                                 (uint8_t *) sw->tune_blocks[i].data,
+                                 sw->tune_blocks[i].size);
+        if (ret)
+        {
+            return CS35L41_STATUS_FAIL;
+        }
+    }
+
+    return cs35l41_finish_tuning_switch(driver);
+}
+
 /**
  * Get DSP Status
  *
@@ -2329,29 +3186,39 @@ uint32_t cs35l41_get_dsp_status(cs35l41_t *driver, cs35l41_dsp_status_t *status)
 {
     uint8_t i;
     uint32_t temp_reg_val;
+    uint32_t words[CS35L41_DSP_STATUS_WORDS_TOTAL];
     uint32_t ret = CS35L41_STATUS_OK;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
-    // Read the DSP Status field addresses
-    for (i = 0; i < CS35L41_DSP_STATUS_WORDS_TOTAL; i++)
+    // Read the DSP Status fields
+    ret = regmap_read_fw_controls(cp,
+                                  driver->fw_info,
+                                  cs35l41_dsp_status_controls,
+                                  status->data.words,
+                                  CS35L41_DSP_STATUS_WORDS_TOTAL,
+                                  NULL);
+    if (ret)
     {
-        ret = regmap_read_fw_control(cp, driver->fw_info, cs35l41_dsp_status_controls[i], &(status->data.words[i]));
-        if (ret)
-        {
-            return CS35L41_STATUS_FAIL;
-        }
+        return CS35L41_STATUS_FAIL;
     }
 
     // Wait at least 10ms
     bsp_driver_if_g->set_timer(BSP_TIMER_DURATION_10MS, NULL, NULL);
 
+    ret = regmap_read_fw_controls(cp,
+                                  driver->fw_info,
+                                  cs35l41_dsp_status_controls,
+                                  words,
+                                  CS35L41_DSP_STATUS_WORDS_TOTAL,
+                                  NULL);
+    if (ret)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
     for (i = 0; i < CS35L41_DSP_STATUS_WORDS_TOTAL; i++)
     {
-        ret = regmap_read_fw_control(cp, driver->fw_info, cs35l41_dsp_status_controls[i], &temp_reg_val);
-        if (ret)
-        {
-            return CS35L41_STATUS_FAIL;
-        }
+        temp_reg_val = words[i];
 
         // If the current field is HALO_HEARTBEAT, and there is a change in subsequent values
         if ((i == 1) && (temp_reg_val != status->data.words[i]))
@@ -2381,6 +3248,78 @@ uint32_t cs35l41_get_dsp_status(cs35l41_t *driver, cs35l41_dsp_status_t *status)
     return CS35L41_STATUS_OK;
 }
 
+/**
+ * Start DSP Telemetry
+ *
+ */
+uint32_t cs35l41_telemetry_start(cs35l41_t *driver, uint32_t period_ms)
+{
+    uint32_t i, j, addr;
+
+    if ((period_ms == 0) || (bsp_driver_if_g->get_time_ms == NULL))
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    // Resolve DSP status control addresses and sort them in ascending order
+    for (i = 0; i < CS35L41_DSP_STATUS_WORDS_TOTAL; i++)
+    {
+        addr = fw_img_find_symbol(driver->fw_info, cs35l41_dsp_status_controls[i]);
+        if (!addr)
+        {
+            return CS35L41_STATUS_FAIL;
+        }
+
+        driver->telemetry_addrs[i] = addr;
+
+        for (j = i; (j > 0) && (driver->telemetry_addrs[driver->telemetry_order[j - 1]] > addr); j--)
+        {
+            driver->telemetry_order[j] = driver->telemetry_order[j - 1];
+        }
+        driver->telemetry_order[j] = i;
+    }
+
+    driver->telemetry_period = period_ms;
+    driver->telemetry_start = bsp_driver_if_g->get_time_ms();
+    driver->telemetry_deadline = driver->telemetry_start;
+    driver->telemetry_head = 0;
+    driver->telemetry_tail = 0;
+    driver->telemetry_dropped = 0;
+    driver->telemetry_enabled = true;
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Stop DSP Telemetry
+ *
+ */
+uint32_t cs35l41_telemetry_stop(cs35l41_t *driver)
+{
+    driver->telemetry_enabled = false;
+
+    return CS35L41_STATUS_OK;
+}
+
+/**
+ * Pull the oldest DSP Telemetry sample
+ *
+ */
+uint32_t cs35l41_telemetry_read(cs35l41_t *driver, cs35l41_telemetry_sample_t *sample)
+{
+    uint32_t tail = driver->telemetry_tail;
+
+    if (tail == driver->telemetry_head)
+    {
+        return CS35L41_STATUS_FAIL;
+    }
+
+    *sample = driver->telemetry_buffer[tail & (CS35L41_TELEMETRY_DEPTH - 1)];
+    driver->telemetry_tail = tail + 1;
+
+    return CS35L41_STATUS_OK;
+}
+
 /*
  * Reads the contents of a single register/memory address
  *
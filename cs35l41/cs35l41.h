@@ -87,6 +87,15 @@ extern "C" {
 #define CS35L41_POLL_OTP_BOOT_DONE_MS                   (10)        ///< Delay in ms between polling OTP_BOOT_DONE
 #define CS35L41_POLL_OTP_BOOT_DONE_MAX                  (10)        ///< Maximum number of times to poll OTP_BOOT_DONE
 #define CS35L41_OTP_SIZE_BYTES                          (32 * 4)    ///< Total size of CS35L41 OTP in bytes
+#define CS35L41_OTP_TRIM_REGS_MAX                       (40)        ///< Maximum number of unique registers trimmed from OTP
+#define CS35L41_POLL_WAKE_MS                            (1)         ///< Delay in ms between polling for wake from hibernate
+#define CS35L41_POLL_WAKE_MAX                           (40)        ///< Maximum number of times to poll for wake per attempt
+#define CS35L41_POLL_WAKE_CMD_RESEND                    (4)         ///< Number of polls between resending OUT_OF_HIBERNATE
+#define CS35L41_RESTORE_IMAGE_WORDS_MAX                 (128)       ///< Maximum number of register values in restore image
+#define CS35L41_RESTORE_IMAGE_RUNS_MAX                  (64)        ///< Maximum number of runs in restore image
+#define CS35L41_FS_SWITCH_SYSCFG_REGS_MAX               (16)        ///< Maximum number of registers in an Fs switch delta
+#define CS35L41_FS_SWITCH_TUNE_BLOCKS_MAX               (64)        ///< Maximum number of tuning blocks in an Fs switch delta
+#define CS35L41_FS_SWITCH_TUNE_GAP_WORDS                (2)         ///< Unchanged words merged into a tuning block to save a write
 
 /**
  * @defgroup CS35L41_POWER_
@@ -119,6 +128,10 @@ extern "C" {
 /** @} */
 
 #define CS35L41_DSP_STATUS_WORDS_TOTAL                  (9)     ///< Total registers to read for Get DSP Status control
+#define CS35L41_TELEMETRY_DEPTH                         (16)    ///< Number of samples held in the Telemetry ring buffer
+#if (CS35L41_TELEMETRY_DEPTH & (CS35L41_TELEMETRY_DEPTH - 1))
+#error "CS35L41_TELEMETRY_DEPTH must be a power of 2"
+#endif
 
 #define CS35L41_CONTROL_PORT_MAX_PAYLOAD_BYTES          (4140)  ///< Maximum bytes CS35L41 can transfer
 
@@ -160,38 +173,58 @@ typedef struct
 } cs35l41_calibration_t;
 
 /**
- * Status of HALO FW
+ * HALO FW status fields
  *
- * List of registers can be accessed via status values, or indexed via words (when reading via Control Port).  These
- * fields are read multiple times to determine statuses such as is_hb_inc and is_temp_changed.
+ * List of registers can be accessed via status values, or indexed via words (when reading via Control Port).
  *
  * @warning  The list of registers MUST correspond to the addresses in cs35l41_dsp_status_controls.
  *
  * @see cs35l41_dsp_status_controls
  */
-typedef struct
+typedef union
 {
-    union
+    uint32_t words[CS35L41_DSP_STATUS_WORDS_TOTAL];
+    struct
     {
-        uint32_t words[CS35L41_DSP_STATUS_WORDS_TOTAL];
-        struct
-        {
-            uint32_t halo_state;
-            uint32_t halo_heartbeat;
-            uint32_t cspl_state;
-            uint32_t cal_set_status;
-            uint32_t cal_r_selected;
-            uint32_t cal_r;
-            uint32_t cal_status;
-            uint32_t cal_checksum;
-            uint32_t cspl_temperature;
-        };
-    } data;                         ///< Data read from Control Port
+        uint32_t halo_state;
+        uint32_t halo_heartbeat;
+        uint32_t cspl_state;
+        uint32_t cal_set_status;
+        uint32_t cal_r_selected;
+        uint32_t cal_r;
+        uint32_t cal_status;
+        uint32_t cal_checksum;
+        uint32_t cspl_temperature;
+    };
+} cs35l41_dsp_status_data_t;
+
+/**
+ * Status of HALO FW
+ *
+ * These fields are read multiple times to determine statuses such as is_hb_inc and is_temp_changed.
+ *
+ * @see cs35l41_dsp_status_data_t
+ */
+typedef struct
+{
+    cs35l41_dsp_status_data_t data; ///< Data read from Control Port
     bool is_hb_inc;                 ///< (True) The HALO HEARTBEAT is incrementing
     bool is_calibration_applied;    ///< (True) Calibration values are applied
     bool is_temp_changed;           ///< (True) Monitored temperature is varying.
 } cs35l41_dsp_status_t;
 
+/**
+ * Timestamped sample of HALO FW status fields collected in Telemetry mode
+ *
+ * @see cs35l41_telemetry_start
+ * @see cs35l41_telemetry_read
+ */
+typedef struct
+{
+    uint32_t timestamp_ms;          ///< Time of sample in ms since cs35l41_telemetry_start
+    cs35l41_dsp_status_data_t data; ///< Data read from Control Port
+} cs35l41_telemetry_sample_t;
+
 /**
  * Configuration parameters required for calls to BSP-Driver Interface
  */
@@ -204,6 +237,44 @@ typedef struct
     regmap_cp_config_t cp_config;                       ///< Regmap control port configuration
 } cs35l41_bsp_config_t;
 
+/**
+ * Run of register writes in the hibernation restore image
+ *
+ * A run with a 'count' of 0 is a delay of 'addr' ms.
+ */
+typedef struct
+{
+    uint32_t addr;      ///< Address of first register in run, or delay in ms
+    uint32_t count;     ///< Number of contiguous registers in run
+} cs35l41_restore_run_t;
+
+/**
+ * Tuning data written as part of an Fs switch
+ *
+ * @see cs35l41_fs_switch_t
+ */
+typedef struct
+{
+    uint32_t addr;                      ///< Control port address of the first word
+    const uint8_t *data;                ///< Pointer to the data within the target tuning fw_img, in bus byte order
+    uint32_t size;                      ///< Size of data in bytes
+} cs35l41_fs_switch_block_t;
+
+/**
+ * Pre-computed delta between the configurations of two sample rates
+ *
+ * @see cs35l41_fs_switch_prepare
+ * @see cs35l41_switch_fs
+ */
+typedef struct
+{
+    uint32_t syscfg[CS35L41_FS_SWITCH_SYSCFG_REGS_MAX * 2];         ///< Address/value pairs that differ
+    uint32_t syscfg_regs;                                           ///< Number of pairs in syscfg
+    cs35l41_fs_switch_block_t tune_blocks[CS35L41_FS_SWITCH_TUNE_BLOCKS_MAX];   ///< Tuning data that differs
+    uint32_t tune_block_count;                                      ///< Number of valid entries in tune_blocks
+    uint32_t tune_bytes;                                            ///< Total size of tune_blocks data in bytes
+} cs35l41_fs_switch_t;
+
 /**
  * Driver configuration data structure
  *
@@ -240,6 +311,28 @@ typedef struct
 
     uint32_t event_flags;               ///< Flags set by Event Handler that are passed to noticiation callback
     uint8_t otp_contents[CS35L41_OTP_SIZE_BYTES];   ///< Cache storage for OTP contents
+    uint32_t otp_trim_addrs[CS35L41_OTP_TRIM_REGS_MAX]; ///< Trimmed register addresses, in ascending order
+    uint32_t otp_trim_vals[CS35L41_OTP_TRIM_REGS_MAX];  ///< Trimmed register values, replayed on restore
+    uint8_t otp_trim_count;                         ///< Number of valid entries in otp_trim_addrs/otp_trim_vals
+
+    // Hibernation restore image
+    bool restore_image_valid;                       ///< (True) restore_runs/restore_vals hold the current restore image
+    uint32_t restore_run_count;                     ///< Number of valid entries in restore_runs
+    uint32_t restore_val_count;                     ///< Number of valid entries in restore_vals
+    cs35l41_restore_run_t restore_runs[CS35L41_RESTORE_IMAGE_RUNS_MAX];   ///< Ordered runs of the restore image
+    uint32_t restore_vals[CS35L41_RESTORE_IMAGE_WORDS_MAX];             ///< Register values of all runs, in order
+
+    // Telemetry state
+    bool telemetry_enabled;                         ///< (True) DSP status is sampled from cs35l41_process
+    uint32_t telemetry_period;                      ///< Sampling period in ms
+    uint32_t telemetry_start;                       ///< BSP time in ms at which sampling started
+    uint32_t telemetry_deadline;                    ///< BSP time in ms at which to take the next sample
+    uint32_t telemetry_addrs[CS35L41_DSP_STATUS_WORDS_TOTAL];           ///< Addresses of DSP status controls
+    uint8_t telemetry_order[CS35L41_DSP_STATUS_WORDS_TOTAL];            ///< Status word indices by ascending address
+    cs35l41_telemetry_sample_t telemetry_buffer[CS35L41_TELEMETRY_DEPTH];   ///< Ring buffer of samples
+    volatile uint32_t telemetry_head;               ///< Count of samples written to telemetry_buffer
+    volatile uint32_t telemetry_tail;               ///< Count of samples read from telemetry_buffer
+    uint32_t telemetry_dropped;                     ///< Count of samples dropped because telemetry_buffer was full
 } cs35l41_t;
 
 /***********************************************************************************************************************
@@ -418,6 +511,62 @@ uint32_t cs35l41_start_tuning_switch(cs35l41_t *driver);
  */
 uint32_t cs35l41_finish_tuning_switch(cs35l41_t *driver);
 
+/**
+ * Pre-compute the delta for switching between two sample rates
+ *
+ * Compares the syscfg and tuning of the current rate ('from') with those of the new rate ('to').  Only the syscfg
+ * registers with a different value, and only the runs of tuning words that differ, are kept for cs35l41_switch_fs.
+ * Tuning blocks of 'to' with no block at the same address and size in 'from' are kept whole.  Tuning data is not
+ * copied, so 'to_tune' must stay valid for as long as 'sw' is used.
+ *
+ * @param [out] sw              Pointer to the delta
+ * @param [in] from_syscfg      Pointer to syscfg address/value pairs of the current rate
+ * @param [in] from_length      Number of words in from_syscfg
+ * @param [in] from_tune        Pointer to tuning fw_img of the current rate
+ * @param [in] to_syscfg        Pointer to syscfg address/value pairs of the new rate
+ * @param [in] to_length        Number of words in to_syscfg
+ * @param [in] to_tune          Pointer to tuning fw_img of the new rate
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL if:
+ *      - any pointer is NULL
+ *      - either syscfg contains encoded operations such as REGMAP_ARRAY_RMODW
+ *      - either fw_img cannot be parsed
+ *      - the delta exceeds CS35L41_FS_SWITCH_SYSCFG_REGS_MAX or CS35L41_FS_SWITCH_TUNE_BLOCKS_MAX
+ * - otherwise, returns CS35L41_STATUS_OK
+ *
+ */
+uint32_t cs35l41_fs_switch_prepare(cs35l41_fs_switch_t *sw,
+                                   const uint32_t *from_syscfg,
+                                   uint16_t from_length,
+                                   const uint8_t *from_tune,
+                                   const uint32_t *to_syscfg,
+                                   uint16_t to_length,
+                                   const uint8_t *to_tune);
+
+/**
+ * Switch sample rate
+ *
+ * Performs the same sequence as cs35l41_start_tuning_switch, writing the syscfg and tuning, and
+ * cs35l41_finish_tuning_switch, but writes only the delta pre-computed by cs35l41_fs_switch_prepare.  The syscfg delta
+ * is written as soon as the PLL has stopped, so the pause window only grows by the size of the tuning delta.
+ *
+ * The device must be running with the configuration 'sw' was prepared from.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] sw               Pointer to the delta
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL if:
+ *      - any pointer is NULL
+ *      - any control port activity fails
+ *      - any status bit polling times out
+ *      - any mailbox status is not correct for the command sent
+ * - otherwise, returns CS35L41_STATUS_OK
+ *
+ */
+uint32_t cs35l41_switch_fs(cs35l41_t *driver, const cs35l41_fs_switch_t *sw);
+
 /**
  * Calibrate the HALO DSP Protection Algorithm
  *
@@ -468,6 +617,57 @@ uint32_t cs35l41_calibrate(cs35l41_t *driver, uint32_t ambient_temp_deg_c);
  */
 uint32_t cs35l41_get_dsp_status(cs35l41_t *driver, cs35l41_dsp_status_t *status);
 
+/**
+ * Start DSP Telemetry
+ *
+ * Resolves the DSP status controls, then samples them from cs35l41_process every period_ms without blocking.  Controls
+ * at contiguous addresses are read with a single block read.  Each sample is timestamped and pushed to a ring buffer
+ * of CS35L41_TELEMETRY_DEPTH samples, from which it can be pulled with cs35l41_telemetry_read.  Samples are only taken
+ * while the driver is in CS35L41_STATE_DSP_POWER_UP.
+ *
+ * Sampling is timed against deadlines from the BSP get_time_ms, so a sample that falls due while the control path is
+ * busy is taken on the next call to cs35l41_process.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] period_ms        Sampling period in ms
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL if:
+ *      - period_ms is 0
+ *      - The BSP does not provide get_time_ms
+ *      - Required FW Control symbols are not found in the symbol table
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+uint32_t cs35l41_telemetry_start(cs35l41_t *driver, uint32_t period_ms);
+
+/**
+ * Stop DSP Telemetry
+ *
+ * Samples already in the ring buffer can still be read.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return                      always CS35L41_STATUS_OK
+ *
+ */
+uint32_t cs35l41_telemetry_stop(cs35l41_t *driver);
+
+/**
+ * Pull the oldest DSP Telemetry sample
+ *
+ * Never accesses the Control Port, so it is safe to call from a different context than cs35l41_process.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [out] sample          Pointer to store oldest sample
+ *
+ * @return
+ * - CS35L41_STATUS_FAIL        if the ring buffer is empty
+ * - CS35L41_STATUS_OK          otherwise
+ *
+ */
+uint32_t cs35l41_telemetry_read(cs35l41_t *driver, cs35l41_telemetry_sample_t *sample);
+
 /*
  * Reads the contents of a single register/memory address
  *
@@ -28,7 +28,6 @@
 #include "platform_bsp.h"
 #include "cs35l42.h"
 #include "cs35l42_ext.h"
-#include "test_tone_tables.h"
 
 /***********************************************************************************************************************
  * LOCAL LITERAL SUBSTITUTIONS
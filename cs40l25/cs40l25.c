@@ -25,6 +25,7 @@
 #include <stddef.h>
 #include "cs40l25.h"
 #include "bsp_driver_if.h"
+#include "crc32.h"
 #include "string.h"
 
 /***********************************************************************************************************************
@@ -203,6 +204,11 @@
 #define CS40L25_FIRMWARE_REVISION               (0x2800010)     ///< Register address for Firmware Revision
 #define CS40L25_FWID_CAL                        (0x1400C6)      ///< Firmware ID for Calibration Firmware
 
+// wseq_changed tracks one bit per entry, and the address index must always have an empty slot
+#if (CS40L25_WSEQ_MAX_ENTRIES > 64) || (CS40L25_WSEQ_INDEX_SIZE <= CS40L25_WSEQ_MAX_ENTRIES)
+#error "CS40L25_WSEQ_MAX_ENTRIES incompatible with WSEQ change tracking"
+#endif
+
 /***********************************************************************************************************************
  * LOCAL VARIABLES
  **********************************************************************************************************************/
@@ -514,6 +520,107 @@ static void cs40l25_irq_callback(uint32_t status, void *cb_arg)
     return;
 }
 
+/**
+ * Hash a HW register address to a slot in the WSEQ address index
+ *
+ * @param [in] address          HW register address
+ *
+ * @return                      Starting slot in wseq_index for probing
+ *
+ */
+static inline uint32_t cs40l25_wseq_hash(uint32_t address)
+{
+    // Addresses are word-aligned, so drop the 2 LSBs before multiplicative (Fibonacci) hashing
+    return ((address >> 2) * 0x9E3779B1) >> (32 - CS40L25_WSEQ_INDEX_BITS);
+}
+
+/**
+ * Find the WSEQ Table entry for a HW register address
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] address          HW register address to find
+ *
+ * @return
+ * - index of entry in wseq_table if address is found
+ * - CS40L25_WSEQ_MAX_ENTRIES otherwise
+ *
+ */
+static uint32_t cs40l25_wseq_index_find(cs40l25_t *driver, uint32_t address)
+{
+    uint32_t slot = cs40l25_wseq_hash(address);
+
+    for (uint32_t i = 0; i < CS40L25_WSEQ_INDEX_SIZE; i++)
+    {
+        uint32_t entry = driver->wseq_index[slot];
+        cs40l25_wseq_entry_t *e;
+
+        if (entry == 0)
+        {
+            break;
+        }
+
+        e = &(driver->wseq_table[entry - 1]);
+        if ((((uint32_t) e->address_ms << 8) | e->address_ls) == address)
+        {
+            return entry - 1;
+        }
+
+        slot = (slot + 1) & (CS40L25_WSEQ_INDEX_SIZE - 1);
+    }
+
+    return CS40L25_WSEQ_MAX_ENTRIES;
+}
+
+/**
+ * Add a HW register address to the WSEQ address index
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] address          HW register address
+ * @param [in] entry            index of entry in wseq_table
+ *
+ * @return none
+ *
+ */
+static void cs40l25_wseq_index_add(cs40l25_t *driver, uint32_t address, uint32_t entry)
+{
+    uint32_t slot = cs40l25_wseq_hash(address);
+
+    // Index is sized larger than wseq_table, so there is always an empty slot
+    while (driver->wseq_index[slot] != 0)
+    {
+        slot = (slot + 1) & (CS40L25_WSEQ_INDEX_SIZE - 1);
+    }
+
+    driver->wseq_index[slot] = entry + 1;
+
+    return;
+}
+
+/**
+ * Encode a HW register address/value into a WSEQ entry
+ *
+ * @param [out] entry           Pointer to the WSEQ entry
+ * @param [in] address          32-bit address of entry
+ * @param [in] value            32-bit value of entry
+ *
+ * @return none
+ *
+ */
+static void cs40l25_wseq_entry_set(cs40l25_wseq_entry_t *entry, uint32_t address, uint32_t value)
+{
+    // Make sure reserved* members are 0
+    entry->words[0] = 0;
+    entry->words[1] = 0;
+    entry->address_ms = (address & 0xFF00) >> 8;
+    entry->address_ls = address & 0x00FF;
+    entry->val_3 = (value & 0xFF000000) >> 24;
+    entry->val_2 = (value & 0x00FF0000) >> 16;
+    entry->val_1 = (value & 0x0000FF00) >> 8;
+    entry->val_0 = value & 0x000000FF;
+
+    return;
+}
+
 /**
  * Add entry to the WSEQ Table
  *
@@ -530,39 +637,35 @@ static void cs40l25_irq_callback(uint32_t status, void *cb_arg)
  */
 static uint32_t cs40l25_wseq_table_add(cs40l25_t *driver, uint32_t address, uint32_t value)
 {
-    uint32_t ret = CS40L25_STATUS_OK;
-
-    cs40l25_wseq_entry_t *table = (cs40l25_wseq_entry_t *) &driver->wseq_table;
     uint32_t num_entries = driver->wseq_num_entries;
 
-    if (num_entries < CS40L25_WSEQ_MAX_ENTRIES)
+    if (num_entries >= CS40L25_WSEQ_MAX_ENTRIES)
     {
-        table[num_entries].address_ms = (address & 0xFF00) >> 8;
-        table[num_entries].address_ls = address & 0x00FF;
-        table[num_entries].val_3 = (value & 0xFF000000) >> 24;
-        table[num_entries].val_2 = (value & 0x00FF0000) >> 16;
-        table[num_entries].val_1 = (value & 0x0000FF00) >> 8;
-        table[num_entries].val_0 = value & 0x000000FF;
-        table[num_entries].changed = 1;
-        // Make sure reserved* members are 0
-        table[num_entries].reserved_0 = 0;
-        table[num_entries].reserved_1 = 0;
-
-        driver->wseq_num_entries += 1;
+        return CS40L25_STATUS_FAIL;
     }
-    else
+
+    cs40l25_wseq_entry_set(&(driver->wseq_table[num_entries]), address, value);
+    driver->wseq_changed |= ((uint64_t) 1 << num_entries);
+
+    // Test key entries appear more than once and are never updated, so are not indexed
+    if ((address != CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG) &&
+        (cs40l25_wseq_index_find(driver, address) == CS40L25_WSEQ_MAX_ENTRIES))
     {
-        ret = CS40L25_STATUS_FAIL;
+        cs40l25_wseq_index_add(driver, address, num_entries);
     }
 
-    return ret;
+    driver->wseq_num_entries += 1;
+
+    return CS40L25_STATUS_OK;
 }
 
 /**
  * Update WSEQ Table with a new HW register value
  *
  * The WSEQ Table will be updated with a new value.  If an entry for the HW register address already exists, the value
- * only will be updated.  If an entry does not exist, a new entry will be added to the WSEQ Table.
+ * only will be updated.  If an entry does not exist, a new entry will be added to the WSEQ Table just before the
+ * register file locking entries.  Entries are only marked as changed here, and are written to POWERONSEQUENCE by
+ * cs40l25_wseq_flush.  The HW register itself is not written.
  *
  * @param [in] driver           Pointer to the driver state
  * @param [in] addr             32-bit address of new entry
@@ -573,73 +676,82 @@ static uint32_t cs40l25_wseq_table_add(cs40l25_t *driver, uint32_t address, uint
  * - CS40L25_STATUS_OK          otherwise
  *
  */
-static uint32_t cs40l25_write_wseq_reg(cs40l25_t *driver, uint32_t address, uint32_t value)
+static uint32_t cs40l25_wseq_update(cs40l25_t *driver, uint32_t address, uint32_t value)
 {
-    uint32_t ret;
-    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+    uint32_t i;
+    uint32_t num_entries = driver->wseq_num_entries;
+    cs40l25_wseq_entry_t *table = driver->wseq_table;
 
-    ret = regmap_write(cp, address, value);
-    if (ret)
+    if ((!driver->wseq_initialized) ||
+        (address >= 0xFFFF) ||
+        (address == CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG))
     {
-        return CS40L25_STATUS_FAIL;
+        return CS40L25_STATUS_OK;
     }
 
-    ret = CS40L25_STATUS_OK;
+    i = cs40l25_wseq_index_find(driver, address);
 
-    if (!driver->wseq_initialized)
+    if (i < num_entries)
     {
-        return ret;
-    }
+        cs40l25_wseq_entry_t temp;
 
-    cs40l25_wseq_entry_t *table = (cs40l25_wseq_entry_t *) &driver->wseq_table;
+        cs40l25_wseq_entry_set(&temp, address, value);
+        if ((temp.words[0] != table[i].words[0]) || (temp.words[1] != table[i].words[1]))
+        {
+            table[i] = temp;
+            driver->wseq_changed |= ((uint64_t) 1 << i);
+        }
+
+        return CS40L25_STATUS_OK;
+    }
 
-    if (address < 0xFFFF)
+    //Add new address to end of table if there is space
+    if (num_entries >= CS40L25_WSEQ_MAX_ENTRIES)
     {
-        uint32_t num_entries = driver->wseq_num_entries;
-        bool address_found = false;
-        for (uint32_t i = 0; i < num_entries; i++) {
-            uint32_t temp_address = (table[i].address_ms << 8) | (table[i].address_ls);
-            uint32_t temp_value = (table[i].val_3 << 24) | (table[i].val_2 << 16) |
-                                  (table[i].val_1 << 8) | (table[i].val_0);
-            if (temp_address == address)
-            {
-                if ((temp_value != value) &&
-                    (address != CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG))
-                {
-                    table[i].val_3 = (value & 0xFF000000) >> 24;
-                    table[i].val_2 = (value & 0x00FF0000) >> 16;
-                    table[i].val_1 = (value & 0x0000FF00) >> 8;
-                    table[i].val_0 = value & 0x000000FF;
-                    table[i].changed = 1;
-                }
+        return CS40L25_STATUS_FAIL;
+    }
 
-                address_found = true;
-            }
-        }
+    //Shift the locking entries (the last two entries) back to the end and put the new entry in front of them.  All
+    //three entries have a new position in POWERONSEQUENCE, and since they are adjacent they will be written over the
+    //bus in a single block.
+    table[num_entries] = table[num_entries - 1];
+    table[num_entries - 1] = table[num_entries - 2];
+    cs40l25_wseq_entry_set(&(table[num_entries - 2]), address, value);
+    cs40l25_wseq_index_add(driver, address, num_entries - 2);
+    driver->wseq_changed |= ((uint64_t) 0x7 << (num_entries - 2));
+    driver->wseq_num_entries += 1;
 
-        if (!address_found && address != CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG)
-        {
-            //Add new address to end of table if there is space
-            ret = cs40l25_wseq_table_add(driver, address, value);
-            num_entries = driver->wseq_num_entries;
-            if (ret == CS40L25_STATUS_OK)
-            {
-                //Shift the locking entries ( the last two entries ) back to the end
-                //after appending the new entry. Set all entries to changed = 1, as
-                //they now have a new position in POWERONSEQUENCE and must be written
-                //over the bus.
-                cs40l25_wseq_entry_t temp;
-                temp = table[num_entries - 1];
-                table[num_entries - 1] = table[num_entries - 2];
-                table[num_entries - 1].changed = 1;
-                table[num_entries - 2] = table[num_entries - 3];
-                table[num_entries - 2].changed = 1;
-                table[num_entries - 3] = temp;
-            }
-        }
+    return CS40L25_STATUS_OK;
+}
+
+/**
+ * Write a HW register and update WSEQ Table with the new value
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] addr             32-bit address of HW register
+ * @param [in] value            32-bit value to write
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL if:
+ *      - Control port activity fails
+ *      - WSEQ table is full
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ * @see cs40l25_wseq_update
+ *
+ */
+static uint32_t cs40l25_write_wseq_reg(cs40l25_t *driver, uint32_t address, uint32_t value)
+{
+    uint32_t ret;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    ret = regmap_write(cp, address, value);
+    if (ret)
+    {
+        return CS40L25_STATUS_FAIL;
     }
 
-    return ret;
+    return cs40l25_wseq_update(driver, address, value);
 }
 
 /**
@@ -674,145 +786,469 @@ static uint32_t cs40l25_wseq_add_block(cs40l25_t *driver, uint32_t *entries, uin
 }
 
 /**
- * Write ACK-ed firmware control with CS40L25-specific polling tries and delay
+ * Write changed WSEQ Table entries to POWERONSEQUENCE
+ *
+ * Only entries marked as changed are written.  Runs of adjacent changed entries are written with a single block write,
+ * since the WSEQ Table is laid out the same as POWERONSEQUENCE.  The end-of-sequence marker is always written.
  *
  * @param [in] driver           Pointer to the driver state
- * @param [in] id               symbol id of firmware control to write
- * @param [in] val              value to write
  *
  * @return
- * - CS40L25_STATUS_FAIL        if underlying regmap call fails
+ * - CS40L25_STATUS_FAIL if:
+ *      - Control port activity fails
+ *      - POWERONSEQUENCE address cannot be resolved by Symbol ID
  * - CS40L25_STATUS_OK          otherwise
  *
  */
-static uint32_t cs40l25_write_acked_fw_control(cs40l25_t *driver, uint32_t id, uint32_t val)
+static uint32_t cs40l25_wseq_flush(cs40l25_t *driver)
 {
     uint32_t ret;
+    uint32_t reg_address;
+    uint32_t count = 0;
+    uint32_t num_entries = driver->wseq_num_entries;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
-    ret = regmap_write_acked_fw_control(cp,
-                                        driver->fw_info,
-                                        id,
-                                        val,
-                                        0,
-                                        CS40L25_POLL_ACK_CTRL_MAX,
-                                        CS40L25_POLL_ACK_CTRL_MS);
-    if (ret)
+    reg_address = fw_img_find_symbol(driver->fw_info, CS40L25_SYM_FIRMWARE_POWERONSEQUENCE);
+    if (!reg_address)
     {
-        ret = CS40L25_STATUS_FAIL;
+        return CS40L25_STATUS_FAIL;
     }
-    else
+
+    while (count < num_entries)
     {
-        ret = CS40L25_STATUS_OK;
+        uint32_t start = count;
+
+        if (!(driver->wseq_changed & ((uint64_t) 1 << count)))
+        {
+            count++;
+            continue;
+        }
+
+        while ((count < num_entries) && (driver->wseq_changed & ((uint64_t) 1 << count)))
+        {
+            count++;
+        }
+
+        //Write run of 16bit address and 32bit value entries to poweronsequence
+        ret = regmap_write_block(cp,
+                                 reg_address + (8 * start),
+                                 (uint8_t *) driver->wseq_table[start].words,
+                                 8 * (count - start));
+        if (ret)
+        {
+            return CS40L25_STATUS_FAIL;
+        }
+
+        driver->wseq_changed &= ~((((uint64_t) 1 << (count - start)) - 1) << start);
     }
 
-    return ret;
+    ret = regmap_write(cp, reg_address + (8 * num_entries), 0x00FFFFFF);
+    if (ret)
+    {
+        return CS40L25_STATUS_FAIL;
+    }
+
+    return CS40L25_STATUS_OK;
 }
 
 /**
- * Power up from Standby
+ * Begin a configuration transaction
  *
- * This function performs all necessary steps to transition the CS40L25 to be ready to generate haptic events.
- * Completing this results in the driver transition to POWER_UP state.
+ * Discards any entries left from a previous transaction.  Until cs40l25_txn_commit, register changes are only recorded
+ * with cs40l25_txn_update_reg and cs40l25_txn_read_reg, so other control port activity (e.g. mailbox writes) may be
+ * done while a transaction is open.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return none
+ *
+ */
+static void cs40l25_txn_begin(cs40l25_t *driver)
+{
+    driver->txn_num_entries = 0;
+    driver->txn_overflow = false;
+
+    return;
+}
+
+/**
+ * Record a change to bits of a HW register in the current configuration transaction
+ *
+ * If the register is already recorded, the change is merged into the existing entry, so the register keeps its
+ * original position in the transaction.  A mask of 0 records the register to be read only.
  *
  * @param [in] driver           Pointer to the driver state
+ * @param [in] address          32-bit address of HW register
+ * @param [in] mask             Bits of register to change
+ * @param [in] value            New value of bits selected by mask
  *
  * @return
- * - CS40L25_STATUS_FAIL if:
- *      - OTP_BOOT_DONE is not set
- *      - DSP Scratch register is not cleared
+ * - CS40L25_STATUS_FAIL        if the transaction is full
  * - CS40L25_STATUS_OK          otherwise
  *
  */
-static uint32_t cs40l25_power_up(cs40l25_t *driver)
+static uint32_t cs40l25_txn_update_reg(cs40l25_t *driver, uint32_t address, uint32_t mask, uint32_t value)
 {
-    uint32_t count = 0;
-    uint32_t temp_reg_val = 0;
-    uint32_t ret;
-    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
-
-    // Write errata
-    regmap_write_array(cp,
-                       (uint32_t *) cs40l25_revb0_errata_patch,
-                       (sizeof(cs40l25_revb0_errata_patch)/sizeof(uint32_t)));
+    cs40l25_txn_entry_t *e;
 
-    // Set HALO Core DSP Sample Rate registers to G1R2
-    for (count = 0; count < (sizeof(cs40l25_frame_sync_regs)/sizeof(uint32_t)); count++)
+    for (uint32_t i = 0; i < driver->txn_num_entries; i++)
     {
-        regmap_write(cp, cs40l25_frame_sync_regs[count], CS40L25_DSP1_SAMPLE_RATE_G1R2);
-    }
-
-    // Send words of Power Up Patch
-    regmap_write_array(cp,
-                       (uint32_t *) cs40l25_pup_patch,
-                       (sizeof(cs40l25_pup_patch)/sizeof(uint32_t)));
-
-    // Enable clocks to HALO Core DSP in DSP CCM control register
-    regmap_update_reg(cp,
-                      XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_REG,
-                      (XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_DSP1_CCM_CORE_EN_BITMASK | \
-                        XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_DSP1_CCM_CORE_RESET_BITMASK),
-                      (XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_DSP1_CCM_CORE_EN_BITMASK | \
-                       XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_DSP1_CCM_CORE_RESET_BITMASK));
+        e = &(driver->txn[i]);
+        if (e->address == address)
+        {
+            e->value = (e->value & ~mask) | (value & mask);
+            e->mask |= mask;
 
-    if (driver->state == CS40L25_STATE_CAL_STANDBY)
-    {
-        ret = regmap_poll_fw_control(cp,
-                                     driver->fw_info,
-                                     CS40L25_CAL_SYM_FIRMWARE_HALO_STATE,
-                                     0xCB,
-                                     CS40L25_POLL_OTP_BOOT_DONE_MAX,
-                                     CS40L25_T_BST_PUP_MS);
-    }
-    else
-    {
-        ret = regmap_poll_fw_control(cp,
-                                     driver->fw_info,
-                                     CS40L25_SYM_FIRMWARE_HALO_STATE,
-                                     0xCB,
-                                     CS40L25_POLL_OTP_BOOT_DONE_MAX,
-                                     CS40L25_T_BST_PUP_MS);
-    }
-    if (ret)
-    {
-        return CS40L25_STATUS_FAIL;
+            return CS40L25_STATUS_OK;
+        }
     }
 
-    regmap_read(cp, XM_UNPACKED24_DSP1_SCRATCH_REG, &temp_reg_val);
-
-    if (temp_reg_val)
+    if (driver->txn_num_entries >= CS40L25_TXN_MAX_ENTRIES)
     {
+        driver->txn_overflow = true;
+
         return CS40L25_STATUS_FAIL;
     }
 
+    e = &(driver->txn[driver->txn_num_entries]);
+    e->address = address;
+    e->mask = mask;
+    e->value = value & mask;
+    driver->txn_num_entries += 1;
+
     return CS40L25_STATUS_OK;
 }
 
 /**
- * Power down to Standby
+ * Record a HW register to be read in the current configuration transaction
  *
- * This function performs all necessary steps to transition the CS40L25 to be in Standby power mode. This includes
- * disabling clocks to the HALO Core DSP.  Completing this results in the driver transition to CAL_STANDBY or
- * DSP_STANDBY state.
+ * The value read is available from cs40l25_txn_get_reg after cs40l25_txn_commit.  Recording a register adjacent to one
+ * that is modified lets it be read in the same block as the modified register's snapshot.
  *
  * @param [in] driver           Pointer to the driver state
+ * @param [in] address          32-bit address of HW register
  *
  * @return
- * - CS40L25_STATUS_FAIL if:
- *      - Control port activity fails
- *      - Firmware control addresses cannot be resolved by Symbol ID
+ * - CS40L25_STATUS_FAIL        if the transaction is full
  * - CS40L25_STATUS_OK          otherwise
  *
  */
-static uint32_t cs40l25_power_down(cs40l25_t *driver)
+static inline uint32_t cs40l25_txn_read_reg(cs40l25_t *driver, uint32_t address)
 {
-    uint32_t ret;
-    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+    return cs40l25_txn_update_reg(driver, address, 0, 0);
+}
 
-    // Force fw into standby
-    if (driver->state == CS40L25_STATE_CAL_POWER_UP)
-    {
-        ret = cs40l25_write_acked_fw_control(driver, CS40L25_CAL_SYM_FIRMWARE_SHUTDOWNREQUEST, 1);
+/**
+ * Get the value of a HW register after the current configuration transaction was committed
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] address          32-bit address of HW register
+ * @param [out] value           Pointer to the value read or written by cs40l25_txn_commit
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL        if the register was not recorded in the transaction
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l25_txn_get_reg(cs40l25_t *driver, uint32_t address, uint32_t *value)
+{
+    for (uint32_t i = 0; i < driver->txn_num_entries; i++)
+    {
+        if (driver->txn[i].address == address)
+        {
+            *value = driver->txn[i].value;
+
+            return CS40L25_STATUS_OK;
+        }
+    }
+
+    return CS40L25_STATUS_FAIL;
+}
+
+/**
+ * Commit the current configuration transaction
+ *
+ * Registers with only some bits changed, or recorded to be read only, are snapshot first, with each run of recorded
+ * registers at adjacent addresses read in one block.  The final value of each register is computed once from the
+ * snapshot.  Changed registers are then written in the order recorded, with each run of registers at adjacent
+ * addresses written in one block, and registers whose value would not change are skipped.  Finally the WSEQ Table is
+ * updated with the final value of every modified register, which cs40l25_wseq_flush later writes to POWERONSEQUENCE
+ * with the rest of the table.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL if:
+ *      - A change was dropped because the transaction was full
+ *      - Control port activity fails
+ *      - WSEQ table is full
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l25_txn_commit(cs40l25_t *driver)
+{
+    uint32_t ret;
+    uint32_t count = 0;
+    uint32_t num_entries = driver->txn_num_entries;
+    cs40l25_txn_entry_t *txn = driver->txn;
+    uint32_t vals[CS40L25_TXN_MAX_ENTRIES];
+    bool is_write[CS40L25_TXN_MAX_ENTRIES];
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    if (driver->txn_overflow)
+    {
+        return CS40L25_STATUS_FAIL;
+    }
+
+    // Snapshot all registers that are not completely overwritten
+    while (count < num_entries)
+    {
+        uint32_t start = count;
+
+        if (txn[count].mask == 0xFFFFFFFF)
+        {
+            count++;
+            continue;
+        }
+
+        do
+        {
+            count++;
+        } while ((count < num_entries) &&
+                 (txn[count].mask != 0xFFFFFFFF) &&
+                 (txn[count].address == (txn[count - 1].address + 4)));
+
+        ret = regmap_read_words(cp, txn[start].address, &(vals[start]), count - start);
+        if (ret)
+        {
+            return CS40L25_STATUS_FAIL;
+        }
+    }
+
+    for (uint32_t i = 0; i < num_entries; i++)
+    {
+        uint32_t final = txn[i].value;
+
+        if (txn[i].mask != 0xFFFFFFFF)
+        {
+            final = (vals[i] & ~txn[i].mask) | (txn[i].value & txn[i].mask);
+        }
+
+        is_write[i] = (txn[i].mask == 0xFFFFFFFF) || ((txn[i].mask != 0) && (final != vals[i]));
+        vals[i] = final;
+        txn[i].value = final;
+    }
+
+    // Write all changed registers
+    count = 0;
+    while (count < num_entries)
+    {
+        uint32_t start = count;
+
+        if (!is_write[count])
+        {
+            count++;
+            continue;
+        }
+
+        do
+        {
+            count++;
+        } while ((count < num_entries) &&
+                 (is_write[count]) &&
+                 (txn[count].address == (txn[count - 1].address + 4)));
+
+        ret = regmap_write_words(cp, txn[start].address, &(vals[start]), count - start);
+        if (ret)
+        {
+            return CS40L25_STATUS_FAIL;
+        }
+    }
+
+    for (uint32_t i = 0; i < num_entries; i++)
+    {
+        if (txn[i].mask == 0)
+        {
+            continue;
+        }
+
+        ret = cs40l25_wseq_update(driver, txn[i].address, txn[i].value);
+        if (ret)
+        {
+            return CS40L25_STATUS_FAIL;
+        }
+    }
+
+    return CS40L25_STATUS_OK;
+}
+
+/**
+ * Write ACK-ed firmware control with CS40L25-specific polling tries and delay
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] id               symbol id of firmware control to write
+ * @param [in] val              value to write
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL        if underlying regmap call fails
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l25_write_acked_fw_control(cs40l25_t *driver, uint32_t id, uint32_t val)
+{
+    uint32_t ret;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    ret = regmap_write_acked_fw_control(cp,
+                                        driver->fw_info,
+                                        id,
+                                        val,
+                                        0,
+                                        CS40L25_POLL_ACK_CTRL_MAX,
+                                        CS40L25_POLL_ACK_CTRL_MS);
+    if (ret)
+    {
+        ret = CS40L25_STATUS_FAIL;
+    }
+    else
+    {
+        ret = CS40L25_STATUS_OK;
+    }
+
+    return ret;
+}
+
+/**
+ * Add a firmware control to a list for regmap_write_fw_controls, if the loaded firmware has it
+ *
+ * regmap_write_fw_controls writes nothing if any control in the list is missing, so controls the firmware lacks are
+ * left out, and the rest are still written as they would be one at a time.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] controls         List of symbol_id/value pairs
+ * @param [in] count            Number of pairs already in controls
+ * @param [in] id               symbol id of firmware control to add
+ * @param [in] val              value to add
+ *
+ * @return Number of pairs in controls after adding
+ *
+ */
+static uint32_t cs40l25_add_fw_control(cs40l25_t *driver, uint32_t *controls, uint32_t count, uint32_t id, uint32_t val)
+{
+    if (fw_img_find_symbol(driver->fw_info, id))
+    {
+        controls[count * 2] = id;
+        controls[(count * 2) + 1] = val;
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * Power up from Standby
+ *
+ * This function performs all necessary steps to transition the CS40L25 to be ready to generate haptic events.
+ * Completing this results in the driver transition to POWER_UP state.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL if:
+ *      - OTP_BOOT_DONE is not set
+ *      - DSP Scratch register is not cleared
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l25_power_up(cs40l25_t *driver)
+{
+    uint32_t count = 0;
+    uint32_t temp_reg_val = 0;
+    uint32_t ret;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    // Write errata
+    regmap_write_array(cp,
+                       (uint32_t *) cs40l25_revb0_errata_patch,
+                       (sizeof(cs40l25_revb0_errata_patch)/sizeof(uint32_t)));
+
+    // Set HALO Core DSP Sample Rate registers to G1R2
+    for (count = 0; count < (sizeof(cs40l25_frame_sync_regs)/sizeof(uint32_t)); count++)
+    {
+        regmap_write(cp, cs40l25_frame_sync_regs[count], CS40L25_DSP1_SAMPLE_RATE_G1R2);
+    }
+
+    // Send words of Power Up Patch
+    regmap_write_array(cp,
+                       (uint32_t *) cs40l25_pup_patch,
+                       (sizeof(cs40l25_pup_patch)/sizeof(uint32_t)));
+
+    // Enable clocks to HALO Core DSP in DSP CCM control register
+    regmap_update_reg(cp,
+                      XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_REG,
+                      (XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_DSP1_CCM_CORE_EN_BITMASK | \
+                        XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_DSP1_CCM_CORE_RESET_BITMASK),
+                      (XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_DSP1_CCM_CORE_EN_BITMASK | \
+                       XM_UNPACKED24_DSP1_CCM_CORE_CONTROL_DSP1_CCM_CORE_RESET_BITMASK));
+
+    if (driver->state == CS40L25_STATE_CAL_STANDBY)
+    {
+        ret = regmap_poll_fw_control(cp,
+                                     driver->fw_info,
+                                     CS40L25_CAL_SYM_FIRMWARE_HALO_STATE,
+                                     0xCB,
+                                     CS40L25_POLL_OTP_BOOT_DONE_MAX,
+                                     CS40L25_T_BST_PUP_MS);
+    }
+    else
+    {
+        ret = regmap_poll_fw_control(cp,
+                                     driver->fw_info,
+                                     CS40L25_SYM_FIRMWARE_HALO_STATE,
+                                     0xCB,
+                                     CS40L25_POLL_OTP_BOOT_DONE_MAX,
+                                     CS40L25_T_BST_PUP_MS);
+    }
+    if (ret)
+    {
+        return CS40L25_STATUS_FAIL;
+    }
+
+    regmap_read(cp, XM_UNPACKED24_DSP1_SCRATCH_REG, &temp_reg_val);
+
+    if (temp_reg_val)
+    {
+        return CS40L25_STATUS_FAIL;
+    }
+
+    return CS40L25_STATUS_OK;
+}
+
+/**
+ * Power down to Standby
+ *
+ * This function performs all necessary steps to transition the CS40L25 to be in Standby power mode. This includes
+ * disabling clocks to the HALO Core DSP.  Completing this results in the driver transition to CAL_STANDBY or
+ * DSP_STANDBY state.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL if:
+ *      - Control port activity fails
+ *      - Firmware control addresses cannot be resolved by Symbol ID
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l25_power_down(cs40l25_t *driver)
+{
+    uint32_t ret;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    // Force fw into standby
+    if (driver->state == CS40L25_STATE_CAL_POWER_UP)
+    {
+        ret = cs40l25_write_acked_fw_control(driver, CS40L25_CAL_SYM_FIRMWARE_SHUTDOWNREQUEST, 1);
     }
     else
     {
@@ -933,34 +1369,15 @@ static uint32_t cs40l25_exit_bhm(cs40l25_t *driver)
  */
 static uint32_t cs40l25_hibernate(cs40l25_t *driver)
 {
-    uint32_t count = 0;
-    uint32_t reg_address;
+    uint32_t ret;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
-    reg_address = fw_img_find_symbol(driver->fw_info, CS40L25_SYM_FIRMWARE_POWERONSEQUENCE);
-    if (!reg_address)
+    ret = cs40l25_wseq_flush(driver);
+    if (ret)
     {
         return CS40L25_STATUS_FAIL;
     }
 
-    while (count < driver->wseq_num_entries)
-    {
-        if (driver->wseq_table[count].changed == 1)
-        {
-            //Write 16bit address and 32bit value to poweronsequence
-            regmap_write_block(cp,
-                               reg_address + (8 * count),
-                               (uint8_t *) driver->wseq_table[count].words,
-                               8);
-
-            driver->wseq_table[count].changed = 0;
-        }
-
-        count++;
-    }
-
-    regmap_write(cp, reg_address + (8 * count), 0x00FFFFFF);
-
     regmap_write(cp, DSP_VIRTUAL1_MBOX_DSP_VIRTUAL1_MBOX_4_REG, CS40L25_POWERCONTROL_HIBERNATE);
 
     return CS40L25_STATUS_OK;
@@ -1092,101 +1509,454 @@ static uint32_t cs40l25_event_handler(cs40l25_t *driver)
     uint32_t msm_block_enables_val;
     uint8_t count;
     uint32_t temp_event_control = driver->config.event_control.reg.word;
+    uint32_t event_addr[CS40L25_EVENT_SOURCES];
+    uint32_t event_val[CS40L25_EVENT_SOURCES];
+    uint32_t event_snapshot[REGMAP_WORDS_MAX];
+    uint32_t event_base = 0xFFFFFFFF;
+    uint32_t event_end = 0;
+    uint32_t event_words;
+    uint32_t triggered = 0;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
-    // Clear the event flags
-    driver->event_flags = 0;
+    // Clear the event flags
+    driver->event_flags = 0;
+
+    // Read the first IRQ1 flag register
+    ret = regmap_read(cp, XM_UNPACKED24_DSP1_SCRATCH_REG, &temp_reg_val);
+
+    // If SCRATCH is nonzero OR CP transaction error
+    if (temp_reg_val || (ret != CS40L25_STATUS_OK))
+    {
+        driver->event_flags = CS40L25_EVENT_FLAG_DSP_ERROR;
+
+        return CS40L25_STATUS_OK;
+    }
+
+    // Resolve event control addresses, to snapshot them in as few transactions as possible
+    for (count = 0; count < CS40L25_EVENT_SOURCES; count++)
+    {
+        event_addr[count] = fw_img_find_symbol(driver->fw_info, cs40l2x_event_controls[count]);
+        event_val[count] = CS40L2X_EVENT_CTRL_NONE;
+
+        // Event controls not present in the firmware are never triggered
+        if (event_addr[count] == 0)
+        {
+            continue;
+        }
+
+        if (event_addr[count] < event_base)
+        {
+            event_base = event_addr[count];
+        }
+        if (event_addr[count] > event_end)
+        {
+            event_end = event_addr[count];
+        }
+    }
+
+    event_words = (event_end < event_base) ? 0 : (((event_end - event_base) >> 2) + 1);
+
+    // If all event controls are close together in XM, read them with a single block read
+    if (event_words <= REGMAP_WORDS_MAX)
+    {
+        ret = regmap_read_words(cp, event_base, event_snapshot, event_words);
+        if (ret)
+        {
+            return CS40L25_STATUS_FAIL;
+        }
+
+        for (count = 0; count < CS40L25_EVENT_SOURCES; count++)
+        {
+            if (event_addr[count] != 0)
+            {
+                event_val[count] = event_snapshot[(event_addr[count] - event_base) >> 2];
+            }
+        }
+    }
+    else
+    {
+        for (count = 0; count < CS40L25_EVENT_SOURCES; count++)
+        {
+            if (event_addr[count] != 0)
+            {
+                regmap_read(cp, event_addr[count], &(event_val[count]));
+            }
+        }
+    }
+
+    // Process unmasked event registers
+    for (count = 0; count < CS40L25_EVENT_SOURCES; count++)
+    {
+        temp_reg_val = event_val[count];
+
+        if ((temp_reg_val == CS40L2X_EVENT_CTRL_NONE) || ((temp_event_control & cs40l2x_event_masks[count]) == 0))
+        {
+            continue;
+        }
+
+        // If event is HW Event, then process separately
+        if (temp_reg_val == CS40L2X_EVENT_CTRL_HARDWARE)
+        {
+            // Read the first IRQ2 flag register
+            regmap_read(cp, IRQ2_IRQ2_EINT_1_REG, &temp_reg_val);
+
+            // Set flags in event_flags
+            for (uint8_t i = 0; i < (CS40L25_EVENT_HW_SOURCES * 2); i += 2)
+            {
+                if (temp_reg_val & cs40l25_irq2_mask_1_to_event_flag_map[i])
+                {
+                    driver->event_flags |= cs40l25_irq2_mask_1_to_event_flag_map[i + 1];
+                }
+            }
+
+            // Clear any IRQ2 flags from first register
+            temp_reg_val &= ~CS40L25_INT2_MASK_DEFAULT;
+            regmap_write(cp, IRQ2_IRQ2_EINT_1_REG, temp_reg_val);
+
+            // If there are Boost-related Errors, proceed to DISABLE_BOOST
+            if (driver->event_flags & CS40L25_EVENT_FLAGS_BOOST_CYCLE)
+            {
+                // Read which MSM Blocks are enabled
+                regmap_read(cp, MSM_BLOCK_ENABLES_REG, &msm_block_enables_val);
+                // Disable Boost converter
+                temp_reg_val = msm_block_enables_val & ~(MSM_BLOCK_ENABLES_BST_EN_BITMASK);
+                cs40l25_write_wseq_reg(driver, MSM_BLOCK_ENABLES_REG, temp_reg_val);
+            }
+            // IF there are no Boost-related Errors, proceed to TOGGLE_ERR_RLS
+            // Clear the Error Release register
+            cs40l25_write_wseq_reg(driver, MSM_ERROR_RELEASE_REG, 0);
+            // Set the Error Release register
+            cs40l25_write_wseq_reg(driver, MSM_ERROR_RELEASE_REG, CS40L25_ERR_RLS_ACTUATOR_SAFE_MODE_MASK);
+            // Clear the Error Release register
+            cs40l25_write_wseq_reg(driver, MSM_ERROR_RELEASE_REG, 0);
+
+            // If there are Boost-related Errors, re-enable Boost
+            if (driver->event_flags & CS40L25_EVENT_FLAGS_BOOST_CYCLE)
+            {
+                cs40l25_write_wseq_reg(driver, MSM_BLOCK_ENABLES_REG, msm_block_enables_val);
+            }
+
+        }
+        // Else set event flag and clear event source
+        else if (temp_reg_val <= CS40L2X_EVENT_CTRL_MAX)
+        {
+            // Set correct bit in flags to send to the BSP Notification Callback
+            driver->event_flags |= cs40l25_event_value_to_flag_map[temp_reg_val];
+        }
+        else
+        {
+            return CS40L25_STATUS_FAIL;
+        }
+
+        // Mark the triggered event register to be cleared
+        triggered |= (1 << count);
+    }
+
+    // Write EVENT_CTRL_NONE to the triggered event registers.  Only triggered registers are written, so that events
+    // raised since the snapshot are not lost.
+    if (event_words <= REGMAP_WORDS_MAX)
+    {
+        uint32_t clear_mask = 0;
+
+        for (count = 0; count < CS40L25_EVENT_SOURCES; count++)
+        {
+            if (triggered & (1 << count))
+            {
+                uint32_t index = (event_addr[count] - event_base) >> 2;
+
+                event_snapshot[index] = CS40L2X_EVENT_CTRL_NONE;
+                clear_mask |= (1 << index);
+            }
+        }
+
+        regmap_write_words_masked(cp, event_base, event_snapshot, event_words, clear_mask);
+    }
+    else
+    {
+        for (count = 0; count < CS40L25_EVENT_SOURCES; count++)
+        {
+            if (triggered & (1 << count))
+            {
+                regmap_write(cp, event_addr[count], CS40L2X_EVENT_CTRL_NONE);
+            }
+        }
+    }
+
+    // Write WAKE to POWERCONTROL register
+    /*
+     * polling for acknowledgment as with other mailbox registers
+     * is unnecessary in this case and adds latency, so only send
+     * the wake-up command to complete the notification sequence
+     */
+    regmap_write(cp, DSP_VIRTUAL1_MBOX_DSP_VIRTUAL1_MBOX_4_REG, CS40L25_POWERCONTROL_WAKEUP);
+
+    return CS40L25_STATUS_OK;
+}
+
+/**
+ * Schedule the next step of a non-blocking Calibration
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] wait_ms          Minimum delay in ms before the next step
+ *
+ * @return none
+ *
+ */
+static void cs40l25_cal_schedule(cs40l25_t *driver, uint32_t wait_ms)
+{
+    driver->cal_deadline = bsp_driver_if_g->get_time_ms() + wait_ms;
+
+    return;
+}
+
+/**
+ * Check and prepare driver state for a Calibration sequence
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] calib_type       The calibration type to be performed
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL        if calib_type is invalid, if driver is in invalid state for calibration, or if
+ *                              any calibration firmware control cannot be found
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l25_cal_begin(cs40l25_t *driver, uint32_t calib_type)
+{
+    // Get all control addresses needed
+    const uint32_t ctrl_ids[] =
+    {
+        CS40L25_CAL_SYM_F0_TRACKING_MAXBACKEMF,
+        CS40L25_CAL_SYM_F0_TRACKING_CLOSED_LOOP,
+        CS40L25_CAL_SYM_F0_TRACKING_F0_TRACKING_ENABLE,
+        CS40L25_CAL_SYM_F0_TRACKING_F0,
+        CS40L25_CAL_SYM_F0_TRACKING_REDC,
+        CS40L25_CAL_SYM_Q_ESTIMATION_Q_EST
+    };
+
+    if (!(calib_type & CS40L25_CALIB_ALL) ||
+        (driver->state != CS40L25_STATE_CAL_POWER_UP) ||
+        (driver->cal_state != CS40L25_CAL_STATE_IDLE))
+    {
+        return CS40L25_STATUS_FAIL;
+    }
+
+    for (uint8_t i = 0; i < (sizeof(ctrl_ids) / sizeof(uint32_t)); i++)
+    {
+        driver->cal_ctrl_addresses[i] = fw_img_find_symbol(driver->fw_info, ctrl_ids[i]);
+        if (!driver->cal_ctrl_addresses[i])
+        {
+            return CS40L25_STATUS_FAIL;
+        }
+    }
+
+    driver->cal_type = calib_type;
+    driver->cal_state = CS40L25_CAL_STATE_START;
+
+    return CS40L25_STATUS_OK;
+}
+
+/**
+ * Start Q Estimation, or finish Calibration if Q Estimation was not requested
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [out] wait_ms         Delay in ms required before the next step
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL        if any control port activity fails
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l25_cal_next(cs40l25_t *driver, uint32_t *wait_ms)
+{
+    uint32_t ret;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    if (driver->cal_type & CS40L25_CALIB_QEST)
+    {
+        ret = regmap_write(cp, driver->cal_ctrl_addresses[2], 2); // F0_TRACKING_ENABLE
+        if (ret)
+        {
+            return ret;
+        }
+
+        driver->cal_poll_count = 0;
+        driver->cal_state = CS40L25_CAL_STATE_QEST_POLL;
+        *wait_ms = CS40L25_POLL_CAL_Q_MS;
+
+        return CS40L25_STATUS_OK;
+    }
+
+    // Restore volume level
+    ret = cs40l25_write_wseq_reg(driver, CS40L25_INTP_AMP_CTRL_REG, driver->cal_pcm_vol);
+    driver->cal_state = CS40L25_CAL_STATE_IDLE;
+
+    return ret;
+}
+
+/**
+ * Run the current step of the Calibration sequence
+ *
+ * Each step performs its control port activity, then advances cal_state and reports how long to wait before the next
+ * step.  The sequence is complete when cal_state returns to CS40L25_CAL_STATE_IDLE.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [out] wait_ms         Delay in ms required before the next step
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL        if any control port activity fails, or if polling CAL_Q times out
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l25_cal_step(cs40l25_t *driver, uint32_t *wait_ms)
+{
+    uint32_t ret = CS40L25_STATUS_OK;
+    uint32_t temp_reg_val;
+    uint32_t *ctrl = driver->cal_ctrl_addresses;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    *wait_ms = 0;
+
+    switch (driver->cal_state)
+    {
+        case CS40L25_CAL_STATE_START:
+        {
+            uint32_t temp_mask = (~(0xFFFFFFFF << CS40L25_INTP_AMP_CTRL_AMP_VOL_PCM_BITWIDTH) << CS40L25_INTP_AMP_CTRL_AMP_VOL_PCM_BITOFFSET);
+
+            driver->config.cal_data.is_valid_f0 = false;
+            driver->config.cal_data.is_valid_qest = false;
+
+            // Save volume level, then mute
+            ret = regmap_read(cp, CS40L25_INTP_AMP_CTRL_REG, &(driver->cal_pcm_vol));
+            if (ret)
+            {
+                driver->cal_state = CS40L25_CAL_STATE_IDLE;
+                return CS40L25_STATUS_FAIL;
+            }
+            ret = cs40l25_write_wseq_reg(driver, CS40L25_INTP_AMP_CTRL_REG, driver->cal_pcm_vol & ~temp_mask);
+            if (ret)
+            {
+                break;
+            }
+
+            if (!(driver->cal_type & CS40L25_CALIB_F0))
+            {
+                ret = cs40l25_cal_next(driver, wait_ms);
+                break;
+            }
+
+            ret = regmap_write(cp, ctrl[0], 0); // MAXBACKEMF
+            ret |= regmap_write(cp, ctrl[1], 0); // CLOSED_LOOP
+            ret |= regmap_write(cp, ctrl[2], 1); // F0_TRACKING_ENABLE
 
-    // Read the first IRQ1 flag register
-    ret = regmap_read(cp, XM_UNPACKED24_DSP1_SCRATCH_REG, &temp_reg_val);
+            driver->cal_state = CS40L25_CAL_STATE_F0_CLOSED_LOOP;
+            *wait_ms = 500;
+            break;
+        }
 
-    // If SCRATCH is nonzero OR CP transaction error
-    if (temp_reg_val || (ret != CS40L25_STATUS_OK))
-    {
-        driver->event_flags = CS40L25_EVENT_FLAG_DSP_ERROR;
+        case CS40L25_CAL_STATE_F0_CLOSED_LOOP:
+            ret = regmap_write(cp, ctrl[1], 1); // CLOSED_LOOP
 
-        return CS40L25_STATUS_OK;
-    }
+            driver->cal_state = CS40L25_CAL_STATE_F0_READ;
+            *wait_ms = BSP_TIMER_DURATION_2S;
+            break;
 
-    // Read unmasked event registers
-    for (count = 0; count < (sizeof(cs40l2x_event_controls)/sizeof(uint32_t)); count++)
-    {
-        regmap_read_fw_control(cp, driver->fw_info, cs40l2x_event_controls[count], &temp_reg_val);
+        case CS40L25_CAL_STATE_F0_READ:
+            ret = regmap_write(cp, ctrl[2], 0); // F0_TRACKING_ENABLE
+            ret |= regmap_read(cp, ctrl[3], &(driver->config.cal_data.f0)); // F0
+            ret |= regmap_read(cp, ctrl[4], &(driver->config.cal_data.redc)); // REDC
+            ret |= regmap_read(cp, ctrl[0], &(driver->config.cal_data.backemf)); // MAXBACKEMF
+            if (ret)
+            {
+                break;
+            }
+            driver->config.cal_data.is_valid_f0 = true;
 
-        if ((temp_reg_val == CS40L2X_EVENT_CTRL_NONE) || ((temp_event_control & cs40l2x_event_masks[count]) == 0))
-        {
-            continue;
-        }
+            ret = cs40l25_cal_next(driver, wait_ms);
+            break;
 
-        // If event is HW Event, then process separately
-        if (temp_reg_val == CS40L2X_EVENT_CTRL_HARDWARE)
-        {
-            // Read the first IRQ2 flag register
-            regmap_read(cp, IRQ2_IRQ2_EINT_1_REG, &temp_reg_val);
+        case CS40L25_CAL_STATE_QEST_POLL:
+            ret = regmap_read(cp, ctrl[2], &temp_reg_val); // F0_TRACKING_ENABLE
+            if (ret)
+            {
+                break;
+            }
 
-            // Set flags in event_flags
-            for (uint8_t i = 0; i < (CS40L25_EVENT_HW_SOURCES * 2); i += 2)
+            if (temp_reg_val != 0)
             {
-                if (temp_reg_val & cs40l25_irq2_mask_1_to_event_flag_map[i])
+                if (++(driver->cal_poll_count) >= CS40L25_POLL_CAL_Q_MAX)
                 {
-                    driver->event_flags |= cs40l25_irq2_mask_1_to_event_flag_map[i + 1];
+                    ret = CS40L25_STATUS_FAIL;
                 }
-            }
-
-            // Clear any IRQ2 flags from first register
-            temp_reg_val &= ~CS40L25_INT2_MASK_DEFAULT;
-            regmap_write(cp, IRQ2_IRQ2_EINT_1_REG, temp_reg_val);
 
-            // If there are Boost-related Errors, proceed to DISABLE_BOOST
-            if (driver->event_flags & CS40L25_EVENT_FLAGS_BOOST_CYCLE)
-            {
-                // Read which MSM Blocks are enabled
-                regmap_read(cp, MSM_BLOCK_ENABLES_REG, &msm_block_enables_val);
-                // Disable Boost converter
-                temp_reg_val = msm_block_enables_val & ~(MSM_BLOCK_ENABLES_BST_EN_BITMASK);
-                cs40l25_write_wseq_reg(driver, MSM_BLOCK_ENABLES_REG, temp_reg_val);
+                *wait_ms = CS40L25_POLL_CAL_Q_MS;
+                break;
             }
-            // IF there are no Boost-related Errors, proceed to TOGGLE_ERR_RLS
-            // Clear the Error Release register
-            cs40l25_write_wseq_reg(driver, MSM_ERROR_RELEASE_REG, 0);
-            // Set the Error Release register
-            cs40l25_write_wseq_reg(driver, MSM_ERROR_RELEASE_REG, CS40L25_ERR_RLS_ACTUATOR_SAFE_MODE_MASK);
-            // Clear the Error Release register
-            cs40l25_write_wseq_reg(driver, MSM_ERROR_RELEASE_REG, 0);
 
-            // If there are Boost-related Errors, re-enable Boost
-            if (driver->event_flags & CS40L25_EVENT_FLAGS_BOOST_CYCLE)
+            ret = regmap_read(cp, ctrl[5], &(driver->config.cal_data.qest)); // Q_EST
+            if (ret)
             {
-                cs40l25_write_wseq_reg(driver, MSM_BLOCK_ENABLES_REG, msm_block_enables_val);
+                break;
             }
+            driver->config.cal_data.is_valid_qest = true;
 
-        }
-        // Else set event flag and clear event source
-        else if (temp_reg_val <= CS40L2X_EVENT_CTRL_MAX)
-        {
-            // Set correct bit in flags to send to the BSP Notification Callback
-            driver->event_flags |= cs40l25_event_value_to_flag_map[temp_reg_val];
-        }
-        else
-        {
-            return CS40L25_STATUS_FAIL;
-        }
+            // Restore volume level
+            ret = cs40l25_write_wseq_reg(driver, CS40L25_INTP_AMP_CTRL_REG, driver->cal_pcm_vol);
+            driver->cal_state = CS40L25_CAL_STATE_IDLE;
+            break;
 
-        // Write EVENT_CTRL_NONE to the triggered event register
-        regmap_write_fw_control(cp, driver->fw_info, cs40l2x_event_controls[count], CS40L2X_EVENT_CTRL_NONE);
+        default:
+            ret = CS40L25_STATUS_FAIL;
+            break;
     }
 
-    // Write WAKE to POWERCONTROL register
-    /*
-     * polling for acknowledgment as with other mailbox registers
-     * is unnecessary in this case and adds latency, so only send
-     * the wake-up command to complete the notification sequence
-     */
-    regmap_write(cp, DSP_VIRTUAL1_MBOX_DSP_VIRTUAL1_MBOX_4_REG, CS40L25_POWERCONTROL_WAKEUP);
+    if (ret)
+    {
+        // Abandon the sequence and restore volume level
+        cs40l25_write_wseq_reg(driver, CS40L25_INTP_AMP_CTRL_REG, driver->cal_pcm_vol);
+        driver->cal_state = CS40L25_CAL_STATE_IDLE;
+
+        return CS40L25_STATUS_FAIL;
+    }
 
     return CS40L25_STATUS_OK;
 }
 
+/**
+ * Advance a non-blocking Calibration sequence
+ *
+ * Runs the next step once its delay has elapsed and reports completion via the driver event flags.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return none
+ *
+ */
+static void cs40l25_cal_process(cs40l25_t *driver)
+{
+    uint32_t wait_ms;
+
+    if ((int32_t) (bsp_driver_if_g->get_time_ms() - driver->cal_deadline) < 0)
+    {
+        return;
+    }
+
+    if (cs40l25_cal_step(driver, &wait_ms))
+    {
+        driver->event_flags |= CS40L25_EVENT_FLAG_CAL_ERROR;
+    }
+    else if (driver->cal_state == CS40L25_CAL_STATE_IDLE)
+    {
+        driver->event_flags |= CS40L25_EVENT_FLAG_CAL_DONE;
+    }
+    else
+    {
+        cs40l25_cal_schedule(driver, wait_ms);
+    }
+
+    return;
+}
+
 /***********************************************************************************************************************
  * API FUNCTIONS
  **********************************************************************************************************************/
@@ -1276,6 +2046,12 @@ uint32_t cs40l25_process(cs40l25_t *driver)
             }
         }
 
+        // Advance any non-blocking Calibration in progress
+        if (driver->cal_state != CS40L25_CAL_STATE_IDLE)
+        {
+            cs40l25_cal_process(driver);
+        }
+
         if (driver->state == CS40L25_STATE_ERROR)
         {
             driver->event_flags |= CS40L25_EVENT_FLAG_STATE_ERROR;
@@ -1403,6 +2179,8 @@ uint32_t cs40l25_boot(cs40l25_t *driver, fw_img_info_t *fw_info)
         int wseq_entries = sizeof(cs40l25_wseq_regs) / (2 * sizeof(uint32_t));
 
         driver->wseq_num_entries = 0;
+        driver->wseq_changed = 0;
+        memset(driver->wseq_index, 0, sizeof(driver->wseq_index));
         cs40l25_wseq_table_add(driver, CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG, CS40L25_TEST_KEY_CTRL_UNLOCK_1);
         cs40l25_wseq_table_add(driver, CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG, CS40L25_TEST_KEY_CTRL_UNLOCK_2);
         cs40l25_wseq_add_block(driver, (uint32_t *) cs40l25_revb0_errata_patch, errata_entries);
@@ -1423,19 +2201,35 @@ uint32_t cs40l25_boot(cs40l25_t *driver, fw_img_info_t *fw_info)
     // Apply Calibration data
     if (!is_cal_boot)
     {
+        uint32_t cal_controls[6];
+        uint32_t cal_controls_total = 0;
+
         if (driver->config.cal_data.is_valid_f0)
         {
-            regmap_write_fw_control(cp, driver->fw_info, CS40L25_SYM_FIRMWARE_F0_STORED, driver->config.cal_data.f0);
-            regmap_write_fw_control(cp,
-                                    driver->fw_info,
-                                    CS40L25_SYM_FIRMWARE_REDC_STORED,
-                                    driver->config.cal_data.redc);
-
+            cal_controls_total = cs40l25_add_fw_control(driver,
+                                                        cal_controls,
+                                                        cal_controls_total,
+                                                        CS40L25_SYM_FIRMWARE_F0_STORED,
+                                                        driver->config.cal_data.f0);
+            cal_controls_total = cs40l25_add_fw_control(driver,
+                                                        cal_controls,
+                                                        cal_controls_total,
+                                                        CS40L25_SYM_FIRMWARE_REDC_STORED,
+                                                        driver->config.cal_data.redc);
         }
 
         if (driver->config.cal_data.is_valid_qest)
         {
-            regmap_write_fw_control(cp, driver->fw_info, CS40L25_SYM_FIRMWARE_Q_STORED, driver->config.cal_data.qest);
+            cal_controls_total = cs40l25_add_fw_control(driver,
+                                                        cal_controls,
+                                                        cal_controls_total,
+                                                        CS40L25_SYM_FIRMWARE_Q_STORED,
+                                                        driver->config.cal_data.qest);
+        }
+
+        if (cal_controls_total > 0)
+        {
+            regmap_write_fw_controls(cp, driver->fw_info, cal_controls, cal_controls_total, NULL);
         }
 
         driver->state = CS40L25_STATE_DSP_STANDBY;
@@ -1472,11 +2266,24 @@ uint32_t cs40l25_boot(cs40l25_t *driver, fw_img_info_t *fw_info)
         // Apply External Boost configuration
         if (driver->config.ext_boost.use_ext_boost)
         {
-            regmap_write_fw_control(cp, driver->fw_info, CS40L25_SYM_FIRMWARE_USE_EXT_BOOST, 0x1);
-            regmap_write_fw_control(cp,
-                                    driver->fw_info,
-                                    CS40L25_SYM_FIRMWARE_GPI_PLAYBACK_DELAY,
-                                    driver->config.ext_boost.gpi_playback_delay);
+            uint32_t ext_boost_controls[4];
+            uint32_t ext_boost_controls_total = 0;
+
+            ext_boost_controls_total = cs40l25_add_fw_control(driver,
+                                                              ext_boost_controls,
+                                                              ext_boost_controls_total,
+                                                              CS40L25_SYM_FIRMWARE_USE_EXT_BOOST,
+                                                              0x1);
+            ext_boost_controls_total = cs40l25_add_fw_control(driver,
+                                                              ext_boost_controls,
+                                                              ext_boost_controls_total,
+                                                              CS40L25_SYM_FIRMWARE_GPI_PLAYBACK_DELAY,
+                                                              driver->config.ext_boost.gpi_playback_delay);
+
+            if (ext_boost_controls_total > 0)
+            {
+                regmap_write_fw_controls(cp, driver->fw_info, ext_boost_controls, ext_boost_controls_total, NULL);
+            }
         }
     }
 
@@ -1581,94 +2388,134 @@ uint32_t cs40l25_power(cs40l25_t *driver, uint32_t power_state)
  */
 uint32_t cs40l25_calibrate(cs40l25_t *driver, uint32_t calib_type)
 {
-    uint32_t temp_reg_val = 0;
-    uint32_t calib_pcm_vol = 0;
-    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+    uint32_t ret, wait_ms;
 
-    if (!(calib_type & CS40L25_CALIB_ALL) || (driver->state != CS40L25_STATE_CAL_POWER_UP))
+    ret = cs40l25_cal_begin(driver, calib_type);
+    if (ret)
     {
-        return CS40L25_STATUS_FAIL;
+        return ret;
     }
 
-    // Get all control addresses needed - just re-use the array for the addresses
-    uint32_t ctrl_addresses[] =
+    while (driver->cal_state != CS40L25_CAL_STATE_IDLE)
     {
-        CS40L25_CAL_SYM_F0_TRACKING_MAXBACKEMF,
-        CS40L25_CAL_SYM_F0_TRACKING_CLOSED_LOOP,
-        CS40L25_CAL_SYM_F0_TRACKING_F0_TRACKING_ENABLE,
-        CS40L25_CAL_SYM_F0_TRACKING_F0,
-        CS40L25_CAL_SYM_F0_TRACKING_REDC,
-        CS40L25_CAL_SYM_Q_ESTIMATION_Q_EST
-    };
+        ret = cs40l25_cal_step(driver, &wait_ms);
+        if (ret)
+        {
+            return ret;
+        }
 
-    for (uint8_t i = 0; i < (sizeof(ctrl_addresses) / sizeof(uint32_t)); i++)
-    {
-        ctrl_addresses[i] = fw_img_find_symbol(driver->fw_info, ctrl_addresses[i]);
-        if (!ctrl_addresses[i])
+        if (wait_ms)
         {
-            return CS40L25_STATUS_FAIL;
+            bsp_driver_if_g->set_timer(wait_ms, NULL, NULL);
         }
     }
 
-    driver->config.cal_data.is_valid_f0 = false;
-    driver->config.cal_data.is_valid_qest = false;
+    return CS40L25_STATUS_OK;
+}
+
+/**
+ * Start Calibration without blocking
+ *
+ */
+uint32_t cs40l25_calibrate_start(cs40l25_t *driver, uint32_t calib_type)
+{
+    uint32_t ret, wait_ms;
+
+    if (bsp_driver_if_g->get_time_ms == NULL)
+    {
+        return CS40L25_STATUS_FAIL;
+    }
 
-    // Read current volume
-    regmap_read(cp, CS40L25_INTP_AMP_CTRL_REG, &temp_reg_val);
-    uint32_t temp_mask = (~(0xFFFFFFFF << CS40L25_INTP_AMP_CTRL_AMP_VOL_PCM_BITWIDTH) << CS40L25_INTP_AMP_CTRL_AMP_VOL_PCM_BITOFFSET);
+    ret = cs40l25_cal_begin(driver, calib_type);
+    if (ret)
+    {
+        return ret;
+    }
 
-    // Save volume level
-    calib_pcm_vol = temp_reg_val;
-    cs40l25_write_wseq_reg(driver, CS40L25_INTP_AMP_CTRL_REG, temp_reg_val & ~temp_mask);
+    ret = cs40l25_cal_step(driver, &wait_ms);
+    if (ret)
+    {
+        return ret;
+    }
 
-    if (calib_type & CS40L25_CALIB_F0)
+    if (driver->cal_state == CS40L25_CAL_STATE_IDLE)
     {
-        regmap_write(cp, ctrl_addresses[0], 0); // MAXBACKEMF
-        regmap_write(cp, ctrl_addresses[1], 0); // CLOSED_LOOP
-        regmap_write(cp, ctrl_addresses[2], 1); // F0_TRACKING_ENABLE
+        driver->event_flags |= CS40L25_EVENT_FLAG_CAL_DONE;
+    }
+    else
+    {
+        cs40l25_cal_schedule(driver, wait_ms);
+    }
 
-        // Wait 500ms
-        bsp_driver_if_g->set_timer(500, NULL, NULL);
+    return CS40L25_STATUS_OK;
+}
 
-        regmap_write(cp, ctrl_addresses[1], 1); // CLOSED_LOOP
+/**
+ * Get record of current calibration data
+ *
+ */
+uint32_t cs40l25_get_cal_record(cs40l25_t *driver, cs40l25_cal_record_t *record)
+{
+    cs40l25_calibration_t *cal;
 
-        // Wait 2s
-        bsp_driver_if_g->set_timer(BSP_TIMER_DURATION_2S, NULL, NULL);
+    if ((driver == NULL) || (record == NULL))
+    {
+        return CS40L25_STATUS_FAIL;
+    }
 
-        regmap_write(cp, ctrl_addresses[2], 0); // F0_TRACKING_ENABLE
-        regmap_read(cp, ctrl_addresses[3], &(driver->config.cal_data.f0)); // F0
-        regmap_read(cp, ctrl_addresses[4], &(driver->config.cal_data.redc)); // REDC
-        regmap_read(cp, ctrl_addresses[0], &(driver->config.cal_data.backemf)); // MAXBACKEMF
-        driver->config.cal_data.is_valid_f0 = true;
+    cal = &(driver->config.cal_data);
+    if (!cal->is_valid_f0 && !cal->is_valid_qest)
+    {
+        return CS40L25_STATUS_FAIL;
     }
 
-    if (calib_type & CS40L25_CALIB_QEST)
+    memset(record, 0, sizeof(cs40l25_cal_record_t));
+    record->magic = CS40L25_CAL_RECORD_MAGIC;
+
+    if (cal->is_valid_f0)
     {
-        regmap_write(cp, ctrl_addresses[2], 2); // F0_TRACKING_ENABLE
+        record->valid |= CS40L25_CAL_RECORD_VALID_F0;
+        record->f0 = cal->f0;
+        record->redc = cal->redc;
+        record->backemf = cal->backemf;
+    }
 
-        uint32_t count;
-        for (count = 0; count < CS40L25_POLL_CAL_Q_MAX; count++)
-        {
-            bsp_driver_if_g->set_timer(100, NULL, NULL);
+    if (cal->is_valid_qest)
+    {
+        record->valid |= CS40L25_CAL_RECORD_VALID_QEST;
+        record->qest = cal->qest;
+    }
 
-            regmap_read(cp, ctrl_addresses[2], &temp_reg_val); // F0_TRACKING_ENABLE
+    record->crc = crc32_calculate((uint8_t *) record, offsetof(cs40l25_cal_record_t, crc));
 
-            if (temp_reg_val == 0)
-            {
-                break;
-            }
-        }
+    return CS40L25_STATUS_OK;
+}
 
-        if (count >= CS40L25_POLL_CAL_Q_MAX)
-        {
-            return CS40L25_STATUS_FAIL;
-        }
+/**
+ * Apply a saved calibration record
+ *
+ */
+uint32_t cs40l25_set_cal_record(cs40l25_t *driver, cs40l25_cal_record_t *record)
+{
+    cs40l25_calibration_t *cal;
+
+    if ((driver == NULL) || (record == NULL) || (record->magic != CS40L25_CAL_RECORD_MAGIC))
+    {
+        return CS40L25_STATUS_FAIL;
+    }
 
-        regmap_read(cp, ctrl_addresses[5], &(driver->config.cal_data.qest)); // Q_EST
-        driver->config.cal_data.is_valid_qest = true;
+    if (record->crc != crc32_calculate((uint8_t *) record, offsetof(cs40l25_cal_record_t, crc)))
+    {
+        return CS40L25_STATUS_FAIL;
     }
 
-    cs40l25_write_wseq_reg(driver, CS40L25_INTP_AMP_CTRL_REG, calib_pcm_vol);
+    cal = &(driver->config.cal_data);
+    cal->is_valid_f0 = (record->valid & CS40L25_CAL_RECORD_VALID_F0) ? true : false;
+    cal->f0 = record->f0;
+    cal->redc = record->redc;
+    cal->backemf = record->backemf;
+    cal->is_valid_qest = (record->valid & CS40L25_CAL_RECORD_VALID_QEST) ? true : false;
+    cal->qest = record->qest;
 
     return CS40L25_STATUS_OK;
 }
@@ -1682,6 +2529,9 @@ uint32_t cs40l25_start_i2s(cs40l25_t *driver)
     uint32_t ret, val;
     bool i2s_passthrough = true;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+    cs40l25_dataif_asp_enables1_t asp_reg_val;
+    cs40l25_dataif_asp_control1_t asp_control1;
+    cs40l25_ccm_refclk_input_t clk_reg_val;
 
     /* If the firmware doesn't support i2s pass-through:
      * - bypass the DSP
@@ -1692,15 +2542,27 @@ uint32_t cs40l25_start_i2s(cs40l25_t *driver)
     if (!(val & CS40L25_FEATURE_BITMAP_I2s))
     {
         i2s_passthrough = false;
-        cs40l25_write_wseq_reg(driver, CS40L25_MIXER_DACPCM1_INPUT_REG, CS40L25_INPUT_SRC_ASPRX1);
     }
 
-    // Enable ASPs
-    cs40l25_dataif_asp_enables1_t asp_reg_val;
-    regmap_read(cp, DATAIF_ASP_ENABLES1_REG, &(asp_reg_val.word));
+    // Enable ASPs.  ASP_CONTROL1 is adjacent to ASP_ENABLES1, so is read in the same block for the BCLK rate.
+    cs40l25_txn_begin(driver);
+    if (!i2s_passthrough)
+    {
+        cs40l25_txn_update_reg(driver, CS40L25_MIXER_DACPCM1_INPUT_REG, 0xFFFFFFFF, CS40L25_INPUT_SRC_ASPRX1);
+    }
+    asp_reg_val.word = 0;
     asp_reg_val.asp_rx1_en = 1;
     asp_reg_val.asp_rx2_en = 1;
-    cs40l25_write_wseq_reg(driver, DATAIF_ASP_ENABLES1_REG, asp_reg_val.word);
+    cs40l25_txn_update_reg(driver, DATAIF_ASP_ENABLES1_REG, asp_reg_val.word, asp_reg_val.word);
+    cs40l25_txn_read_reg(driver, DATAIF_ASP_CONTROL1_REG);
+
+    ret = cs40l25_txn_commit(driver);
+    if (ret)
+    {
+        return CS40L25_STATUS_FAIL;
+    }
+
+    cs40l25_txn_get_reg(driver, DATAIF_ASP_CONTROL1_REG, &(asp_control1.word));
 
     // Force DSP into standby
     ret = regmap_write_acked_reg(cp,
@@ -1716,14 +2578,7 @@ uint32_t cs40l25_start_i2s(cs40l25_t *driver)
     }
 
     // Change clock to bclk - encoding of PLL REFCLK is same as ASP BCLK
-    cs40l25_dataif_asp_control1_t asp_control1;
-    cs40l25_ccm_refclk_input_t clk_reg_val;
-
-    regmap_read(cp, DATAIF_ASP_CONTROL1_REG, &(asp_control1.word));
-    regmap_read(cp, CCM_REFCLK_INPUT_REG, &(clk_reg_val.word));
-
-    clk_reg_val.pll_refclk_sel = CS40L25_PLL_REFLCLK_SEL_BCLK;
-    clk_reg_val.pll_refclk_freq = asp_control1.asp_bclk_freq;
+    cs40l25_txn_begin(driver);
 
 #ifdef CONFIG_OPEN_LOOP
     regmap_write(cp, CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG, CS40L25_TEST_KEY_CTRL_UNLOCK_1);
@@ -1731,10 +2586,27 @@ uint32_t cs40l25_start_i2s(cs40l25_t *driver)
     cs40l25_write_wseq_reg(driver, 0x2D20, 0x0);
     regmap_write(cp, CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG, CS40L25_TEST_KEY_CTRL_LOCK_1);
     regmap_write(cp, CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG, CS40L25_TEST_KEY_CTRL_LOCK_2);
-    cs40l25_write_wseq_reg(driver, 0x3018, 0x0);
+    cs40l25_txn_update_reg(driver, 0x3018, 0xFFFFFFFF, 0x0);
 #endif
 
-    cs40l25_write_wseq_reg(driver, CCM_REFCLK_INPUT_REG, clk_reg_val.word);
+    clk_reg_val.word = 0;
+    clk_reg_val.pll_refclk_sel = ~0;
+    clk_reg_val.pll_refclk_freq = ~0;
+    val = clk_reg_val.word;
+    clk_reg_val.pll_refclk_sel = CS40L25_PLL_REFLCLK_SEL_BCLK;
+    clk_reg_val.pll_refclk_freq = asp_control1.asp_bclk_freq;
+    cs40l25_txn_update_reg(driver, CCM_REFCLK_INPUT_REG, val, clk_reg_val.word);
+
+    if (!i2s_passthrough)
+    {
+        cs40l25_txn_update_reg(driver, MSM_GLOBAL_ENABLES_REG, 0xFFFFFFFF, MSM_GLOBAL_ENABLES_GLOBAL_EN_BITMASK);
+    }
+
+    ret = cs40l25_txn_commit(driver);
+    if (ret)
+    {
+        return CS40L25_STATUS_FAIL;
+    }
 
     if (i2s_passthrough)
     {
@@ -1758,15 +2630,10 @@ uint32_t cs40l25_start_i2s(cs40l25_t *driver)
                                      DSP_VIRTUAL1_MBOX_DSP_VIRTUAL1_MBOX_5_NONE,
                                      CS40L25_POLL_ACK_CTRL_MAX,
                                      CS40L25_POLL_ACK_CTRL_MS);
-    }
-    else
-    {
-        ret = cs40l25_write_wseq_reg(driver, MSM_GLOBAL_ENABLES_REG, MSM_GLOBAL_ENABLES_GLOBAL_EN_BITMASK);
-    }
-
-    if (ret)
-    {
-        return CS40L25_STATUS_FAIL;
+        if (ret)
+        {
+            return CS40L25_STATUS_FAIL;
+        }
     }
 
     return CS40L25_STATUS_OK;
@@ -1781,6 +2648,8 @@ uint32_t cs40l25_stop_i2s(cs40l25_t *driver)
     uint32_t ret, val;
     bool i2s_passthrough = true;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+    cs40l25_ccm_refclk_input_t clk_reg_val;
+    cs40l25_dataif_asp_enables1_t asp_reg_val;
 
     /* If the firmware doesn't support i2s pass-through:
      * - disable global_enable
@@ -1791,10 +2660,15 @@ uint32_t cs40l25_stop_i2s(cs40l25_t *driver)
     if (!(val & CS40L25_FEATURE_BITMAP_I2s))
     {
         i2s_passthrough = false;
-        cs40l25_write_wseq_reg(driver, MSM_GLOBAL_ENABLES_REG, 0);
     }
 
-    if (i2s_passthrough)
+    // Changes are only recorded until committed, so global_enable is cleared just before the clock is changed
+    cs40l25_txn_begin(driver);
+    if (!i2s_passthrough)
+    {
+        cs40l25_txn_update_reg(driver, MSM_GLOBAL_ENABLES_REG, 0xFFFFFFFF, 0);
+    }
+    else
     {
         ret = regmap_write_acked_reg(cp,
                                      DSP_VIRTUAL1_MBOX_DSP_VIRTUAL1_MBOX_4_REG,
@@ -1810,7 +2684,6 @@ uint32_t cs40l25_stop_i2s(cs40l25_t *driver)
     }
 
     // Change clock back to MCLK
-    cs40l25_ccm_refclk_input_t clk_reg_val;
     clk_reg_val.word = CCM_REFCLK_INPUT_REG_DEFAULT;
 
     for (uint32_t i = 0; i < driver->config.syscfg_regs_total; i++)
@@ -1821,14 +2694,19 @@ uint32_t cs40l25_stop_i2s(cs40l25_t *driver)
         }
     }
 
-    ret = cs40l25_write_wseq_reg(driver, CCM_REFCLK_INPUT_REG, clk_reg_val.word);
+    cs40l25_txn_update_reg(driver, CCM_REFCLK_INPUT_REG, 0xFFFFFFFF, clk_reg_val.word);
+
+#ifdef CONFIG_OPEN_LOOP
+    cs40l25_txn_update_reg(driver, 0x3018, 0xFFFFFFFF, 0x02000000);
+#endif
+
+    ret = cs40l25_txn_commit(driver);
     if (ret != CS40L25_STATUS_OK)
     {
         return CS40L25_STATUS_FAIL;
     }
 
 #ifdef CONFIG_OPEN_LOOP
-    cs40l25_write_wseq_reg(driver, 0x3018, 0x02000000);
     regmap_write(cp, CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG, CS40L25_TEST_KEY_CTRL_UNLOCK_1);
     regmap_write(cp, CS40L25_CTRL_KEYS_TEST_KEY_CTRL_REG, CS40L25_TEST_KEY_CTRL_UNLOCK_2);
     cs40l25_write_wseq_reg(driver, 0x2D20, 0x00000030);
@@ -1865,15 +2743,21 @@ uint32_t cs40l25_stop_i2s(cs40l25_t *driver)
     }
 
     //Disable ASP
-    cs40l25_dataif_asp_enables1_t asp_reg_val;
-    regmap_read(cp, DATAIF_ASP_ENABLES1_REG, &(asp_reg_val.word));
-    asp_reg_val.asp_rx1_en = 0;
-    asp_reg_val.asp_rx2_en = 0;
-    cs40l25_write_wseq_reg(driver, DATAIF_ASP_ENABLES1_REG, asp_reg_val.word);
+    cs40l25_txn_begin(driver);
+    asp_reg_val.word = 0;
+    asp_reg_val.asp_rx1_en = 1;
+    asp_reg_val.asp_rx2_en = 1;
+    cs40l25_txn_update_reg(driver, DATAIF_ASP_ENABLES1_REG, asp_reg_val.word, 0);
 
     if (!i2s_passthrough)
     {
-        cs40l25_write_wseq_reg(driver, CS40L25_MIXER_DACPCM1_INPUT_REG, CS40L25_INPUT_SRC_DSP1TX1);
+        cs40l25_txn_update_reg(driver, CS40L25_MIXER_DACPCM1_INPUT_REG, 0xFFFFFFFF, CS40L25_INPUT_SRC_DSP1TX1);
+    }
+
+    ret = cs40l25_txn_commit(driver);
+    if (ret != CS40L25_STATUS_OK)
+    {
+        return CS40L25_STATUS_FAIL;
     }
 
     return CS40L25_STATUS_OK;
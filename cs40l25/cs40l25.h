@@ -114,6 +114,22 @@ extern "C" {
 #define CS40L25_CALIB_ALL                               (CS40L25_CALIB_F0|CS40L25_CALIB_QEST)
 /** @} */
 
+/**
+ * @defgroup CS40L25_CAL_STATE_
+ * @brief Steps of the Calibration sequence
+ *
+ * @see cs40l25_t member cal_state
+ * @see cs40l25_calibrate_start
+ *
+ * @{
+ */
+#define CS40L25_CAL_STATE_IDLE                          (0)
+#define CS40L25_CAL_STATE_START                         (1)
+#define CS40L25_CAL_STATE_F0_CLOSED_LOOP                (2)
+#define CS40L25_CAL_STATE_F0_READ                       (3)
+#define CS40L25_CAL_STATE_QEST_POLL                     (4)
+/** @} */
+
 /**
  * @defgroup CS40L25_EVENT_FLAG_
  * @brief Flags passed to Notification Callback to notify BSP of specific driver events
@@ -129,6 +145,8 @@ extern "C" {
 #define CS40L25_EVENT_FLAG_BOOST_INDUCTOR_SHORT         (1 << 27)
 #define CS40L25_EVENT_FLAG_BOOST_UNDERVOLTAGE           (1 << 26)
 #define CS40L25_EVENT_FLAG_BOOST_OVERVOLTAGE            (1 << 25)
+#define CS40L25_EVENT_FLAG_CAL_ERROR                    (1 << 15)
+#define CS40L25_EVENT_FLAG_CAL_DONE                     (1 << 14)
 #define CS40L25_EVENT_FLAG_STATE_ERROR                  (1 << 13)
 #define CS40L25_EVENT_FLAG_ACTIVE_TO_STANDBY            (1 << 12)
 #define CS40L25_EVENT_FLAG_READY_FOR_DATA               (1 << 11)
@@ -169,9 +187,17 @@ extern "C" {
 #define CS40L25_POLL_OTP_BOOT_DONE_MS           (10)    ///< Delay in ms between polling OTP_BOOT_DONE
 #define CS40L25_POLL_OTP_BOOT_DONE_MAX          (10)    ///< Maximum number of times to poll OTP_BOOT_DONE
 #define CS40L25_POLL_CAL_Q_MAX                  (30)    ///< Maximum number of times to poll CAL_Q
+#define CS40L25_POLL_CAL_Q_MS                   (100)   ///< Delay in ms between polling CAL_Q
 /** @} */
 
+#define CS40L25_CAL_RECORD_MAGIC                        (0x4C32354B)    ///< Marks a cs40l25_cal_record_t ("L25K")
+#define CS40L25_CAL_RECORD_VALID_F0                     (1 << 0)        ///< cs40l25_cal_record_t f0/redc/backemf valid
+#define CS40L25_CAL_RECORD_VALID_QEST                   (1 << 1)        ///< cs40l25_cal_record_t qest valid
+
 #define CS40L25_WSEQ_MAX_ENTRIES                        (48)    ///< Maximum registers written on wakeup from hibernate
+#define CS40L25_WSEQ_INDEX_BITS                         (7)     ///< Number of bits used to hash WSEQ register address
+#define CS40L25_WSEQ_INDEX_SIZE                         (1 << CS40L25_WSEQ_INDEX_BITS)  ///< Total WSEQ address slots
+#define CS40L25_TXN_MAX_ENTRIES                         (8)     ///< Maximum registers recorded in one config txn
 
 /***********************************************************************************************************************
  * MACROS
@@ -238,9 +264,10 @@ typedef struct
  * Each entry corresponds to 16-bits of address and 32-bits of data.  Only 16-bits of address is needed due to the Wake
  * handling in HALO Core DSP firmware only needing to restore hardware addresses up to 0xFFFF.
  *
- * The shuffling of members is to facilitate when writing values to HALO Core packed 24-bit memory.
+ * The shuffling of members is to facilitate when writing values to HALO Core packed 24-bit memory.  Entries are kept
+ * packed so that consecutive entries can be written to POWERONSEQUENCE with a single block write.
  *
- * @see cs40l25_wseq_table_update
+ * @see cs40l25_write_wseq_reg
  */
 typedef struct
 {
@@ -260,9 +287,20 @@ typedef struct
 
         };
     };
-    uint8_t changed : 1;
 } cs40l25_wseq_entry_t;
 
+/**
+ * Register change recorded in a configuration transaction
+ *
+ * @see cs40l25_txn_update_reg
+ */
+typedef struct
+{
+    uint32_t address;                           ///< HW register address
+    uint32_t mask;                              ///< Bits of value to write, 0 if the register is only read
+    uint32_t value;                             ///< Requested value, then value written (or read) after commit
+} cs40l25_txn_entry_t;
+
 /**
  * State of HALO FW Calibration
  *
@@ -277,6 +315,26 @@ typedef struct
     uint32_t qest;      ///< Encoded estimated Q value (Q Est) determined by Calibration procedure.
 } cs40l25_calibration_t;
 
+/**
+ * Calibration record to save to non-volatile storage
+ *
+ * All members are 32-bit words so that the record has no padding and the CRC covers every byte before member crc.
+ *
+ * @see cs40l25_get_cal_record
+ * @see cs40l25_set_cal_record
+ *
+ */
+typedef struct
+{
+    uint32_t magic;     ///< Always CS40L25_CAL_RECORD_MAGIC
+    uint32_t valid;     ///< Bitwise OR of CS40L25_CAL_RECORD_VALID_ flags
+    uint32_t f0;        ///< Encoded resonant frequency (f0)
+    uint32_t redc;      ///< Encoded DC resistance (ReDC)
+    uint32_t backemf;   ///< Encoded Back EMF
+    uint32_t qest;      ///< Encoded estimated Q value (Q Est)
+    uint32_t crc;       ///< CRC-32 of all preceding members
+} cs40l25_cal_record_t;
+
 /**
  * Data structure for HALO Core DSP Firmware Revision
  *
@@ -360,11 +418,28 @@ typedef struct
      * List of register address/value pairs to write on wake up from hibernate
      */
     cs40l25_wseq_entry_t wseq_table[CS40L25_WSEQ_MAX_ENTRIES];
+    uint64_t wseq_changed;                      ///< Bitmask of wseq_table entries not yet written to POWERONSEQUENCE
+    /*
+     * Open-addressed hash of HW register address to (wseq_table index + 1), 0 marks an empty slot
+     */
+    uint8_t wseq_index[CS40L25_WSEQ_INDEX_SIZE];
     uint8_t wseq_num_entries;                   ///< Number of entries currently in wseq_table
     bool wseq_initialized;                      ///< Flag indicating if the wseq_table has been initialized
+    /*
+     * Register changes recorded since cs40l25_txn_begin, in the order recorded
+     */
+    cs40l25_txn_entry_t txn[CS40L25_TXN_MAX_ENTRIES];
+    uint8_t txn_num_entries;                    ///< Number of entries currently in txn
+    bool txn_overflow;                          ///< Flag indicating a change was dropped because txn was full
     cs40l25_config_t config;                    ///< Driver configuration fields - see cs40l25_config_t
     fw_img_info_t *fw_info;                     ///< Current HALO FW/Coefficient boot configuration
     uint32_t event_flags;                       ///< Most recent event_flags reported to BSP Notification callback
+    uint8_t cal_state;                          ///< Current step of Calibration - @see CS40L25_CAL_STATE_
+    uint8_t cal_type;                           ///< Calibration types requested - @see CS40L25_CALIB_
+    uint8_t cal_poll_count;                     ///< Number of times CAL_Q has been polled
+    uint32_t cal_deadline;                      ///< BSP time in ms at which to run the next step
+    uint32_t cal_pcm_vol;                       ///< INTP_AMP_CTRL value to restore after Calibration
+    uint32_t cal_ctrl_addresses[6];             ///< Calibration firmware control addresses
 } cs40l25_t;
 
 /***********************************************************************************************************************
@@ -507,6 +582,60 @@ uint32_t cs40l25_power(cs40l25_t *driver, uint32_t power_state);
  */
 uint32_t cs40l25_calibrate(cs40l25_t *driver, uint32_t calib_type);
 
+/**
+ * Start Calibration without blocking
+ *
+ * Performs the same procedure as cs40l25_calibrate, but returns after the first step.  Each later step is run from
+ * cs40l25_process once its delay has elapsed, so several devices can be calibrated at the same time.  When the
+ * sequence ends, CS40L25_EVENT_FLAG_CAL_DONE or CS40L25_EVENT_FLAG_CAL_ERROR is passed to the Notification Callback.
+ *
+ * Delays are timed against deadlines from the BSP get_time_ms, so blocking delays elsewhere only postpone the next step
+ * to the following call to cs40l25_process.
+ *
+ * @param [in] driver               Pointer to the driver state
+ * @param [in] calib_type           The calibration type to be performed
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL        if driver in invalid state for calibration, if the BSP does not provide get_time_ms, or
+ *                              any control port activity fails
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ * @see cs40l25_calibrate
+ *
+ */
+uint32_t cs40l25_calibrate_start(cs40l25_t *driver, uint32_t calib_type);
+
+/**
+ * Get record of current calibration data
+ *
+ * Packs config.cal_data into a CRC-protected record to be saved to non-volatile storage.
+ *
+ * @param [in] driver               Pointer to the driver state
+ * @param [out] record              Pointer to record to fill
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL        if any pointers are NULL, or if there is no valid calibration data
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+uint32_t cs40l25_get_cal_record(cs40l25_t *driver, cs40l25_cal_record_t *record);
+
+/**
+ * Apply a saved calibration record
+ *
+ * Validates the record and copies its contents to config.cal_data, to be applied during the next boot so that
+ * calibration does not need to be run again.
+ *
+ * @param [in] driver               Pointer to the driver state
+ * @param [in] record               Pointer to record restored from non-volatile storage
+ *
+ * @return
+ * - CS40L25_STATUS_FAIL        if any pointers are NULL, or if the record magic or CRC do not match
+ * - CS40L25_STATUS_OK          otherwise
+ *
+ */
+uint32_t cs40l25_set_cal_record(cs40l25_t *driver, cs40l25_cal_record_t *record);
+
 /**
  * Start I2S Streaming Mode
  *
@@ -25,6 +25,7 @@
 #include <stddef.h>
 #include "cs40l26.h"
 #include "bsp_driver_if.h"
+#include "crc32.h"
 #include "string.h"
 
 /***********************************************************************************************************************
@@ -418,6 +419,140 @@ static uint32_t cs40l26_hibernate(cs40l26_t *driver)
     return ret;
 }
 
+/**
+ * Run the current step of the Calibration sequence
+ *
+ * Each step performs its control port activity, then advances cal_state.  Every step but the last must be followed
+ * by a delay of CS40L26_F0_CALIBRATION_DELAY_MS.  The sequence is complete when cal_state returns to
+ * CS40L26_CAL_STATE_IDLE.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS40L26_STATUS_FAIL        if any control port transaction fails, or if no F0 estimate is available after
+ *                              CS40L26_F0_CALIBRATION_ATTEMPTS polls
+ * - CS40L26_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs40l26_cal_step(cs40l26_t *driver)
+{
+    uint32_t ret = CS40L26_STATUS_OK;
+    uint32_t redc, f0;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    switch (driver->cal_state)
+    {
+        case CS40L26_CAL_STATE_START:
+            driver->config.cal_data.is_valid_f0 = false;
+
+            ret = regmap_write(cp, CS40L26_DSP_VIRTUAL1_MBOX_1, CS40L26_DSP_MBOX_REDC_EST);
+            driver->cal_state = CS40L26_CAL_STATE_REDC_READ;
+            break;
+
+        case CS40L26_CAL_STATE_REDC_READ:
+            ret = regmap_read(cp, CS40L26_REDC_ESTIMATION_REG, &redc);
+            if (ret)
+            {
+                break;
+            }
+
+            driver->config.cal_data.redc = redc;
+            redc = 0xFF8000 & redc;
+
+            ret = regmap_write(cp, CS40L26_F0_ESTIMATION_REDC_REG, redc);
+            if (ret)
+            {
+                break;
+            }
+
+            ret = regmap_write(cp, CS40L26_DSP_VIRTUAL1_MBOX_1, CS40L26_DSP_MBOX_F0_EST);
+            driver->cal_poll_count = 0;
+            driver->cal_state = CS40L26_CAL_STATE_F0_POLL;
+            break;
+
+        case CS40L26_CAL_STATE_F0_POLL:
+            ret = regmap_read(cp, CS40L26_F0_ESTIMATION_F0_REG, &f0);
+            if (ret)
+            {
+                break;
+            }
+
+            if (f0 == 0)
+            {
+                if (++(driver->cal_poll_count) >= CS40L26_F0_CALIBRATION_ATTEMPTS)
+                {
+                    ret = CS40L26_STATUS_FAIL;
+                }
+                break;
+            }
+
+            driver->config.cal_data.f0 = f0;
+            driver->config.cal_data.is_valid_f0 = true;
+            driver->cal_state = CS40L26_CAL_STATE_IDLE;
+            break;
+
+        default:
+            ret = CS40L26_STATUS_FAIL;
+            break;
+    }
+
+    if (ret)
+    {
+        driver->cal_state = CS40L26_CAL_STATE_IDLE;
+        return CS40L26_STATUS_FAIL;
+    }
+
+    return CS40L26_STATUS_OK;
+}
+
+/**
+ * Schedule the next step of a non-blocking Calibration
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return none
+ *
+ */
+static void cs40l26_cal_schedule(cs40l26_t *driver)
+{
+    driver->cal_deadline = bsp_driver_if_g->get_time_ms() + CS40L26_F0_CALIBRATION_DELAY_MS;
+
+    return;
+}
+
+/**
+ * Advance a non-blocking Calibration sequence
+ *
+ * Runs the next step once its delay has elapsed and reports completion via the driver event flags.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return none
+ *
+ */
+static void cs40l26_cal_process(cs40l26_t *driver)
+{
+    if ((int32_t) (bsp_driver_if_g->get_time_ms() - driver->cal_deadline) < 0)
+    {
+        return;
+    }
+
+    if (cs40l26_cal_step(driver))
+    {
+        driver->event_flags |= CS40L26_EVENT_FLAG_CAL_ERROR;
+    }
+    else if (driver->cal_state == CS40L26_CAL_STATE_IDLE)
+    {
+        driver->event_flags |= CS40L26_EVENT_FLAG_CAL_DONE;
+    }
+    else
+    {
+        cs40l26_cal_schedule(driver);
+    }
+
+    return;
+}
+
 /***********************************************************************************************************************
  * API FUNCTIONS
  **********************************************************************************************************************/
@@ -483,6 +618,12 @@ uint32_t cs40l26_process(cs40l26_t *driver)
         driver->mode = CS40L26_MODE_HANDLING_CONTROLS;
     }
 
+    // Advance any non-blocking Calibration in progress
+    if (driver->cal_state != CS40L26_CAL_STATE_IDLE)
+    {
+        cs40l26_cal_process(driver);
+    }
+
     if (driver->event_flags)
     {
         if (driver->config.bsp_config.notification_cb != NULL)
@@ -702,61 +843,98 @@ uint32_t cs40l26_power(cs40l26_t *driver, uint32_t power_state)
  */
 uint32_t cs40l26_calibrate(cs40l26_t *driver)
 {
-    uint32_t redc, f0;
-    uint32_t ret = CS40L26_STATUS_OK;
-    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+    uint32_t ret;
 
-    ret = regmap_write(cp, CS40L26_DSP_VIRTUAL1_MBOX_1, CS40L26_DSP_MBOX_REDC_EST);
-    if (ret)
+    if (driver->cal_state != CS40L26_CAL_STATE_IDLE)
     {
-        return ret;
+        return CS40L26_STATUS_FAIL;
     }
 
-    bsp_driver_if_g->set_timer(20 , NULL, NULL);
+    driver->cal_state = CS40L26_CAL_STATE_START;
 
-    ret = regmap_read(cp, CS40L26_REDC_ESTIMATION_REG, &redc);
-    if (ret)
+    while (driver->cal_state != CS40L26_CAL_STATE_IDLE)
     {
-        return ret;
+        ret = cs40l26_cal_step(driver);
+        if (ret)
+        {
+            return ret;
+        }
+
+        if (driver->cal_state != CS40L26_CAL_STATE_IDLE)
+        {
+            bsp_driver_if_g->set_timer(CS40L26_F0_CALIBRATION_DELAY_MS, NULL, NULL);
+        }
     }
 
-    driver->config.cal_data.redc = redc;
-    redc = 0xFF8000 & redc;
+    return CS40L26_STATUS_OK;
+}
 
-    ret = regmap_write(cp, CS40L26_F0_ESTIMATION_REDC_REG, redc);
-    if (ret)
+/**
+ * Start Calibration without blocking
+ *
+ */
+uint32_t cs40l26_calibrate_start(cs40l26_t *driver)
+{
+    uint32_t ret;
+
+    if ((driver->cal_state != CS40L26_CAL_STATE_IDLE) || (bsp_driver_if_g->get_time_ms == NULL))
     {
-        return ret;
+        return CS40L26_STATUS_FAIL;
     }
 
-    ret = regmap_write(cp, CS40L26_DSP_VIRTUAL1_MBOX_1, CS40L26_DSP_MBOX_F0_EST);
+    driver->cal_state = CS40L26_CAL_STATE_START;
+
+    ret = cs40l26_cal_step(driver);
     if (ret)
     {
         return ret;
     }
 
-    for (uint8_t i = 0; i < CS40L26_F0_CALIBRATION_ATTEMPTS; i++)
+    cs40l26_cal_schedule(driver);
+
+    return CS40L26_STATUS_OK;
+}
+
+/**
+ * Get record of current calibration data
+ *
+ */
+uint32_t cs40l26_get_cal_record(cs40l26_t *driver, cs40l26_cal_record_t *record)
+{
+    if ((driver == NULL) || (record == NULL) || (!driver->config.cal_data.is_valid_f0))
     {
-        bsp_driver_if_g->set_timer(CS40L26_F0_CALIBRATION_DELAY_MS , NULL, NULL);
-        ret = regmap_read(cp, CS40L26_F0_ESTIMATION_F0_REG, &f0);
-        if (ret)
-        {
-            return ret;
-        }
+        return CS40L26_STATUS_FAIL;
+    }
 
-        if (f0)
-        {
-            break;
-        }
+    memset(record, 0, sizeof(cs40l26_cal_record_t));
+    record->magic = CS40L26_CAL_RECORD_MAGIC;
+    record->valid = CS40L26_CAL_RECORD_VALID_F0;
+    record->f0 = driver->config.cal_data.f0;
+    record->redc = driver->config.cal_data.redc;
+    record->crc = crc32_calculate((uint8_t *) record, offsetof(cs40l26_cal_record_t, crc));
+
+    return CS40L26_STATUS_OK;
+}
+
+/**
+ * Apply a saved calibration record
+ *
+ */
+uint32_t cs40l26_set_cal_record(cs40l26_t *driver, cs40l26_cal_record_t *record)
+{
+    if ((driver == NULL) || (record == NULL) || (record->magic != CS40L26_CAL_RECORD_MAGIC))
+    {
+        return CS40L26_STATUS_FAIL;
     }
 
-    if (f0 == 0)
+    if (record->crc != crc32_calculate((uint8_t *) record, offsetof(cs40l26_cal_record_t, crc)))
     {
         return CS40L26_STATUS_FAIL;
     }
 
-    driver->config.cal_data.f0 = f0;
-    driver->config.cal_data.is_valid_f0 = true;
+    driver->config.cal_data.is_valid_f0 = (record->valid & CS40L26_CAL_RECORD_VALID_F0) ? true : false;
+    driver->config.cal_data.f0 = record->f0;
+    driver->config.cal_data.redc = record->redc;
 
     return CS40L26_STATUS_OK;
 }
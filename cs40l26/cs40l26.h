@@ -116,10 +116,30 @@ extern "C" {
  */
 #define CS40L26_EVENT_FLAG_DSP_ERROR                    (1 << 31)
 #define CS40L26_EVENT_FLAG_STATE_ERROR                  (1 << 30)
+#define CS40L26_EVENT_FLAG_CAL_ERROR                    (1 << 29)
+#define CS40L26_EVENT_FLAG_CAL_DONE                     (1 << 2)
 #define CS40L26_EVENT_FLAG_WKSRC_CP                     (1 << 1)
 #define CS40L26_EVENT_FLAG_WKSRC_GPIO                   (1 << 0)
 /** @} */
 
+/**
+ * @defgroup CS40L26_CAL_STATE_
+ * @brief Steps of the Calibration sequence
+ *
+ * @see cs40l26_t member cal_state
+ * @see cs40l26_calibrate_start
+ *
+ * @{
+ */
+#define CS40L26_CAL_STATE_IDLE                          (0)
+#define CS40L26_CAL_STATE_START                         (1)
+#define CS40L26_CAL_STATE_REDC_READ                     (2)
+#define CS40L26_CAL_STATE_F0_POLL                       (3)
+/** @} */
+
+#define CS40L26_CAL_RECORD_MAGIC                        (0x4C32364B)    ///< Marks a cs40l26_cal_record_t ("L26K")
+#define CS40L26_CAL_RECORD_VALID_F0                     (1 << 0)        ///< cs40l26_cal_record_t f0/redc valid
+
 /**
  *  Minimum firmware version that will be accepted by the boot function
  */
@@ -169,6 +189,24 @@ typedef struct
     uint32_t redc;      ///< Encoded DC resistance (ReDC) determined by Calibration procedure.
 } cs40l26_calibration_t;
 
+/**
+ * Calibration record to save to non-volatile storage
+ *
+ * All members are 32-bit words so that the record has no padding and the CRC covers every byte before member crc.
+ *
+ * @see cs40l26_get_cal_record
+ * @see cs40l26_set_cal_record
+ *
+ */
+typedef struct
+{
+    uint32_t magic;     ///< Always CS40L26_CAL_RECORD_MAGIC
+    uint32_t valid;     ///< Bitwise OR of CS40L26_CAL_RECORD_VALID_ flags
+    uint32_t f0;        ///< Encoded resonant frequency (f0)
+    uint32_t redc;      ///< Encoded DC resistance (ReDC)
+    uint32_t crc;       ///< CRC-32 of all preceding members
+} cs40l26_cal_record_t;
+
 /**
  * Configuration parameters required for calls to BSP-Driver Interface
  */
@@ -210,6 +248,9 @@ typedef struct
     cs40l26_config_t config;    ///< Driver configuration fields - see cs40l26_config_t
     fw_img_info_t *fw_info;     ///< Current HALO FW/Coefficient boot configuration
     uint32_t event_flags;       ///< Most recent event_flags reported to BSP Notification callback
+    uint8_t cal_state;          ///< Current step of Calibration - @see CS40L26_CAL_STATE_
+    uint8_t cal_poll_count;     ///< Number of times F0 estimate has been polled
+    uint32_t cal_deadline;      ///< BSP time in ms at which to run the next step
 } cs40l26_t;
 
 /***********************************************************************************************************************
@@ -344,6 +385,59 @@ uint32_t cs40l26_power(cs40l26_t *driver, uint32_t power_state);
  */
 uint32_t cs40l26_calibrate(cs40l26_t *driver);
 
+/**
+ * Start Calibration without blocking
+ *
+ * Performs the same procedure as cs40l26_calibrate, but returns after the first step.  Each later step is run from
+ * cs40l26_process once its delay has elapsed, so several devices can be calibrated at the same time.  When the
+ * sequence ends, CS40L26_EVENT_FLAG_CAL_DONE or CS40L26_EVENT_FLAG_CAL_ERROR is passed to the Notification Callback.
+ *
+ * Delays are timed against deadlines from the BSP get_time_ms, so blocking delays elsewhere only postpone the next step
+ * to the following call to cs40l26_process.
+ *
+ * @param [in] driver               Pointer to the driver state
+ *
+ * @return
+ * - CS40L26_STATUS_FAIL        if Calibration is already in progress, if the BSP does not provide get_time_ms, or any
+ *                              control port transaction fails
+ * - CS40L26_STATUS_OK          otherwise
+ *
+ * @see cs40l26_calibrate
+ *
+ */
+uint32_t cs40l26_calibrate_start(cs40l26_t *driver);
+
+/**
+ * Get record of current calibration data
+ *
+ * Packs config.cal_data into a CRC-protected record to be saved to non-volatile storage.
+ *
+ * @param [in] driver               Pointer to the driver state
+ * @param [out] record              Pointer to record to fill
+ *
+ * @return
+ * - CS40L26_STATUS_FAIL        if any pointers are NULL, or if there is no valid calibration data
+ * - CS40L26_STATUS_OK          otherwise
+ *
+ */
+uint32_t cs40l26_get_cal_record(cs40l26_t *driver, cs40l26_cal_record_t *record);
+
+/**
+ * Apply a saved calibration record
+ *
+ * Validates the record and copies its contents to config.cal_data, to be applied during the next boot so that
+ * calibration does not need to be run again.
+ *
+ * @param [in] driver               Pointer to the driver state
+ * @param [in] record               Pointer to record restored from non-volatile storage
+ *
+ * @return
+ * - CS40L26_STATUS_FAIL        if any pointers are NULL, or if the record magic or CRC do not match
+ * - CS40L26_STATUS_OK          otherwise
+ *
+ */
+uint32_t cs40l26_set_cal_record(cs40l26_t *driver, cs40l26_cal_record_t *record);
+
 /**
  * Trigger haptic effect
  *
@@ -120,6 +120,8 @@ extern "C" {
  *
  * @{
  */
+#define CS47L15_EVENT_FLAG_FLLAO_LOCK                   (1 << 6)
+#define CS47L15_EVENT_FLAG_FLL1_LOCK                    (1 << 5)
 #define CS47L15_EVENT_FLAG_BOOT_DONE                    (1 << 4)
 #define CS47L15_EVENT_FLAG_DSP_IRQ1                     (1 << 3)
 #define CS47L15_EVENT_FLAG_DSP_BUS_ERROR                (1 << 2)
@@ -302,6 +304,7 @@ typedef struct
     cs47l15_dsp_t dsp_info[CS47L15_NUM_DSP];             ///< Current ADSP2 FW/Coefficient boot configuration
 
     cs47l15_fll_t fll[CS47L15_NUM_FLL];
+    uint32_t fll_lock_pending;                           ///< Lock event flags armed by cs47l15_fll_enable_notify
 } cs47l15_t;
 
 /**
@@ -430,6 +433,8 @@ uint32_t cs47l15_read_reg(cs47l15_t *driver, uint32_t addr, uint32_t *val);
 /*
  * Writes the contents of a single register/memory address
  *
+ * Writing CS47L15_SYSTEM_CLOCK_1 also sets the control port speed from the new SYSCLK configuration.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] addr             Address of the register to be written
  * @param [in] val              Value to be written to the register
@@ -437,6 +442,7 @@ uint32_t cs47l15_read_reg(cs47l15_t *driver, uint32_t addr, uint32_t *val);
  * @return
  * - CS47L15_STATUS_FAIL if:
  *      - Control port activity fails
+ *      - The BSP fails to change the control port speed
  * - otherwise, returns CS47L15_STATUS_OK
  *
  */
@@ -445,6 +451,8 @@ uint32_t cs47l15_write_reg(cs47l15_t *driver, uint32_t addr, uint32_t val);
 /*
  * Reads, updates and writes (if there's a change) the contents of a single register/memory address
  *
+ * Writing CS47L15_SYSTEM_CLOCK_1 also sets the control port speed from the new SYSCLK configuration.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] addr             Address of the register to be written
  * @param [in] mask             Mask of the bits within the register to update
@@ -453,6 +461,7 @@ uint32_t cs47l15_write_reg(cs47l15_t *driver, uint32_t addr, uint32_t val);
  * @return
  * - CS47L15_STATUS_FAIL if:
  *      - Control port activity fails
+ *      - The BSP fails to change the control port speed
  * - otherwise, returns CS47L15_STATUS_OK
  *
  */
@@ -587,9 +596,31 @@ uint32_t cs47l15_fll_enable(cs47l15_t *driver, uint32_t fll_id);
  */
 uint32_t cs47l15_fll_disable(cs47l15_t *driver, uint32_t fll_id);
 
+/**
+ * Enable an FLL and notify when it achieves lock
+ *
+ * Unmasks the lock interrupt of the FLL and enables it, without waiting for lock.  When the FLL locks, the
+ * corresponding CS47L15_EVENT_FLAG_xxx_LOCK is passed to the notification callback from cs47l15_process, and the lock
+ * interrupt is masked again.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] fll_id           FLL Id to be enabled.
+ *
+ * @return
+ * - CS47L15_STATUS_FAIL        if requested FLL is invalid, or if any control port transaction fails
+ * - CS47L15_STATUS_OK          otherwise
+ *
+ * @see CS47L15_EVENT_FLAG_
+ *
+ */
+uint32_t cs47l15_fll_enable_notify(cs47l15_t *driver, uint32_t fll_id);
+
 /**
  * Wait a short time for the FLL to reach a locked state
  *
+ * The lock status is polled at intervals starting at 1ms and doubling up to 10ms, so a fast lock is seen without a
+ * full polling period of latency.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] fll_id           FLL Id to achieve lock
  *
@@ -48,6 +48,16 @@ void cs47l35_notification_callback(uint32_t event_flags, void *arg);
 static cs47l35_t cs47l35_driver;
 static fw_img_boot_state_t boot_state_dsp2;
 static fw_img_boot_state_t boot_state_dsp3;
+static cs47l35_boot_img_t boot_imgs[] =
+{
+    {2, &boot_state_dsp2},
+    {3, &boot_state_dsp3},
+};
+static const uint8_t *boot_fw_imgs[] =
+{
+    cs47l35_dsp2_fw_img,
+    cs47l35_dsp3_fw_img,
+};
 
 static void * lin_buf_ptr_dec;
 static void * lin_buf_ptr_enc;
@@ -80,6 +90,7 @@ static bridge_device_t device_list[] =
 {
     {
         .bus_i2c_cs_address = 0,
+        .reg_addr_stride = 2,
         .device_id_str = "6360",
         .dev_name_str = "CS47L35-1",
         .b.dev_id = BSP_DUT_DEV_ID,
@@ -291,6 +302,75 @@ uint32_t bsp_dut_boot(uint32_t core_no, const uint8_t *fw_img_ptr, fw_img_boot_s
     return cs47l35_boot(&cs47l35_driver, core_no, &boot_state->fw_info);
 }
 
+static uint32_t bsp_dut_boot_multi(cs47l35_boot_img_t *imgs, const uint8_t **fw_imgs, uint32_t img_count)
+{
+    uint32_t ret, i;
+    uint32_t block_data_size = 0;
+    uint8_t *block_data;
+    fw_img_boot_state_t *boot_state;
+
+    for (i = 0; i < img_count; i++)
+    {
+        boot_state = imgs[i].boot_state;
+
+        // Free anything malloc'ed in previous boots
+        if (boot_state->fw_info.sym_table)
+            bsp_free(boot_state->fw_info.sym_table);
+        if (boot_state->fw_info.alg_id_list)
+            bsp_free(boot_state->fw_info.alg_id_list);
+        if (boot_state->block_data)
+            bsp_free(boot_state->block_data);
+
+        memset(boot_state, 0, sizeof(fw_img_boot_state_t));
+
+        // The complete fw_img is in memory, so hand over all of it at once
+        boot_state->fw_img_blocks = (uint8_t *) fw_imgs[i];
+        boot_state->fw_img_blocks_size = FW_IMG_SIZE(fw_imgs[i]);
+
+        ret = fw_img_read_header(boot_state);
+        if (ret)
+        {
+            return BSP_STATUS_FAIL;
+        }
+
+        boot_state->fw_info.sym_table = (fw_img_v1_sym_table_t *)bsp_malloc(boot_state->fw_info.header.sym_table_size *
+                                                                       sizeof(fw_img_v1_sym_table_t));
+        if (boot_state->fw_info.sym_table == NULL)
+        {
+            return BSP_STATUS_FAIL;
+        }
+
+        boot_state->fw_info.alg_id_list = (uint32_t *) bsp_malloc(boot_state->fw_info.header.alg_id_list_size * sizeof(uint32_t));
+        if (boot_state->fw_info.alg_id_list == NULL)
+        {
+            return BSP_STATUS_FAIL;
+        }
+
+        if (boot_state->fw_info.header.max_block_size > block_data_size)
+        {
+            block_data_size = boot_state->fw_info.header.max_block_size;
+        }
+    }
+
+    // One block buffer, large enough for the largest data block of any fw_img, is shared by all cores
+    block_data = (uint8_t *) bsp_malloc(block_data_size);
+    if (block_data == NULL)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    ret = cs47l35_boot_multi(&cs47l35_driver, imgs, img_count, block_data, block_data_size);
+
+    bsp_free(block_data);
+
+    if (ret)
+    {
+        return BSP_STATUS_FAIL;
+    }
+
+    return BSP_STATUS_OK;
+}
+
 void bsp_enable_mic()
 {
     cs47l35_write_reg(&cs47l35_driver, CS47L35_MIC_CHARGE_PUMP_1, 0x0007); // * Mic_Charge_Pump_1(200H): 0007  CP2_DISCH=1, CP2_BYPASS=1, CP2_ENA=1
@@ -402,20 +482,12 @@ uint32_t bsp_dut_use_case(uint32_t use_case)
             cs47l35_write_reg(&cs47l35_driver, CS47L35_OUT1LMIX_INPUT_1_SOURCE, 0x78); // DSP3 channel 1
             cs47l35_write_reg(&cs47l35_driver, CS47L35_OUT1RMIX_INPUT_1_SOURCE, 0x78); // DSP3 channel 1
 
-            // Boot and load firmware
-            ret = cs47l35_power(&cs47l35_driver, 2, CS47L35_POWER_MEM_ENA);
-            if (ret)
-            {
-                break;
-            }
-            bsp_dut_boot(2, cs47l35_dsp2_fw_img, &boot_state_dsp2);
-
-            ret = cs47l35_power(&cs47l35_driver, 3, CS47L35_POWER_MEM_ENA);
+            // Boot and load firmware on DSP2 and DSP3 together
+            ret = bsp_dut_boot_multi(boot_imgs, boot_fw_imgs, 2);
             if (ret)
             {
                 break;
             }
-            bsp_dut_boot(3, cs47l35_dsp3_fw_img, &boot_state_dsp3);
 
             addr = cs47l35_find_symbol(&cs47l35_driver, 2, CS47L35_DSP2_SYM_SILK_ENCODER_BITRATE_BPS);
             if (!addr)
@@ -24,6 +24,7 @@
  **********************************************************************************************************************/
 #include <stddef.h>
 #include "cs47l35.h"
+#include "fll.h"
 #include "bsp_driver_if.h"
 #include "string.h"
 
@@ -41,19 +42,19 @@
 #define CS47L35_POLL_ACK_CTRL_MAX               (10)    ///< Maximum number of times to poll ACK controls
 #define CS47L35_POLL_MEM_ENA_MS                 (250)   ///< Delay in ms between polling ACK controls
 #define CS47L35_POLL_MEM_ENA_MAX                (10)    ///< Maximum number of times to poll ACK controls
+#define CS47L35_POLL_FLL_LOCK_MS_MIN            (1)     ///< Initial delay in ms between polling FLL lock status
+#define CS47L35_POLL_FLL_LOCK_MS_MAX            (10)    ///< Maximum delay in ms between polling FLL lock status
+#define CS47L35_POLL_FLL_LOCK_TIMEOUT_MS        (300)   ///< Total time in ms to poll FLL lock status
+
+#define CS47L35_SPI_MAX_CLOCK_HZ_NO_SYSCLK     (6000000)   ///< Fastest SPI clock until an FLL is locked
+#define CS47L35_SPI_MAX_CLOCK_HZ_SYSCLK        (25000000)  ///< Fastest SPI clock with SYSCLK running from an FLL
+
+#define CS47L35_SYSCLK_SRC_FLL1                (0x4)       ///< SYSCLK_SRC for FLL1
 /** @} */
 
 /**
  * FLL defines
  */
-
-#define CS47L35_FLL_MAX_FREF            (13500000)
-#define CS47L35_FLL_MIN_FOUT            (90000000)
-#define CS47L35_FLL_MAX_FOUT            (100000000)
-#define CS47L35_FLL_MAX_FRATIO          (16)
-#define CS47L35_FLL_MAX_REFDIV          (8)
-#define CS47L35_FLL_MAX_N               (1023)
-
 #define CS47L35_FLL_SYNCHRONISER_OFFS       (0x10)
 #define CS47L35_FLL_CONTROL_1_OFFS          (0x1)
 #define CS47L35_FLL_CONTROL_2_OFFS          (0x2)
@@ -66,8 +67,6 @@
 #define CS47L35_FLL_SYNCHRONISER_1_OFFS     (0x1)
 #define CS47L35_FLL_SYNCHRONISER_7_OFFS     (0x7)
 
-#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
-
 /***********************************************************************************************************************
  * LOCAL VARIABLES
  **********************************************************************************************************************/
@@ -118,6 +117,37 @@ static const uint32_t cs47l35_reva_errata_patch[] =
     0x47e, 0x07ff,
 };
 
+/**
+ * FLL lock interrupt bits, indexed by FLL Id
+ *
+ * The mask is the same for the CS47L35_IRQ1_STATUS_2, CS47L35_IRQ1_MASK_2 and CS47L35_IRQ1_RAW_STATUS_2 registers.
+ *
+ * @see cs47l35_fll_enable_notify
+ */
+static const struct
+{
+    uint32_t mask;
+    uint32_t event_flag;
+    uint32_t sysclk_src;                    ///< SYSCLK_SRC value selecting this FLL
+} cs47l35_fll_lock_data[CS47L35_NUM_FLL] =
+{
+    {CS47L35_FLL1_LOCK_EINT1_MASK, CS47L35_EVENT_FLAG_FLL1_LOCK, CS47L35_SYSCLK_SRC_FLL1},
+};
+
+/**
+ * Default fastest SPI clock in each power/clocking state, used unless the BSP gives its own in
+ * cp_config.spi_max_speed_hz
+ *
+ * @see regmap_set_clock_state
+ */
+static const uint32_t cs47l35_spi_max_speed_hz[BSP_CLOCK_STATE_TOTAL] =
+{
+    [BSP_CLOCK_STATE_RESET] = CS47L35_SPI_MAX_CLOCK_HZ_NO_SYSCLK,
+    [BSP_CLOCK_STATE_OTP_BOOT] = CS47L35_SPI_MAX_CLOCK_HZ_NO_SYSCLK,
+    [BSP_CLOCK_STATE_PLL_LOCKED] = CS47L35_SPI_MAX_CLOCK_HZ_SYSCLK,
+    [BSP_CLOCK_STATE_HIBERNATE] = CS47L35_SPI_MAX_CLOCK_HZ_NO_SYSCLK,
+};
+
 /**
 * CS47L35 interrupt regs to check
 *
@@ -134,51 +164,6 @@ const irq_reg_t cs47l35_event_data[] =
     {0x0E, CS47L35_SPK_OVERHEAT_EINT1_MASK     , CS47L35_EVENT_FLAG_OVERTEMP_ERROR},   //< CS47L35_IRQ1_STATUS_15
 };
 
-static const struct {
-    uint32_t min;
-    uint32_t max;
-    uint16_t  fratio;
-    int32_t  ratio;
-} fll_sync_fratios[] = {
-    {       0,    64000, 4, 16 },
-    {   64000,   128000, 3,  8 },
-    {  128000,   256000, 2,  4 },
-    {  256000,  1000000, 1,  2 },
-    { 1000000, 13500000, 0,  1 },
-};
-
-struct cs47l35_fll_gains {
-    uint32_t  min;
-    uint32_t  max;
-    int32_t   gain;            /* main gain */
-    int32_t   alt_gain;        /* alternate integer gain */
-};
-
-static const struct cs47l35_fll_gains cs47l35_fll_sync_gains[] = {
-    {       0,   256000, 0, -1 },
-    {  256000,  1000000, 2, -1 },
-    { 1000000, 13500000, 4, -1 },
-};
-
-static const struct cs47l35_fll_gains cs47l35_fll_main_gains[] = {
-    {       0,   100000, 0, 2 },
-    {  100000,   375000, 2, 2 },
-    {  375000,   768000, 3, 2 },
-    {  768001,  1500000, 3, 3 },
-    { 1500000,  6000000, 4, 3 },
-    { 6000000, 13500000, 5, 3 },
-};
-
-struct cs47l35_fll_cfg {
-    int32_t n;
-    uint32_t theta;
-    uint32_t lambda;
-    int32_t refdiv;
-    int32_t fratio;
-    int32_t gain;
-    int32_t alt_gain;
-};
-
 /***********************************************************************************************************************
  * LOCAL FUNCTIONS
  **********************************************************************************************************************/
@@ -315,6 +300,57 @@ uint32_t cs47l35_read_reg(cs47l35_t *driver, uint32_t addr, uint32_t *val)
     return CS47L35_STATUS_OK;
 }
 
+/**
+ * Report the clocking state to the BSP from the SYSCLK configuration
+ *
+ * The control port only runs at CS47L35_SPI_MAX_CLOCK_HZ_SYSCLK while SYSCLK is enabled and sourced from a locked FLL,
+ * so both are read back, rather than assumed from an FLL locking or being disabled.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS47L35_STATUS_FAIL        if control port activity fails, or if the BSP fails to change the SPI clock
+ * - CS47L35_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs47l35_update_clock_state(cs47l35_t *driver)
+{
+    uint32_t ret;
+    uint32_t sysclk, sysclk_src, sts;
+    uint32_t state = BSP_CLOCK_STATE_OTP_BOOT;
+
+    ret = cs47l35_read_reg(driver, CS47L35_SYSTEM_CLOCK_1, &sysclk);
+    if (ret)
+    {
+        return ret;
+    }
+
+    sysclk_src = (sysclk & CS47L35_SYSCLK_SRC_MASK) >> CS47L35_SYSCLK_SRC_SHIFT;
+    if (sysclk & CS47L35_SYSCLK_ENA_MASK)
+    {
+        ret = cs47l35_read_reg(driver, CS47L35_IRQ1_RAW_STATUS_2, &sts);
+        if (ret)
+        {
+            return ret;
+        }
+
+        for (uint32_t i = 0; i < CS47L35_NUM_FLL; i++)
+        {
+            if ((sysclk_src == cs47l35_fll_lock_data[i].sysclk_src) && (sts & cs47l35_fll_lock_data[i].mask))
+            {
+                state = BSP_CLOCK_STATE_PLL_LOCKED;
+            }
+        }
+    }
+
+    if (regmap_set_clock_state(REGMAP_GET_CP(driver), state))
+    {
+        return CS47L35_STATUS_FAIL;
+    }
+
+    return CS47L35_STATUS_OK;
+}
+
 /**
  * Writes the contents of a single register/memory address
  *
@@ -340,6 +376,12 @@ uint32_t cs47l35_write_reg(cs47l35_t *driver, uint32_t addr, uint32_t val)
         return CS47L35_STATUS_FAIL;
     }
 
+    // The SPI clock follows SYSCLK being enabled, disabled or changing source
+    if (addr == CS47L35_SYSTEM_CLOCK_1)
+    {
+        return cs47l35_update_clock_state(driver);
+    }
+
     return CS47L35_STATUS_OK;
 }
 
@@ -354,6 +396,12 @@ uint32_t cs47l35_update_reg(cs47l35_t *driver, uint32_t addr, uint32_t mask, uin
         return CS47L35_STATUS_FAIL;
     }
 
+    // The SPI clock follows SYSCLK being enabled, disabled or changing source
+    if (addr == CS47L35_SYSTEM_CLOCK_1)
+    {
+        return cs47l35_update_clock_state(driver);
+    }
+
     return CS47L35_STATUS_OK;
 }
 
@@ -584,6 +632,89 @@ static uint32_t cs47l35_power_mem_ena(cs47l35_t *driver, cs47l35_dsp_t *dsp_info
     return CS47L35_STATUS_OK;
 }
 
+/**
+ * Memory enable for several DSP cores
+ *
+ * Sets MEM_ENA on every core listed, then polls RAM_RDY of all of them in a single loop, so the memory of all cores
+ * powers up in parallel.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] imgs             Array of fw_imgs listing the DSP cores
+ * @param [in] img_count        Number of entries in imgs
+ *
+ * @return
+ * - CS47L35_STATUS_FAIL if:
+ *      - Any core listed is not disabled
+ *      - Control port activity fails
+ *      - Polling of RAM_RDY times out
+ * - CS47L35_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs47l35_power_mem_ena_multi(cs47l35_t *driver, cs47l35_boot_img_t *imgs, uint32_t img_count)
+{
+    uint32_t val, i, j, ret;
+    uint32_t pending = 0;
+    cs47l35_dsp_t *dsp_info;
+
+    for (j = 0; j < img_count; j++)
+    {
+        if (driver->dsp_info[imgs[j].dsp_core - 1].state != disabled)
+        {
+            return CS47L35_STATUS_FAIL;
+        }
+    }
+
+    for (j = 0; j < img_count; j++)
+    {
+        dsp_info = &driver->dsp_info[imgs[j].dsp_core - 1];
+
+        ret = cs47l35_update_reg(driver, dsp_info->base_addr + CS47L35_DSP_OFF_CONFIG_1, CS47L35_DSP1_MEM_ENA_MASK, CS47L35_DSP1_MEM_ENA);
+        if (ret == CS47L35_STATUS_FAIL)
+        {
+            return ret;
+        }
+
+        pending |= 1 << j;
+    }
+
+    for (i = 0; (i < CS47L35_POLL_MEM_ENA_MAX) && pending; i++)
+    {
+        for (j = 0; j < img_count; j++)
+        {
+            if (!(pending & (1 << j)))
+            {
+                continue;
+            }
+
+            dsp_info = &driver->dsp_info[imgs[j].dsp_core - 1];
+
+            ret = cs47l35_read_reg(driver, dsp_info->base_addr + CS47L35_DSP_OFF_STATUS_1, &val);
+            if (ret == CS47L35_STATUS_FAIL)
+            {
+                return ret;
+            }
+
+            if (val & CS47L35_DSP1_RAM_RDY)
+            {
+                dsp_info->state = mem_enabled;
+                pending &= ~(1 << j);
+            }
+        }
+
+        if (pending)
+        {
+            bsp_driver_if_g->set_timer(CS47L35_POLL_MEM_ENA_MS, NULL, NULL);
+        }
+    }
+
+    if (pending)
+    {
+        return CS47L35_STATUS_FAIL;
+    }
+
+    return CS47L35_STATUS_OK;
+}
+
 /**
  * Memory disable
  *
@@ -619,6 +750,67 @@ static uint32_t cs47l35_power_mem_dis(cs47l35_t *driver, cs47l35_dsp_t *dsp_info
     return ret;
 }
 
+/**
+ * Handle lock events of FLLs armed by cs47l35_fll_enable_notify
+ *
+ * The raw lock status is checked rather than the edge-triggered interrupt flag, so a lock achieved before the
+ * interrupt was unmasked is still reported.  Each FLL is reported once, after which its lock interrupt is masked.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS47L35_STATUS_FAIL        Control port activity fails
+ * - CS47L35_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs47l35_fll_lock_handler(cs47l35_t *driver)
+{
+    uint32_t ret;
+    uint32_t sts;
+    uint32_t locked = 0;
+
+    if (!driver->fll_lock_pending)
+    {
+        return CS47L35_STATUS_OK;
+    }
+
+    ret = cs47l35_read_reg(driver, CS47L35_IRQ1_RAW_STATUS_2, &sts);
+    if (ret)
+    {
+        return ret;
+    }
+
+    for (uint32_t i = 0; i < CS47L35_NUM_FLL; i++)
+    {
+        if ((driver->fll_lock_pending & cs47l35_fll_lock_data[i].event_flag) &&
+            (sts & cs47l35_fll_lock_data[i].mask))
+        {
+            driver->event_flags |= cs47l35_fll_lock_data[i].event_flag;
+            driver->fll_lock_pending &= ~cs47l35_fll_lock_data[i].event_flag;
+            locked |= cs47l35_fll_lock_data[i].mask;
+        }
+    }
+
+    if (locked)
+    {
+        ret = cs47l35_update_clock_state(driver);
+        if (ret)
+        {
+            return ret;
+        }
+
+        ret = cs47l35_update_reg(driver, CS47L35_IRQ1_MASK_2, locked, locked);
+        if (ret)
+        {
+            return ret;
+        }
+
+        ret = cs47l35_write_reg(driver, CS47L35_IRQ1_STATUS_2, locked);
+    }
+
+    return ret;
+}
+
 /**
  * Handle events indicated by the IRQ pin ALERTb
  *
@@ -669,11 +861,11 @@ static uint32_t cs47l35_event_handler(cs47l35_t *driver)
         }
     }
 
-    return CS47L35_STATUS_OK;
+    return cs47l35_fll_lock_handler(driver);
 }
 
 static uint32_t cs47l35_write_fll(cs47l35_t *driver, uint32_t base,
-                                  struct cs47l35_fll_cfg *cfg, int32_t source,
+                                  fll_madera_cfg_t *cfg, int32_t source,
                                   bool sync, int32_t gain)
 {
     uint32_t ret = CS47L35_STATUS_OK;
@@ -732,194 +924,6 @@ static uint32_t cs47l35_write_fll(cs47l35_t *driver, uint32_t base,
     return ret;
 }
 
-static int32_t cs47l35_find_sync_fratio(uint32_t fref, int32_t  *fratio)
-{
-    uint32_t i;
-
-    for (i = 0; i < ARRAY_SIZE(fll_sync_fratios); i++)
-    {
-        if (fll_sync_fratios[i].min <= fref &&
-            fref <= fll_sync_fratios[i].max)
-            {
-            if (fratio)
-            {
-                *fratio = fll_sync_fratios[i].fratio;
-            }
-            return fll_sync_fratios[i].ratio;
-        }
-    }
-
-    return -1;
-}
-
-static int32_t cs47l35_find_main_fratio(uint32_t fref, uint32_t fout,
-                                        int32_t *fratio)
-{
-    int32_t ratio = 1;
-
-    while ((fout / (ratio * fref)) > CS47L35_FLL_MAX_N)
-    {
-        ratio++;
-    }
-    if (fratio)
-    {
-        *fratio = ratio - 1;
-    }
-    return ratio;
-}
-
-static int32_t cs47l35_find_fratio(cs47l35_fll_t *fll,
-                                   uint32_t fref,
-                                   bool sync, int32_t *fratio)
-{
-    if (sync)
-    {
-        return cs47l35_find_sync_fratio(fref, fratio);
-    }
-    else
-    {
-        return cs47l35_find_main_fratio(fref, fll->fout, fratio);
-    }
-}
-
-static int32_t cs47l35_calc_fratio(cs47l35_fll_t *fll,
-                                   struct cs47l35_fll_cfg *cfg,
-                                   uint32_t fref,
-                                   bool sync)
-{
-    int32_t init_ratio, div;
-
-    /* fref must be <=13.5MHz, find initial refdiv */
-    div = 1;
-    cfg->refdiv = 0;
-    while (fref > CS47L35_FLL_MAX_FREF)
-    {
-        div *= 2;
-        fref /= 2;
-        cfg->refdiv++;
-
-        if (div > CS47L35_FLL_MAX_REFDIV)
-        {
-            return -1;  // return a neg value to signal an error
-        }
-    }
-
-    /* Find an appropriate FLL_FRATIO */
-    init_ratio = cs47l35_find_fratio(fll, fref, sync, &cfg->fratio);
-    if (init_ratio < 0)
-    {
-        return init_ratio;
-    }
-
-    if (!sync)
-    {
-        cfg->fratio = init_ratio - 1;
-    }
-
-    return init_ratio;
-}
-
-static uint32_t cs47l35_find_fll_gain(struct cs47l35_fll_cfg *cfg,
-                                      uint32_t fref,
-                                      const struct cs47l35_fll_gains *gains,
-                                      int32_t n_gains)
-{
-    int32_t i;
-
-    for (i = 0; i < n_gains; i++)
-    {
-        if (gains[i].min <= fref && fref <= gains[i].max)
-        {
-            cfg->gain = gains[i].gain;
-            cfg->alt_gain = gains[i].alt_gain;
-            return CS47L35_STATUS_OK;
-        }
-    }
-    return CS47L35_STATUS_FAIL;
-}
-
-static uint32_t gcd(uint32_t n1, uint32_t n2)
-{
-    while (n1 != n2)
-    {
-        if (n1 > n2)
-        {
-            n1 -= n2;
-        }
-        else
-        {
-            n2 -= n1;
-        }
-    }
-    return n1;
-}
-
-static uint32_t cs47l35_calc_fll(cs47l35_fll_t *fll,
-                                 struct cs47l35_fll_cfg *cfg,
-                                 uint32_t fref,
-                                 bool sync)
-{
-    uint32_t gcd_fll;
-    const struct cs47l35_fll_gains *gains;
-    int32_t n_gains;
-    int32_t ratio;
-    uint32_t ret;
-
-    /* Find an appropriate FLL_FRATIO and refdiv */
-    ratio = cs47l35_calc_fratio(fll, cfg, fref, sync);
-    if (ratio < 0)
-    {
-        return CS47L35_STATUS_FAIL;
-    }
-
-    /* Apply the division for our remaining calculations */
-    fref = fref / (1 << cfg->refdiv);
-
-    cfg->n = fll->fout / (ratio * fref);
-
-    if (fll->fout % (ratio * fref))
-    {
-        gcd_fll = gcd(fll->fout, ratio * fref);
-
-        cfg->theta = (fll->fout - (cfg->n * ratio * fref))/gcd_fll;
-        cfg->lambda = (ratio * fref) / gcd_fll;
-    }
-    else
-    {
-        cfg->theta = 0;
-        cfg->lambda = 0;
-    }
-
-    /*
-     * Round down to 16bit range with cost of accuracy lost.
-     * Denominator must be bigger than numerator so we only
-     * take care of it.
-     */
-    while (cfg->lambda >= (1 << 16)) {
-        cfg->theta >>= 1;
-        cfg->lambda >>= 1;
-    }
-
-    if (sync)
-    {
-        gains = cs47l35_fll_sync_gains;
-        n_gains = ARRAY_SIZE(cs47l35_fll_sync_gains);
-    }
-    else
-    {
-        gains = cs47l35_fll_main_gains;
-        n_gains = ARRAY_SIZE(cs47l35_fll_main_gains);
-    }
-
-    ret = cs47l35_find_fll_gain(cfg, fref, gains, n_gains);
-    if (ret == CS47L35_STATUS_FAIL)
-    {
-        return ret;
-    }
-
-    return CS47L35_STATUS_OK;
-}
-
 static uint32_t cs47l35_is_enabled_fll(cs47l35_t *driver, uint32_t base, bool *enabled)
 {
     uint32_t reg;
@@ -941,7 +945,7 @@ static uint32_t cs47l35_is_enabled_fll(cs47l35_t *driver, uint32_t base, bool *e
 
 static uint32_t cs47l35_set_fll_phase_integrator(cs47l35_t* driver,
                                                  cs47l35_fll_t *fll,
-                                                 struct cs47l35_fll_cfg *ref_cfg,
+                                                 fll_madera_cfg_t *ref_cfg,
                                                  bool sync)
 {
     uint32_t val, ret;
@@ -992,7 +996,7 @@ static int32_t cs47l35_apply_config_fll(cs47l35_t* driver, cs47l35_fll_t *fll)
     int32_t gain;
     uint32_t ret;
     bool already_enabled = false, sync_enabled = false;
-    struct cs47l35_fll_cfg ref_cfg;
+    fll_madera_cfg_t ref_cfg;
 
     ret = cs47l35_is_enabled_fll(driver, fll->base, &already_enabled);
     if (ret != CS47L35_STATUS_OK)
@@ -1006,7 +1010,7 @@ static int32_t cs47l35_apply_config_fll(cs47l35_t* driver, cs47l35_fll_t *fll)
         return CS47L35_STATUS_FAIL;
     }
 
-    if (fll->fout < CS47L35_FLL_MIN_FOUT || fll->fout > CS47L35_FLL_MAX_FOUT)
+    if (fll->fout < FLL_MADERA_MIN_FOUT || fll->fout > FLL_MADERA_MAX_FOUT)
     {
         cs47l35_disable_fll(driver, fll);
         return CS47L35_STATUS_FAIL;
@@ -1044,11 +1048,11 @@ static int32_t cs47l35_apply_config_fll(cs47l35_t* driver, cs47l35_fll_t *fll)
     /* Apply SYNCCLK setting */
     if (fll->sync_src >= 0)
     {
-        ret = cs47l35_calc_fll(fll, &ref_cfg, fll->sync_freq, true);
-        if (ret == CS47L35_STATUS_FAIL)
+        ret = fll_madera_calc(fll->sync_freq, fll->fout, true, &ref_cfg);
+        if (ret)
         {
             cs47l35_disable_fll(driver, fll);
-            return ret;
+            return CS47L35_STATUS_FAIL;
         }
 
         ret = cs47l35_write_fll(driver,
@@ -1065,11 +1069,11 @@ static int32_t cs47l35_apply_config_fll(cs47l35_t* driver, cs47l35_fll_t *fll)
     }
 
     /* Apply REFCLK setting */
-    ret = cs47l35_calc_fll(fll, &ref_cfg, fll->ref_freq, false);
-    if (ret == CS47L35_STATUS_FAIL)
+    ret = fll_madera_calc(fll->ref_freq, fll->fout, false, &ref_cfg);
+    if (ret)
     {
         cs47l35_disable_fll(driver, fll);
-        return ret;
+        return CS47L35_STATUS_FAIL;
     }
 
     /* Ref path hardcodes lambda to 65536 when sync is on */
@@ -1252,6 +1256,12 @@ uint32_t cs47l35_configure(cs47l35_t *driver, cs47l35_config_t *config)
     {
         driver->config = *config;
 
+        // Use the SPI clock speeds of the driver unless the BSP gives its own
+        if (driver->config.bsp_config.cp_config.spi_max_speed_hz == NULL)
+        {
+            driver->config.bsp_config.cp_config.spi_max_speed_hz = cs47l35_spi_max_speed_hz;
+        }
+
         ret = bsp_driver_if_g->register_gpio_cb(driver->config.bsp_config.bsp_int_gpio_id,
                                                 &cs47l35_irq_callback,
                                                 driver);
@@ -1343,6 +1353,12 @@ uint32_t cs47l35_reset(cs47l35_t *driver)
     uint32_t iter_timeout = 0;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
+    ret = regmap_set_clock_state(cp, BSP_CLOCK_STATE_RESET);
+    if (ret)
+    {
+        return CS47L35_STATUS_FAIL;
+    }
+
     // Drive RESET high
     bsp_driver_if_g->set_gpio(driver->config.bsp_config.bsp_reset_gpio_id, BSP_GPIO_LOW);
     bsp_driver_if_g->set_timer(2, NULL, NULL);
@@ -1371,6 +1387,12 @@ uint32_t cs47l35_reset(cs47l35_t *driver)
         }
     } while (!(temp_reg_val & CS47L35_BOOT_DONE_STS1_MASK));
 
+    ret = regmap_set_clock_state(cp, BSP_CLOCK_STATE_OTP_BOOT);
+    if (ret)
+    {
+        return CS47L35_STATUS_FAIL;
+    }
+
     // Read device ID and revision ID
     ret = cs47l35_read_reg(driver, CS47L35_SOFTWARE_RESET, &temp_reg_val);
     if (ret == CS47L35_STATUS_FAIL)
@@ -1417,6 +1439,7 @@ uint32_t cs47l35_reset(cs47l35_t *driver)
         }
     }
 
+    driver->fll_lock_pending = 0;
     driver->state = CS47L35_STATE_STANDBY;
 
     return CS47L35_STATUS_OK;
@@ -1515,6 +1538,131 @@ uint32_t cs47l35_boot(cs47l35_t *driver, uint32_t dsp_core, fw_img_info_t *fw_in
     return CS47L35_STATUS_OK;
 }
 
+/**
+ * Enable the memory of several DSP cores, then download and boot their fw_imgs
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] imgs             Array of fw_imgs, each boot_state with block_data set
+ * @param [in] img_count        Number of entries in imgs
+ *
+ * @return
+ * - CS47L35_STATUS_FAIL if:
+ *      - Any core listed is not disabled
+ *      - Control port activity fails
+ *      - Polling of RAM_RDY times out
+ *      - Any fw_img fails to process
+ * - CS47L35_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs47l35_boot_multi_process(cs47l35_t *driver, cs47l35_boot_img_t *imgs, uint32_t img_count)
+{
+    uint32_t ret, i;
+    uint32_t remaining = 0;
+    fw_img_boot_state_t *boot_state;
+
+    ret = cs47l35_power_mem_ena_multi(driver, imgs, img_count);
+    if (ret)
+    {
+        return ret;
+    }
+
+    for (i = 0; i < img_count; i++)
+    {
+        remaining |= 1 << i;
+    }
+
+    // Write one data block per core in turn until every fw_img is complete
+    while (remaining)
+    {
+        for (i = 0; i < img_count; i++)
+        {
+            if (!(remaining & (1 << i)))
+            {
+                continue;
+            }
+
+            boot_state = imgs[i].boot_state;
+
+            ret = fw_img_process(boot_state);
+            if (ret == FW_IMG_STATUS_DATA_READY)
+            {
+                ret = cs47l35_write_block(driver,
+                                          boot_state->block.block_addr,
+                                          boot_state->block_data,
+                                          boot_state->block.block_size);
+                if (ret)
+                {
+                    return CS47L35_STATUS_FAIL;
+                }
+            }
+            else if (ret == FW_IMG_STATUS_OK)
+            {
+                remaining &= ~(1 << i);
+
+                ret = cs47l35_boot(driver, imgs[i].dsp_core, &boot_state->fw_info);
+                if (ret)
+                {
+                    return ret;
+                }
+            }
+            else
+            {
+                return CS47L35_STATUS_FAIL;
+            }
+        }
+    }
+
+    return CS47L35_STATUS_OK;
+}
+
+/**
+ * Download and boot fw_imgs to several DSP cores
+ *
+ */
+uint32_t cs47l35_boot_multi(cs47l35_t *driver,
+                            cs47l35_boot_img_t *imgs,
+                            uint32_t img_count,
+                            uint8_t *block_data,
+                            uint32_t block_data_size)
+{
+    uint32_t ret, i;
+    uint32_t cores = 0;
+
+    if ((driver == NULL) || (imgs == NULL) || (block_data == NULL) || (img_count > CS47L35_NUM_DSP))
+    {
+        return CS47L35_STATUS_FAIL;
+    }
+
+    for (i = 0; i < img_count; i++)
+    {
+        if ((imgs[i].dsp_core > CS47L35_NUM_DSP) || (imgs[i].dsp_core == 0) || (imgs[i].boot_state == NULL) || \
+            (cores & (1 << imgs[i].dsp_core)))
+        {
+            return CS47L35_STATUS_FAIL;
+        }
+        cores |= 1 << imgs[i].dsp_core;
+    }
+
+    for (i = 0; i < img_count; i++)
+    {
+        // Any current firmware on this core is no longer available
+        cs47l35_boot(driver, imgs[i].dsp_core, NULL);
+
+        imgs[i].boot_state->block_data = block_data;
+        imgs[i].boot_state->block_data_size = block_data_size;
+    }
+
+    ret = cs47l35_boot_multi_process(driver, imgs, img_count);
+
+    // block_data belongs to the caller, so no boot_state may keep it, whether or not the boot succeeded
+    for (i = 0; i < img_count; i++)
+    {
+        imgs[i].boot_state->block_data = NULL;
+    }
+
+    return ret;
+}
+
 /**
  * Change the power state
  *
@@ -1675,41 +1823,109 @@ uint32_t cs47l35_fll_disable(cs47l35_t *driver, uint32_t fll_id)
         ret = CS47L35_STATUS_FAIL;
         break;
     }
+    // SYSCLK may have been running from this FLL
+    if (ret == CS47L35_STATUS_OK)
+    {
+        ret = cs47l35_update_clock_state(driver);
+    }
+
     return ret;
 }
 
+/**
+ * Enable an FLL and notify when it achieves lock
+ *
+ */
+uint32_t cs47l35_fll_enable_notify(cs47l35_t *driver, uint32_t fll_id)
+{
+    uint32_t ret;
+    uint32_t mask, sts;
+
+    if (fll_id >= CS47L35_NUM_FLL)
+    {
+        return CS47L35_STATUS_FAIL;
+    }
+
+    mask = cs47l35_fll_lock_data[fll_id].mask;
+
+    // Clear any stale lock event before unmasking
+    ret = cs47l35_write_reg(driver, CS47L35_IRQ1_STATUS_2, mask);
+    if (ret)
+    {
+        return ret;
+    }
+
+    driver->fll_lock_pending |= cs47l35_fll_lock_data[fll_id].event_flag;
+
+    ret = cs47l35_update_reg(driver, CS47L35_IRQ1_MASK_2, mask, 0);
+    if (ret)
+    {
+        return ret;
+    }
+
+    ret = cs47l35_fll_enable(driver, fll_id);
+    if (ret)
+    {
+        driver->fll_lock_pending &= ~cs47l35_fll_lock_data[fll_id].event_flag;
+        cs47l35_update_reg(driver, CS47L35_IRQ1_MASK_2, mask, mask);
+        return ret;
+    }
+
+    // If the FLL was already enabled and locked, no further lock event will occur, so have process() report it
+    ret = cs47l35_read_reg(driver, CS47L35_IRQ1_RAW_STATUS_2, &sts);
+    if (ret)
+    {
+        return ret;
+    }
+
+    if (sts & mask)
+    {
+        driver->mode = CS47L35_MODE_HANDLING_EVENTS;
+    }
+
+    return CS47L35_STATUS_OK;
+}
+
 /**
  * Wait for short time for an FLL to achieve lock
  *
  */
 uint32_t cs47l35_fll_wait_for_lock(cs47l35_t *driver, uint32_t fll_id)
 {
-    uint32_t i, mask, temp_reg_val, ret=CS47L35_STATUS_OK;
+    uint32_t ret, temp_reg_val;
+    uint32_t delay_ms = CS47L35_POLL_FLL_LOCK_MS_MIN;
+    uint32_t elapsed_ms = 0;
 
-    switch(fll_id)
+    if (fll_id >= CS47L35_NUM_FLL)
     {
-        case CS47L35_FLL1:
-            mask = CS47L35_FLL1_LOCK_STS1_MASK;
-            break;
-        default:
-            return CS47L35_STATUS_FAIL;
-            break;
+        return CS47L35_STATUS_FAIL;
     }
 
-    for (i = 0; i < 30; i++)
+    while (true)
     {
         ret = cs47l35_read_reg(driver, CS47L35_IRQ1_RAW_STATUS_2, &temp_reg_val);
         if (ret == CS47L35_STATUS_FAIL)
         {
             return ret;
         }
-        if (temp_reg_val & mask)
+        if (temp_reg_val & cs47l35_fll_lock_data[fll_id].mask)
         {
-            return CS47L35_STATUS_OK;
+            return cs47l35_update_clock_state(driver);
+        }
+        if (elapsed_ms >= CS47L35_POLL_FLL_LOCK_TIMEOUT_MS)
+        {
+            return CS47L35_STATUS_FAIL;
+        }
+
+        bsp_driver_if_g->set_timer(delay_ms, NULL, NULL);
+        elapsed_ms += delay_ms;
+
+        delay_ms *= 2;
+        if (delay_ms > CS47L35_POLL_FLL_LOCK_MS_MAX)
+        {
+            delay_ms = CS47L35_POLL_FLL_LOCK_MS_MAX;
         }
-        bsp_driver_if_g->set_timer(10, NULL, NULL);
     }
-    return CS47L35_STATUS_FAIL;
 }
 
 /*!
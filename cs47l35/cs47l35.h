@@ -121,6 +121,7 @@ extern "C" {
  *
  * @{
  */
+#define CS47L35_EVENT_FLAG_FLL1_LOCK                    (1 << 5)
 #define CS47L35_EVENT_FLAG_BOOT_DONE                    (1 << 4)
 #define CS47L35_EVENT_FLAG_DSP_ENCODER                  (1 << 3)
 #define CS47L35_EVENT_FLAG_DSP_DECODER                  (1 << 2)
@@ -272,6 +273,17 @@ typedef struct
     dsp_state_t state;                          ///< Current state of the ADSP2
 } cs47l35_dsp_t;
 
+/**
+ * fw_img to download to one DSP core
+ *
+ * @see cs47l35_boot_multi
+ */
+typedef struct
+{
+    uint32_t dsp_core;                          ///< The DSP core number.  1-based
+    fw_img_boot_state_t *boot_state;            ///< fw_img boot state, after fw_img_read_header on the complete fw_img
+} cs47l35_boot_img_t;
+
 /**
  * Data structure for FLL
  */
@@ -310,6 +322,7 @@ typedef struct
     cs47l35_dsp_t dsp_info[CS47L35_NUM_DSP];             ///< Current ADSP2 FW/Coefficient boot configuration
 
     cs47l35_fll_t fll[CS47L35_NUM_FLL];
+    uint32_t fll_lock_pending;                           ///< Lock event flags armed by cs47l35_fll_enable_notify
 } cs47l35_t;
 
 /**
@@ -438,6 +451,8 @@ uint32_t cs47l35_read_reg(cs47l35_t *driver, uint32_t addr, uint32_t *val);
 /*
  * Writes the contents of a single register/memory address
  *
+ * Writing CS47L35_SYSTEM_CLOCK_1 also sets the control port speed from the new SYSCLK configuration.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] addr             Address of the register to be written
  * @param [in] val              Value to be written to the register
@@ -445,6 +460,7 @@ uint32_t cs47l35_read_reg(cs47l35_t *driver, uint32_t addr, uint32_t *val);
  * @return
  * - CS47L35_STATUS_FAIL if:
  *      - Control port activity fails
+ *      - The BSP fails to change the control port speed
  * - otherwise, returns CS47L35_STATUS_OK
  *
  */
@@ -453,6 +469,8 @@ uint32_t cs47l35_write_reg(cs47l35_t *driver, uint32_t addr, uint32_t val);
 /*
  * Reads, updates and writes (if there's a change) the contents of a single register/memory address
  *
+ * Writing CS47L35_SYSTEM_CLOCK_1 also sets the control port speed from the new SYSCLK configuration.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] addr             Address of the register to be written
  * @param [in] mask             Mask of the bits within the register to update
@@ -461,6 +479,7 @@ uint32_t cs47l35_write_reg(cs47l35_t *driver, uint32_t addr, uint32_t val);
  * @return
  * - CS47L35_STATUS_FAIL if:
  *      - Control port activity fails
+ *      - The BSP fails to change the control port speed
  * - otherwise, returns CS47L35_STATUS_OK
  *
  */
@@ -561,6 +580,45 @@ uint32_t cs47l35_boot(cs47l35_t *driver, uint32_t dsp_core, fw_img_info_t *fw_in
  */
 uint32_t cs47l35_power(cs47l35_t *driver, uint32_t dsp_core, uint32_t power_state);
 
+/**
+ * Download and boot fw_imgs to several DSP cores
+ *
+ * Enables the memory of all cores listed in one pass, then interleaves fw_img processing and block writes across the
+ * cores, one data block per core in turn, so that all cores share a single block buffer.  Each core is finished with
+ * cs47l35_boot as soon as its fw_img is complete.
+ *
+ * Before the call, each boot_state must have:
+ * - fw_img_blocks and fw_img_blocks_size describing the complete fw_img, so that no data block is split between calls
+ *   to fw_img_process
+ * - been passed to fw_img_read_header
+ * - fw_info.sym_table and fw_info.alg_id_list allocated to the sizes in the fw_img header
+ *
+ * Every core listed must be disabled, i.e. powered down with CS47L35_POWER_MEM_DIS if it was running.  Each
+ * boot_state must remain valid for as long as the firmware is in use, since the driver keeps a pointer to its fw_info.
+ * block_data is only used during the call, and every boot_state->block_data is NULL on return.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] imgs             Array of fw_imgs, at most one per DSP core
+ * @param [in] img_count        Number of entries in imgs, at most CS47L35_NUM_DSP
+ * @param [in] block_data       Block buffer shared by all cores
+ * @param [in] block_data_size  Size of block_data in bytes, at least the max_block_size of every fw_img
+ *
+ * @return
+ * - CS47L35_STATUS_FAIL if:
+ *      - Any pointers are null, or any DSP core is invalid or repeated
+ *      - Any DSP core is not disabled
+ *      - Control port activity fails
+ *      - Polling of RAM_RDY times out
+ *      - Any fw_img is incomplete, has a block larger than block_data_size, or fails its checksum
+ * - CS47L35_STATUS_OK          otherwise
+ *
+ */
+uint32_t cs47l35_boot_multi(cs47l35_t *driver,
+                            cs47l35_boot_img_t *imgs,
+                            uint32_t img_count,
+                            uint8_t *block_data,
+                            uint32_t block_data_size);
+
 
 /**
  * Configure a susbsystem on an FLL
@@ -613,9 +671,31 @@ uint32_t cs47l35_fll_enable(cs47l35_t *driver, uint32_t fll_id);
  */
 uint32_t cs47l35_fll_disable(cs47l35_t *driver, uint32_t fll_id);
 
+/**
+ * Enable an FLL and notify when it achieves lock
+ *
+ * Unmasks the lock interrupt of the FLL and enables it, without waiting for lock.  When the FLL locks, the
+ * corresponding CS47L35_EVENT_FLAG_xxx_LOCK is passed to the notification callback from cs47l35_process, and the lock
+ * interrupt is masked again.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] fll_id           FLL Id to be enabled.
+ *
+ * @return
+ * - CS47L35_STATUS_FAIL        if requested FLL is invalid, or if any control port transaction fails
+ * - CS47L35_STATUS_OK          otherwise
+ *
+ * @see CS47L35_EVENT_FLAG_
+ *
+ */
+uint32_t cs47l35_fll_enable_notify(cs47l35_t *driver, uint32_t fll_id);
+
 /**
  * Wait a short time for the FLL to reach a locked state
  *
+ * The lock status is polled at intervals starting at 1ms and doubling up to 10ms, so a fast lock is seen without a
+ * full polling period of latency.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] fll_id           FLL Id to achieve lock
  *
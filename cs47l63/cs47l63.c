@@ -24,6 +24,7 @@
  **********************************************************************************************************************/
 #include <stddef.h>
 #include "cs47l63.h"
+#include "fll.h"
 #include "bsp_driver_if.h"
 #include "string.h"
 
@@ -39,6 +40,15 @@
  */
 #define CS47L63_POLL_ACK_CTRL_MS                (10)    ///< Delay in ms between polling ACK controls
 #define CS47L63_POLL_ACK_CTRL_MAX               (10)    ///< Maximum number of times to poll ACK controls
+#define CS47L63_POLL_FLL_LOCK_MS_MIN            (1)     ///< Initial delay in ms between polling FLL lock status
+#define CS47L63_POLL_FLL_LOCK_MS_MAX            (10)    ///< Maximum delay in ms between polling FLL lock status
+#define CS47L63_POLL_FLL_LOCK_TIMEOUT_MS        (300)   ///< Total time in ms to poll FLL lock status
+
+#define CS47L63_SPI_MAX_CLOCK_HZ_NO_SYSCLK     (6000000)   ///< Fastest SPI clock until an FLL is locked
+#define CS47L63_SPI_MAX_CLOCK_HZ_SYSCLK        (25000000)  ///< Fastest SPI clock with SYSCLK running from an FLL
+
+#define CS47L63_SYSCLK_SRC_FLL1                (0x4)       ///< SYSCLK_SRC for FLL1
+#define CS47L63_SYSCLK_SRC_FLL2                (0x5)       ///< SYSCLK_SRC for FLL2
 /** @} */
 
 /**
@@ -73,20 +83,6 @@ typedef struct
 /**
  * FLL defines
  */
-#define CS47L63_FLLHJ_INT_MAX_N             (1023)
-#define CS47L63_FLLHJ_INT_MIN_N             (1)
-#define CS47L63_FLLHJ_FRAC_MAX_N            (255)
-#define CS47L63_FLLHJ_FRAC_MIN_N            (2)
-#define CS47L63_FLLHJ_LP_INT_MODE_THRESH    (100000)
-#define CS47L63_FLLHJ_LOW_THRESH            (192000)
-#define CS47L63_FLLHJ_MID_THRESH            (1152000)
-#define CS47L63_FLLHJ_MAX_THRESH            (13000000)
-#define CS47L63_FLLHJ_LOW_GAINS             (0x23f0)
-#define CS47L63_FLLHJ_MID_GAINS             (0x22f2)
-#define CS47L63_FLLHJ_HIGH_GAINS            (0x21f0)
-#define CS47L63_FLL_MAX_FOUT                (50000000)
-#define CS47L63_FLL_MAX_REFDIV              (8)
-
 #define CS47L63_FLL_CONTROL1_OFFS           (0x00)
 #define CS47L63_FLL_CONTROL2_OFFS           (0x04)
 #define CS47L63_FLL_CONTROL3_OFFS           (0x08)
@@ -156,6 +152,45 @@ const irq_reg_t cs47l63_event_data[] =
  */
 #define N_IRQ_REGS  ((sizeof(cs47l63_event_data)) / (sizeof(irq_reg_t)))
 
+/**
+ * Number of registers from CS47L63_IRQ1_EINT_1 covering all irq_reg_offset in the CS47L63 interrupt regs structure
+ *
+ * @see cs47l63_event_handler
+ */
+#define CS47L63_IRQ1_EINT_SNAPSHOT_WORDS    (((CS47L63_IRQ1_EINT_9 - CS47L63_IRQ1_EINT_1) >> 2) + 1)
+
+/**
+ * FLL lock rising edge interrupt bits, indexed by FLL Id
+ *
+ * The mask is the same for the CS47L63_IRQ1_EINT_6 and CS47L63_IRQ1_MASK_6 registers.
+ *
+ * @see cs47l63_fll_enable_notify
+ */
+static const struct
+{
+    uint32_t mask;
+    uint32_t event_flag;
+    uint32_t sysclk_src;                    ///< SYSCLK_SRC value selecting this FLL
+} cs47l63_fll_lock_data[CS47L63_NUM_FLL] =
+{
+    {CS47L63_FLL1_LOCK_RISE_EINT1_MASK, CS47L63_EVENT_FLAG_FLL1_LOCK, CS47L63_SYSCLK_SRC_FLL1},
+    {CS47L63_FLL2_LOCK_RISE_EINT1_MASK, CS47L63_EVENT_FLAG_FLL2_LOCK, CS47L63_SYSCLK_SRC_FLL2},
+};
+
+/**
+ * Default fastest SPI clock in each power/clocking state, used unless the BSP gives its own in
+ * cp_config.spi_max_speed_hz
+ *
+ * @see regmap_set_clock_state
+ */
+static const uint32_t cs47l63_spi_max_speed_hz[BSP_CLOCK_STATE_TOTAL] =
+{
+    [BSP_CLOCK_STATE_RESET] = CS47L63_SPI_MAX_CLOCK_HZ_NO_SYSCLK,
+    [BSP_CLOCK_STATE_OTP_BOOT] = CS47L63_SPI_MAX_CLOCK_HZ_NO_SYSCLK,
+    [BSP_CLOCK_STATE_PLL_LOCKED] = CS47L63_SPI_MAX_CLOCK_HZ_SYSCLK,
+    [BSP_CLOCK_STATE_HIBERNATE] = CS47L63_SPI_MAX_CLOCK_HZ_NO_SYSCLK,
+};
+
 /***********************************************************************************************************************
  * LOCAL FUNCTIONS
  **********************************************************************************************************************/
@@ -292,6 +327,57 @@ uint32_t cs47l63_read_reg(cs47l63_t *driver, uint32_t addr, uint32_t *val)
     return CS47L63_STATUS_OK;
 }
 
+/**
+ * Report the clocking state to the BSP from the SYSCLK configuration
+ *
+ * The control port only runs at CS47L63_SPI_MAX_CLOCK_HZ_SYSCLK while SYSCLK is enabled and sourced from a locked FLL,
+ * so both are read back, rather than assumed from an FLL locking or being disabled.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS47L63_STATUS_FAIL        if control port activity fails, or if the BSP fails to change the SPI clock
+ * - CS47L63_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs47l63_update_clock_state(cs47l63_t *driver)
+{
+    uint32_t ret;
+    uint32_t sysclk, sysclk_src, sts;
+    uint32_t state = BSP_CLOCK_STATE_OTP_BOOT;
+
+    ret = cs47l63_read_reg(driver, CS47L63_SYSTEM_CLOCK1, &sysclk);
+    if (ret)
+    {
+        return ret;
+    }
+
+    sysclk_src = (sysclk & CS47L63_SYSCLK_SRC_MASK) >> CS47L63_SYSCLK_SRC_SHIFT;
+    if (sysclk & CS47L63_SYSCLK_EN_MASK)
+    {
+        ret = cs47l63_read_reg(driver, CS47L63_IRQ1_STS_6, &sts);
+        if (ret)
+        {
+            return ret;
+        }
+
+        for (uint32_t i = 0; i < CS47L63_NUM_FLL; i++)
+        {
+            if ((sysclk_src == cs47l63_fll_lock_data[i].sysclk_src) && (sts & driver->fll[i].sts_mask))
+            {
+                state = BSP_CLOCK_STATE_PLL_LOCKED;
+            }
+        }
+    }
+
+    if (regmap_set_clock_state(REGMAP_GET_CP(driver), state))
+    {
+        return CS47L63_STATUS_FAIL;
+    }
+
+    return CS47L63_STATUS_OK;
+}
+
 /**
  * Writes the contents of a single register/memory address
  *
@@ -317,6 +403,12 @@ uint32_t cs47l63_write_reg(cs47l63_t *driver, uint32_t addr, uint32_t val)
         return CS47L63_STATUS_FAIL;
     }
 
+    // The SPI clock follows SYSCLK being enabled, disabled or changing source
+    if (addr == CS47L63_SYSTEM_CLOCK1)
+    {
+        return cs47l63_update_clock_state(driver);
+    }
+
     return CS47L63_STATUS_OK;
 }
 
@@ -331,6 +423,12 @@ uint32_t cs47l63_update_reg(cs47l63_t *driver, uint32_t addr, uint32_t mask, uin
         return CS47L63_STATUS_FAIL;
     }
 
+    // The SPI clock follows SYSCLK being enabled, disabled or changing source
+    if (addr == CS47L63_SYSTEM_CLOCK1)
+    {
+        return cs47l63_update_clock_state(driver);
+    }
+
     return CS47L63_STATUS_OK;
 }
 
@@ -627,6 +725,67 @@ static uint32_t cs47l63_power_mem_dis(cs47l63_t *driver, cs47l63_dsp_t *dsp_info
     return CS47L63_STATUS_OK;
 }
 
+/**
+ * Handle lock events of FLLs armed by cs47l63_fll_enable_notify
+ *
+ * The lock status is checked rather than the edge-triggered interrupt flag, so a lock achieved before the interrupt
+ * was unmasked is still reported.  Each FLL is reported once, after which its lock interrupt is masked.
+ *
+ * @param [in] driver           Pointer to the driver state
+ *
+ * @return
+ * - CS47L63_STATUS_FAIL        Control port activity fails
+ * - CS47L63_STATUS_OK          otherwise
+ *
+ */
+static uint32_t cs47l63_fll_lock_handler(cs47l63_t *driver)
+{
+    uint32_t ret;
+    uint32_t sts;
+    uint32_t locked = 0;
+
+    if (!driver->fll_lock_pending)
+    {
+        return CS47L63_STATUS_OK;
+    }
+
+    // Both FLLs report lock status in CS47L63_IRQ1_STS_6
+    ret = cs47l63_read_reg(driver, CS47L63_IRQ1_STS_6, &sts);
+    if (ret)
+    {
+        return ret;
+    }
+
+    for (uint32_t i = 0; i < CS47L63_NUM_FLL; i++)
+    {
+        if ((driver->fll_lock_pending & cs47l63_fll_lock_data[i].event_flag) && (sts & driver->fll[i].sts_mask))
+        {
+            driver->event_flags |= cs47l63_fll_lock_data[i].event_flag;
+            driver->fll_lock_pending &= ~cs47l63_fll_lock_data[i].event_flag;
+            locked |= cs47l63_fll_lock_data[i].mask;
+        }
+    }
+
+    if (locked)
+    {
+        ret = cs47l63_update_clock_state(driver);
+        if (ret)
+        {
+            return ret;
+        }
+
+        ret = cs47l63_update_reg(driver, CS47L63_IRQ1_MASK_6, locked, locked);
+        if (ret)
+        {
+            return ret;
+        }
+
+        ret = cs47l63_write_reg(driver, CS47L63_IRQ1_EINT_6, locked);
+    }
+
+    return ret;
+}
+
 /**
  * Handle events indicated by the IRQ pin ALERTb
  *
@@ -646,34 +805,54 @@ static uint32_t cs47l63_power_mem_dis(cs47l63_t *driver, cs47l63_dsp_t *dsp_info
 static uint32_t cs47l63_event_handler(cs47l63_t *driver)
 {
     uint32_t ret;
-    uint32_t temp_reg_val;
-    uint32_t old_reg = 0;
-    uint32_t new_reg;
+    uint32_t irq_statuses[CS47L63_IRQ1_EINT_SNAPSHOT_WORDS];
+    uint32_t flags_to_clear[CS47L63_IRQ1_EINT_SNAPSHOT_WORDS] = {0};
+    uint32_t read_mask = 0;
+    uint32_t clear_mask = 0;
+    regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
+
+    // Only access the IRQ1 registers that have events, as the range includes unused register addresses
+    for (uint32_t i = 0; i < N_IRQ_REGS; i++)
+    {
+        read_mask |= (1 << (cs47l63_event_data[i].irq_reg_offset >> 2));
+    }
+
+    // Snapshot all IRQ1 flag registers
+    ret = regmap_read_words_masked(cp,
+                                   CS47L63_IRQ1_EINT_1,
+                                   irq_statuses,
+                                   CS47L63_IRQ1_EINT_SNAPSHOT_WORDS,
+                                   read_mask);
+    if (ret)
+    {
+        return CS47L63_STATUS_FAIL;
+    }
 
     driver->event_flags = 0;
     for (uint32_t i = 0; i < N_IRQ_REGS; i++)
     {
-        new_reg = CS47L63_IRQ1_EINT_1 + cs47l63_event_data[i].irq_reg_offset;
-        if (old_reg != new_reg)
-        {
-            ret = cs47l63_read_reg(driver, new_reg, &temp_reg_val);
-            if (ret != CS47L63_STATUS_OK)
-            {
-                return CS47L63_STATUS_FAIL;
-            }
-        }
-        old_reg = new_reg;
+        uint32_t index = cs47l63_event_data[i].irq_reg_offset >> 2;
 
-        if (temp_reg_val & cs47l63_event_data[i].mask)
+        if (irq_statuses[index] & cs47l63_event_data[i].mask)
         {
             driver->event_flags |= cs47l63_event_data[i].event_flag;
-            ret = cs47l63_write_reg(driver,
-                                    CS47L63_IRQ1_EINT_1 + cs47l63_event_data[i].irq_reg_offset,
-                                    cs47l63_event_data[i].mask);
+            flags_to_clear[index] |= cs47l63_event_data[i].mask;
+            clear_mask |= (1 << index);
         }
     }
 
-    return CS47L63_STATUS_OK;
+    // Clear all handled IRQ1 flags
+    ret = regmap_write_words_masked(cp,
+                                    CS47L63_IRQ1_EINT_1,
+                                    flags_to_clear,
+                                    CS47L63_IRQ1_EINT_SNAPSHOT_WORDS,
+                                    clear_mask);
+    if (ret)
+    {
+        return CS47L63_STATUS_FAIL;
+    }
+
+    return cs47l63_fll_lock_handler(driver);
 }
 
 
@@ -692,12 +871,12 @@ static uint32_t cs47l63_fll_validate(cs47l63_fll_t *fll,
         return CS47L63_STATUS_FAIL;
     }
 
-    if (fin / CS47L63_FLL_MAX_REFDIV > CS47L63_FLLHJ_MAX_THRESH)
+    if (fin / FLL_HJ_MAX_REFDIV > FLL_HJ_MAX_THRESH)
     {
         return CS47L63_STATUS_FAIL;
     }
 
-    if (fout > CS47L63_FLL_MAX_FOUT)
+    if (fout > FLL_HJ_MAX_FOUT)
     {
         return CS47L63_STATUS_FAIL;
     }
@@ -720,116 +899,13 @@ static bool cs47l63_fll_int_osc_is_used(cs47l63_t *driver)
     return is_used;
 }
 
-static uint32_t gcd(uint32_t n1, uint32_t n2)
-{
-    while (n1 != n2)
-    {
-        if (n1 > n2)
-        {
-            n1 -= n2;
-        }
-        else
-        {
-            n2 -= n1;
-        }
-    }
-    return n1;
-}
-
 static uint32_t cs47l63_fll_do_config(cs47l63_t *driver, cs47l63_fll_t *fll)
 {
-    int32_t refdiv, fref, fout, lockdet_thr, fllgcd;
-    bool frac = false;
-    uint32_t fll_n, min_n, max_n, ratio, theta, lambda, hp, fbdiv;
-    uint32_t gains, num;
+    fll_hj_cfg_t cfg;
     uint32_t ret;
-    uint32_t fin=fll->ref_freq;
 
-    for (refdiv = 0; refdiv < 4; refdiv++)
-    {
-        if ((fin / (1 << refdiv)) <= CS47L63_FLLHJ_MAX_THRESH)
-        {
-            break;
-        }
-    }
-
-    fref = fin / (1 << refdiv);
-    fout = fll->fout;
-    frac = fout % fref;
-
-    // Calc fb_div according to fref and whether frac mode
-    if (fref < CS47L63_FLLHJ_LOW_THRESH)
-    {
-        lockdet_thr = 2;
-        gains = CS47L63_FLLHJ_LOW_GAINS;
-        fbdiv = (frac) ? 256 : 4;
-    }
-    else if (fref < CS47L63_FLLHJ_MID_THRESH)
-    {
-        lockdet_thr = 8;
-        gains = CS47L63_FLLHJ_MID_GAINS;
-        fbdiv = (frac) ? 16 : 2;
-    }
-    else
-    {
-        lockdet_thr = 8;
-        gains = CS47L63_FLLHJ_HIGH_GAINS;
-        fbdiv = 1;
-    }
-
-    // Use high performance mode for fractional configurations
-    if (frac)
-    {
-        hp = 0x3;
-        min_n = CS47L63_FLLHJ_FRAC_MIN_N;
-        max_n = CS47L63_FLLHJ_FRAC_MAX_N;
-    }
-    else
-    {
-        if (fref < CS47L63_FLLHJ_LP_INT_MODE_THRESH)
-        {
-            hp = 0x0;
-        }
-        else
-        {
-            hp = 0x1;
-        }
-        min_n = CS47L63_FLLHJ_INT_MIN_N;
-        max_n = CS47L63_FLLHJ_INT_MAX_N;
-    }
-
-    ratio = fout / fref;
-
-    while (ratio / fbdiv < min_n)
-    {
-        fbdiv /= 2;
-        if (fbdiv < min_n)
-        {
-            return CS47L63_STATUS_FAIL;
-        }
-    }
-    while (frac && (ratio / fbdiv > max_n))
-    {
-        fbdiv *= 2;
-        if (fbdiv >= 1024)
-        {
-            return CS47L63_STATUS_FAIL;
-        }
-    }
-
-    // Calc N.K, theta, lambda
-    fllgcd = gcd(fout, fbdiv * fref);
-    num = fout / fllgcd;
-    lambda = (fref * fbdiv) / fllgcd;
-    fll_n = num / lambda;
-    theta = num % lambda;
-
-    // Some sanity checks before any registers are written
-    if (fll_n < min_n || fll_n > max_n)
-    {
-        return CS47L63_STATUS_FAIL;
-    }
-    if (fbdiv < 1 || (frac && fbdiv >= 1024) || (!frac && fbdiv >= 256))
+    ret = fll_hj_calc(fll->ref_freq, fll->fout, &cfg);
+    if (ret)
     {
         return CS47L63_STATUS_FAIL;
     }
@@ -841,10 +917,10 @@ static uint32_t cs47l63_fll_do_config(cs47l63_t *driver, cs47l63_fll_t *fll)
                              CS47L63_FLL1_PHASEDET_MASK |
                              CS47L63_FLL1_REFCLK_DIV_MASK |
                              CS47L63_FLL1_N_MASK,
-                             (lockdet_thr << CS47L63_FLL1_LOCKDET_THR_SHIFT) |
+                             (cfg.lockdet_thr << CS47L63_FLL1_LOCKDET_THR_SHIFT) |
                              (1 << CS47L63_FLL1_PHASEDET_SHIFT) |
-                             (refdiv << CS47L63_FLL1_REFCLK_DIV_SHIFT) |
-                             (fll_n << CS47L63_FLL1_N_SHIFT));
+                             (cfg.refdiv << CS47L63_FLL1_REFCLK_DIV_SHIFT) |
+                             (cfg.n << CS47L63_FLL1_N_SHIFT));
     if (ret == CS47L63_STATUS_FAIL)
     {
         return ret;
@@ -853,8 +929,8 @@ static uint32_t cs47l63_fll_do_config(cs47l63_t *driver, cs47l63_fll_t *fll)
     // Write lambda, theta to CTRL3
     ret = cs47l63_write_reg(driver,
                             fll->base + CS47L63_FLL_CONTROL3_OFFS,
-                            (lambda << CS47L63_FLL1_LAMBDA_SHIFT) |
-                            (theta << CS47L63_FLL1_THETA_SHIFT));
+                            (cfg.lambda << CS47L63_FLL1_LAMBDA_SHIFT) |
+                            (cfg.theta << CS47L63_FLL1_THETA_SHIFT));
     if (ret == CS47L63_STATUS_FAIL)
     {
         return ret;
@@ -866,9 +942,9 @@ static uint32_t cs47l63_fll_do_config(cs47l63_t *driver, cs47l63_fll_t *fll)
                              (0xffff << CS47L63_FLL1_FD_GAIN_COARSE_SHIFT) |
                              CS47L63_FLL1_HP_MASK |
                              CS47L63_FLL1_FB_DIV_MASK,
-                             (gains << CS47L63_FLL1_FD_GAIN_COARSE_SHIFT) |
-                             (hp << CS47L63_FLL1_HP_SHIFT) |
-                             (fbdiv << CS47L63_FLL1_FB_DIV_SHIFT));
+                             (cfg.gains << CS47L63_FLL1_FD_GAIN_COARSE_SHIFT) |
+                             (cfg.hp << CS47L63_FLL1_HP_SHIFT) |
+                             (cfg.fbdiv << CS47L63_FLL1_FB_DIV_SHIFT));
     if (ret == CS47L63_STATUS_FAIL)
     {
         return ret;
@@ -1149,6 +1225,12 @@ uint32_t cs47l63_configure(cs47l63_t *driver, cs47l63_config_t *config)
     {
         driver->config = *config;
 
+        // Use the SPI clock speeds of the driver unless the BSP gives its own
+        if (driver->config.bsp_config.cp_config.spi_max_speed_hz == NULL)
+        {
+            driver->config.bsp_config.cp_config.spi_max_speed_hz = cs47l63_spi_max_speed_hz;
+        }
+
         ret = bsp_driver_if_g->register_gpio_cb(driver->config.bsp_config.bsp_int_gpio_id,
                                                 &cs47l63_irq_callback,
                                                 driver);
@@ -1241,6 +1323,12 @@ uint32_t cs47l63_reset(cs47l63_t *driver)
     uint32_t iter_timeout = 0;
     regmap_cp_config_t *cp = REGMAP_GET_CP(driver);
 
+    ret = regmap_set_clock_state(cp, BSP_CLOCK_STATE_RESET);
+    if (ret)
+    {
+        return CS47L63_STATUS_FAIL;
+    }
+
     // Drive RESET low
     bsp_driver_if_g->set_gpio(driver->config.bsp_config.bsp_reset_gpio_id, BSP_GPIO_LOW);
     bsp_driver_if_g->set_timer(2, NULL, NULL);
@@ -1271,6 +1359,12 @@ uint32_t cs47l63_reset(cs47l63_t *driver)
         }
     } while ((temp_reg_val & CS47L63_BOOT_DONE_EINT1_MASK) == 0);
 
+    ret = regmap_set_clock_state(cp, BSP_CLOCK_STATE_OTP_BOOT);
+    if (ret)
+    {
+        return CS47L63_STATUS_FAIL;
+    }
+
     // Read device ID and revision ID
     ret = cs47l63_read_reg(driver, CS47L63_DEVID, &temp_reg_val);
     if (ret != CS47L63_STATUS_OK)
@@ -1321,6 +1415,7 @@ uint32_t cs47l63_reset(cs47l63_t *driver)
         }
     }
 
+    driver->fll_lock_pending = 0;
     driver->state = CS47L63_STATE_STANDBY;
 
     return CS47L63_STATUS_OK;
@@ -1662,23 +1757,85 @@ uint32_t cs47l63_fll_disable(cs47l63_t *driver, uint32_t fll_id)
                              CS47L63_FLL1_REFCLK_SRC_MASK,
                              CS47L63_FLL_SRC_NO_INPUT << CS47L63_FLL1_REFCLK_SRC_SHIFT);
 
+    // SYSCLK may have been running from this FLL
+    if (ret == CS47L63_STATUS_OK)
+    {
+        ret = cs47l63_update_clock_state(driver);
+    }
+
     return ret;
 }
 
+/**
+ * Enable an FLL and notify when it achieves lock
+ *
+ */
+uint32_t cs47l63_fll_enable_notify(cs47l63_t *driver, uint32_t fll_id)
+{
+    uint32_t ret;
+    uint32_t mask, sts;
+
+    if (fll_id >= CS47L63_NUM_FLL)
+    {
+        return CS47L63_STATUS_FAIL;
+    }
+
+    mask = cs47l63_fll_lock_data[fll_id].mask;
+
+    // Clear any stale lock event before unmasking
+    ret = cs47l63_write_reg(driver, CS47L63_IRQ1_EINT_6, mask);
+    if (ret)
+    {
+        return ret;
+    }
+
+    driver->fll_lock_pending |= cs47l63_fll_lock_data[fll_id].event_flag;
+
+    ret = cs47l63_update_reg(driver, CS47L63_IRQ1_MASK_6, mask, 0);
+    if (ret)
+    {
+        return ret;
+    }
+
+    ret = cs47l63_fll_enable(driver, fll_id);
+    if (ret)
+    {
+        driver->fll_lock_pending &= ~cs47l63_fll_lock_data[fll_id].event_flag;
+        cs47l63_update_reg(driver, CS47L63_IRQ1_MASK_6, mask, mask);
+        return ret;
+    }
+
+    // If the FLL was already enabled and locked, no rising edge will occur, so have process() report it
+    ret = cs47l63_read_reg(driver, driver->fll[fll_id].sts_addr, &sts);
+    if (ret)
+    {
+        return ret;
+    }
+
+    if (sts & driver->fll[fll_id].sts_mask)
+    {
+        driver->mode = CS47L63_MODE_HANDLING_EVENTS;
+    }
+
+    return CS47L63_STATUS_OK;
+}
+
 /**
  * Wait a short period for FLL to achieve lock
  *
  */
 uint32_t cs47l63_fll_wait_for_lock(cs47l63_t *driver, uint32_t fll_id)
 {
-    uint32_t ret, i, val=0;
+    uint32_t ret, val = 0;
+    uint32_t delay_ms = CS47L63_POLL_FLL_LOCK_MS_MIN;
+    uint32_t elapsed_ms = 0;
 
     if (fll_id >= CS47L63_NUM_FLL)
     {
         return CS47L63_STATUS_FAIL;
     }
 
-    for (i = 0; i < 30; i++)
+    while (true)
     {
         ret = cs47l63_read_reg(driver, driver->fll[fll_id].sts_addr, &val);
         if (ret != CS47L63_STATUS_OK)
@@ -1688,11 +1845,22 @@ uint32_t cs47l63_fll_wait_for_lock(cs47l63_t *driver, uint32_t fll_id)
 
         if (val & driver->fll[fll_id].sts_mask)
         {
-            return CS47L63_STATUS_OK;
+            return cs47l63_update_clock_state(driver);
+        }
+        if (elapsed_ms >= CS47L63_POLL_FLL_LOCK_TIMEOUT_MS)
+        {
+            return CS47L63_STATUS_FAIL;
+        }
+
+        bsp_driver_if_g->set_timer(delay_ms, NULL, NULL);
+        elapsed_ms += delay_ms;
+
+        delay_ms *= 2;
+        if (delay_ms > CS47L63_POLL_FLL_LOCK_MS_MAX)
+        {
+            delay_ms = CS47L63_POLL_FLL_LOCK_MS_MAX;
         }
-        bsp_driver_if_g->set_timer(10, NULL, NULL);
     }
-    return CS47L63_STATUS_FAIL;
 }
 
 /*!
@@ -122,6 +122,8 @@ extern "C" {
 #define CS47L63_EVENT_FLAG_WDT_EXPIRE                   (1 << 6)
 #define CS47L63_EVENT_FLAG_AHB_SYS_ERR                  (1 << 7)
 #define CS47L63_EVENT_FLAG_AHB_PACK_ERR                 (1 << 8)
+#define CS47L63_EVENT_FLAG_FLL1_LOCK                    (1 << 9)
+#define CS47L63_EVENT_FLAG_FLL2_LOCK                    (1 << 10)
 /** @} */
 
 #define CS47L63_NUM_DSP                                 (1)
@@ -306,6 +308,7 @@ typedef struct
     cs47l63_dsp_t dsp_info[CS47L63_NUM_DSP];             ///< Current ADSP2 FW/Coefficient boot configuration
 
     cs47l63_fll_t fll[CS47L63_NUM_FLL];                  ///< FLL configurations
+    uint32_t fll_lock_pending;                           ///< Lock event flags armed by cs47l63_fll_enable_notify
 } cs47l63_t;
 
 /**
@@ -435,6 +438,8 @@ uint32_t cs47l63_read_reg(cs47l63_t *driver, uint32_t addr, uint32_t *val);
 /*
  * Writes the contents of a single register/memory address
  *
+ * Writing CS47L63_SYSTEM_CLOCK1 also sets the control port speed from the new SYSCLK configuration.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] addr             Address of the register to be written
  * @param [in] val              Value to be written to the register
@@ -442,6 +447,7 @@ uint32_t cs47l63_read_reg(cs47l63_t *driver, uint32_t addr, uint32_t *val);
  * @return
  * - CS47L63_STATUS_FAIL if:
  *      - Control port activity fails
+ *      - The BSP fails to change the control port speed
  * - otherwise, returns CS47L63_STATUS_OK
  *
  */
@@ -450,6 +456,8 @@ uint32_t cs47l63_write_reg(cs47l63_t *driver, uint32_t addr, uint32_t val);
 /*
  * Reads, updates and writes (if there's a change) the contents of a single register/memory address
  *
+ * Writing CS47L63_SYSTEM_CLOCK1 also sets the control port speed from the new SYSCLK configuration.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] addr             Address of the register to be written
  * @param [in] mask             Mask of the bits within the register to update
@@ -458,6 +466,7 @@ uint32_t cs47l63_write_reg(cs47l63_t *driver, uint32_t addr, uint32_t val);
  * @return
  * - CS47L63_STATUS_FAIL if:
  *      - Control port activity fails
+ *      - The BSP fails to change the control port speed
  * - otherwise, returns CS47L63_STATUS_OK
  *
  */
@@ -617,15 +626,37 @@ uint32_t cs47l63_fll_enable(cs47l63_t *driver, uint32_t fll_id);
  */
 uint32_t cs47l63_fll_disable(cs47l63_t *driver, uint32_t fll_id);
 
+/**
+ * Enable an FLL and notify when it achieves lock
+ *
+ * Unmasks the lock interrupt of the FLL and enables it, without waiting for lock.  When the FLL locks, the
+ * corresponding CS47L63_EVENT_FLAG_FLLx_LOCK is passed to the notification callback from cs47l63_process, and the
+ * lock interrupt is masked again.
+ *
+ * @param [in] driver           Pointer to the driver state
+ * @param [in] fll_id           FLL Id to be enabled.
+ *
+ * @return
+ * - CS47L63_STATUS_FAIL        if requested FLL is invalid, or if any control port transaction fails
+ * - CS47L63_STATUS_OK          otherwise
+ *
+ * @see CS47L63_EVENT_FLAG_
+ *
+ */
+uint32_t cs47l63_fll_enable_notify(cs47l63_t *driver, uint32_t fll_id);
+
 /**
  * Wait a short time for the FLL to reach a locked state
  *
+ * The lock status is polled at intervals starting at 1ms and doubling up to 10ms, so a fast lock is seen without a
+ * full polling period of latency.
+ *
  * @param [in] driver           Pointer to the driver state
  * @param [in] fll_id           FLL Id to achieve lock
  *
  * @return
- * - CS47L15_STATUS_FAIL        if requested FLL is invalid or a locked state is not reached
- * - CS47L15_STATUS_OK          otherwise
+ * - CS47L63_STATUS_FAIL        if requested FLL is invalid or a locked state is not reached
+ * - CS47L63_STATUS_OK          otherwise
  *
  */
 uint32_t cs47l63_fll_wait_for_lock(cs47l63_t *driver, uint32_t fll_id);
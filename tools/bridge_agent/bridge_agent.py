@@ -28,7 +28,12 @@ import os
 import signal
 
 # Bridge to Alt-OS MCU internal message protocol version
-BRIDGE_MCU_MSG_FORMAT = "0.1"
+# From 0.2, the MCU replies to Read, BlockRead, Detect and Batch in binary. MCUs that only support 0.1 reply in ASCII.
+# From 0.3, BlockWrite is streamed to the MCU. MCUs that only support 0.2 use BWs/BWc/BWe.
+BRIDGE_MCU_MSG_FORMAT = "0.3"
+BRIDGE_MCU_MSG_FORMAT_BINARY = "0.2"
+BRIDGE_MCU_MSG_FORMAT_ASCII = "0.1"
+BRIDGE_MCU_MSG_FORMAT_MINOR = 3
 
 CLIENT_PORT = 22349
 SOCK_RX_BYTES = 2048
@@ -59,6 +64,7 @@ cmd_mcu_abbreviated = {
     "SM"                :"SM",
     "ServiceAvailable"  :"SA",
     "Shutdown"          :"SD",
+    "Batch"             :"BA",
     "IntBridgeMcuMsgVersion":"IV"
 }
 
@@ -87,7 +93,11 @@ cmd_mcu_opcodes = {
     "SM"                    :0xd,   # ServiceMessage
     "SA"                    :0xe,   # ServiceAvailable
     "SD"                    :0xf,   # Shutdown
-    "IntBridgeMcuMsgVersion":0x10
+    "IntBridgeMcuMsgVersion":0x10,
+    "Batch"                 :0x11,
+    "BA"                    :0x11,
+    "BWS"                   :0x12,  # BlockWrite stream start
+    "BWSd"                  :0x13   # BlockWrite stream data
 }
 
 cmds_with_numerical_args = ["R", "Read", "BlockRead", "BR", "W", "Write", "BlockWrite", "BW"]
@@ -95,6 +105,28 @@ cmds_with_numerical_args = ["R", "Read", "BlockRead", "BR", "W", "Write", "Block
 no_arg_abbrv_cmds = ["CD", "IN", "DT", "DV", "DC", "SM", "SA", "SD"]
 
 ERROR_REPLY = "ER"
+
+# Client actions the MCU replies to in binary, in msg format 0.2
+binary_reply_actions = ["R", "Read", "BR", "BlockRead", "Detect", "Batch"]
+# Binary reply fields: | Reply length (including itself) | Status | Data ... |
+BINARY_REPLY_STATUS_OFFSET = 2
+BINARY_REPLY_DATA_OFFSET = 3
+BINARY_REPLY_STATUS_OK = 0
+# Detect reply bus types
+binary_detect_bus_names = ["I2C", "SPI"]
+# Batch op types
+BATCH_OP_READ = 0
+BATCH_OP_WRITE = 1
+BATCH_MAX_OPS = 255
+# Batch payloads must fit the MCU's command buffer (MSG_RX_LEN in common/bridge/bridge.c)
+BATCH_MAX_PAYLOAD_BYTES = 1600
+# Errors the agent replies with itself, for Batch cmds it can't send
+WMT_INVALID_COMMAND = "1E"
+WMT_UNSUPPORTED = "33"
+# BlockWrite stream start reply data: | Window bytes | Max chunk bytes |
+BWS_REPLY_WINDOW_OFFSET = 0
+BWS_REPLY_MAX_CHUNK_OFFSET = 2
+BWS_DATA_HEADER_LENGTH = 3
 DEFAULT_NUM_CHIPS = 1
 
 BRIDGE_STATE_HANDSHAKE_GET_CD                   = 0
@@ -121,6 +153,9 @@ wisce_device_id = "unknown"
 devices = dict()  # No device details discovered yet
 num_chips = DEFAULT_NUM_CHIPS
 verbose = False
+binary_replies = False
+stream_block_writes = False
+binary_rx_pending = b''
 
 PAYLOAD_BYTE_LENGTH = 2
 # Define how binary data should be sent in payload of smcio packets
@@ -262,24 +297,26 @@ def payload_length_bytes(payload_len):
 # Current Command object
 #=========================================================================
 class current_command(object):
-    recvd_cmd_b = b''   # ToDo could make these instance vars
-    seq_num = None
-    device_name = ""
-    action = ""
-    arg1 = None
-    arg2 = None
+    def __init__(self):
+        self.recvd_cmd_b = b''
+        self.seq_num = None
+        self.device_name = ""
+        self.action = ""
+        self.arg1 = None
+        self.arg2 = None
+        self.batch_ops = []
 
     def get_all_bytes(self):
-        return self.__class__.recvd_cmd_b
+        return self.recvd_cmd_b
 
     def get_all_str(self):
-        return str(self.__class__.recvd_cmd_b, 'UTF-8')
+        return str(self.recvd_cmd_b, 'UTF-8')
 
     def get_action_str(self):
-        return self.__class__.action
+        return self.action
 
     def new_cmd(self, cmd_b):
-        self.__class__.recvd_cmd_b = cmd_b
+        self.recvd_cmd_b = cmd_b
         '''Incoming cmd from client can be of the form
         1. "[<deviceName>:<SeqNum>] Read <reg>" or "[<deviceName>:<SeqNum>] BlockRead <starReg> <numBytes>"
         2. "[<deviceName>:<SeqNum>] Write <reg> <val>" or "[<deviceName>:<SeqNum>] BlockWrite <StartReg> <data>"
@@ -292,42 +329,68 @@ class current_command(object):
         9. "Info"
         10."ProtocolVersion 105"
         11. "[SeqNum] <command>"
+        12. "[<deviceName>:<SeqNum>] Batch R <reg> W <reg> <val> R <reg> ..."
         '''
-        self.__class__.seq_num = None
+        self.seq_num = None
         parts = str(cmd_b, 'UTF-8').split()
         if '[' in parts[0]:
             # Cmd has seq num part
             part1 = parts[0]
             if ':' in part1:
                 # Eg "[CS47L63-1:2] R c08"
-                self.__class__.device_name = part1[1: part1.find(':')]
-                self.__class__.seq_num = part1[part1.find(':') + 1: part1.find(']')]
+                self.device_name = part1[1: part1.find(':')]
+                self.seq_num = part1[part1.find(':') + 1: part1.find(']')]
             else:
                 # Eg "[4] Detect" or "[4]  Read <reg>"
-                self.__class__.device_name = None
-                self.__class__.seq_num = part1[part1.find('[') + 1: part1.find(']')]
+                self.device_name = None
+                self.seq_num = part1[part1.find('[') + 1: part1.find(']')]
             parts.pop(0)
-        self.__class__.action = parts[0]
-        if len(parts) == 1:
-            self.__class__.arg1 = None
-            self.__class__.arg2 = None
+        self.action = parts[0]
+        self.batch_ops = []
+        if self.action == "Batch":
+            self.arg1 = None
+            self.arg2 = None
+            self.batch_ops = parse_batch_ops(parts[1:], cmd_b)
+        elif len(parts) == 1:
+            self.arg1 = None
+            self.arg2 = None
         elif len(parts) == 2:
-            self.__class__.arg1 = parts[1]
-            self.__class__.arg2 = None
-            if self.__class__.action in cmds_with_numerical_args:
-                self.__class__.arg1 = str(int(self.__class__.arg1, 16))
+            self.arg1 = parts[1]
+            self.arg2 = None
+            if self.action in cmds_with_numerical_args:
+                self.arg1 = str(int(self.arg1, 16))
         elif len(parts) == 3:
-            self.__class__.arg1 = parts[1]
-            self.__class__.arg2 = parts[2]
-            if self.__class__.action in cmds_with_numerical_args:
-                self.__class__.arg1 = str(int(self.__class__.arg1, 16))
-                self.__class__.arg2 = str(int(self.__class__.arg2, 16))
+            self.arg1 = parts[1]
+            self.arg2 = parts[2]
+            if self.action in cmds_with_numerical_args:
+                self.arg1 = str(int(self.arg1, 16))
+                self.arg2 = str(int(self.arg2, 16))
         else:
             raise bridge_excpn("Unexpected Cmd format received: {}".format(cmd_b))
-        if self.__class__.action not in cmd_mcu_abbreviated:
+        if self.action not in cmd_mcu_abbreviated:
             raise bridge_excpn("Unexpected Cmd action received: {}".format(cmd_b))
 
 
+def parse_batch_ops(parts, cmd_b):
+    '''Returns the ops of a Batch cmd as a list of (addr,) for reads and (addr, value) for writes'''
+    ops = []
+    i = 0
+    try:
+        while i < len(parts):
+            if parts[i] in ["R", "Read"]:
+                ops.append((int(parts[i + 1], 16),))
+                i += 2
+            elif parts[i] in ["W", "Write"]:
+                ops.append((int(parts[i + 1], 16), int(parts[i + 2], 16)))
+                i += 3
+            else:
+                raise ValueError
+    except (IndexError, ValueError):
+        raise bridge_excpn("Unexpected Batch op format received: {}".format(cmd_b))
+    if len(ops) == 0 or len(ops) > BATCH_MAX_OPS:
+        raise bridge_excpn("Unexpected Batch op count received: {}".format(cmd_b))
+    return ops
+
 def hexstr_to_decstr(hexstr):
     if hexstr is not None and len(hexstr):
         return str(int(hexstr, 16))
@@ -445,15 +508,100 @@ def send_bw_data_to_mcu_binary(crnt_cmd, chip_id, ser_ch, ch_num, state, verbose
         raise blockwrite_chunk_excpn("Unknown error during Block Write operation between Agent and Device")
 
 
+#==========================================================================
+# Stream block-write cmd data to device, for msg format 0.3
+#=========================================================================
+def block_write_stream_start_payload(chip_id, addr, length):
+    bin_payload = bytearray()
+    bin_payload += payload_length_bytes(12)
+    bin_payload.append(cmd_mcu_opcodes["BWS"])
+    bin_payload.append(chip_id)
+    bin_payload += addr.to_bytes(4, PAYLOAD_BINARY_ENDIANNESS)
+    bin_payload += length.to_bytes(4, PAYLOAD_BINARY_ENDIANNESS)
+    return bin_payload
+
+def block_write_stream_data_payload(chunk):
+    bin_payload = bytearray()
+    bin_payload += payload_length_bytes(len(chunk) + BWS_DATA_HEADER_LENGTH)
+    bin_payload.append(cmd_mcu_opcodes["BWSd"])
+    bin_payload += chunk
+    return bin_payload
+
+def block_write_stream_window(mcu_reply_b, user_num_reg_in_chunk):
+    '''Returns (window, chunk_bytes) from a BlockWrite stream start reply'''
+    data = mcu_reply_b[BINARY_REPLY_DATA_OFFSET:]
+    window = int.from_bytes(data[BWS_REPLY_WINDOW_OFFSET:BWS_REPLY_WINDOW_OFFSET + 2], PAYLOAD_BINARY_ENDIANNESS)
+    max_chunk = int.from_bytes(data[BWS_REPLY_MAX_CHUNK_OFFSET:BWS_REPLY_MAX_CHUNK_OFFSET + 2],
+                               PAYLOAD_BINARY_ENDIANNESS)
+    # Whole registers only, and at least one chunk must fit in the window
+    chunk_bytes = min(user_num_reg_in_chunk * 4, max_chunk, window - BWS_DATA_HEADER_LENGTH) & ~3
+    return (window, chunk_bytes)
+
+def send_bw_data_to_mcu_stream(crnt_cmd, chip_id, ser_ch, ch_num, verbose, user_num_reg_in_chunk):
+    '''Send a BlockWrite as a stream of chunks, returning the client response.
+    Chunks are sent back-to-back while the payloads of the chunks not yet replied to fit in the window advertised by
+    the MCU, so the UART round trip is only paid once per window rather than once per chunk.
+    '''
+    if crnt_cmd.arg1 is None or crnt_cmd.arg2 is None:
+        raise blockwrite_chunk_excpn("BlockWrite cmd has no addr and/or data")
+    if chip_id is None:
+        raise missing_chip_id_excpn("BWS chip Id is None")
+
+    cmd_str = crnt_cmd.get_all_str()
+    data_str = cmd_str.split()[-1]
+    if len(data_str) == 0 or len(data_str) % 8 != 0:
+        raise blockwrite_chunk_excpn("BlockWrite cmd data is invalid")
+    # NB: The MCU regmap block-write fn needs an array of byte data in big endian
+    data_b = bytes.fromhex(data_str)
+
+    ser_ch.write_channel_bytes(ch_num, block_write_stream_start_payload(chip_id, int(crnt_cmd.arg1), len(data_b)))
+
+    mcu_reply_b = wait_for_serial_data_binary(ser_ch, ch_num)
+    status = mcu_reply_b[BINARY_REPLY_STATUS_OFFSET]
+    if status != BINARY_REPLY_STATUS_OK:
+        return prepend_seq_num(crnt_cmd, "Error {:X}\n".format(status))
+    (window, chunk_bytes) = block_write_stream_window(mcu_reply_b, user_num_reg_in_chunk)
+    dbg_pr_general(verbose, "Agent state BWS: window {} bytes, {} byte chunks".format(window, chunk_bytes))
+
+    data_indx = 0
+    in_flight = []
+    while data_indx < len(data_b) or len(in_flight):
+        chunk = data_b[data_indx:data_indx + chunk_bytes]
+        if len(chunk) and (status == BINARY_REPLY_STATUS_OK) and \
+           (sum(in_flight) + len(chunk) + BWS_DATA_HEADER_LENGTH <= window):
+            bin_payload = block_write_stream_data_payload(chunk)
+            dbg_pr_AgentMsgToDevice(verbose, chunk.hex())
+            ser_ch.write_channel_bytes(ch_num, bin_payload)
+            in_flight.append(len(bin_payload))
+            data_indx += len(chunk)
+        else:
+            # Window full, or nothing more to send, so wait for a chunk to be acknowledged
+            mcu_reply_b = wait_for_serial_data_binary(ser_ch, ch_num)
+            in_flight.pop(0)
+            if status == BINARY_REPLY_STATUS_OK:
+                status = mcu_reply_b[BINARY_REPLY_STATUS_OFFSET]
+            if status != BINARY_REPLY_STATUS_OK:
+                # Stop sending, but collect the replies to chunks already sent
+                data_indx = len(data_b)
+
+    if status != BINARY_REPLY_STATUS_OK:
+        return prepend_seq_num(crnt_cmd, "Error {:X}\n".format(status))
+    return prepend_seq_num(crnt_cmd, "Ok\n")
+
+
 #==========================================================================
 # Command Handler Function
 #=========================================================================
 
 # Creates binary fields according to cmd type and writes to serial channel
+# Returns the client response if the cmd has already been completed, otherwise None
 def client_cmd_handler_binary(crnt_cmd, ser_ch, ch_num, state, verbose, user_num_reg_in_chunk):
     # Switch on cmd type
     abbr_action_str = cmd_mcu_abbreviated[crnt_cmd.get_action_str()]
-    if abbr_action_str == "BW":
+    if abbr_action_str == "BW" and stream_block_writes:
+        return send_bw_data_to_mcu_stream(crnt_cmd, devices[crnt_cmd.device_name]["chip_id"],
+                                          ser_ch, ch_num, verbose, user_num_reg_in_chunk)
+    elif abbr_action_str == "BW":
         try:
             send_bw_data_to_mcu_binary(crnt_cmd, devices[crnt_cmd.device_name]["chip_id"],
                                        ser_ch, ch_num, state, verbose, user_num_reg_in_chunk)
@@ -529,9 +677,21 @@ def client_cmd_handler_binary(crnt_cmd, ser_ch, ch_num, state, verbose, user_num
         bin_payload += read_len.to_bytes(2, PAYLOAD_BINARY_ENDIANNESS)
         # Write binary payload to serial channel
         ser_ch.write_channel_bytes(ch_num, bin_payload)
+    elif abbr_action_str == "BA":
+        # Batch is only handled by MCUs with binary replies, and all its ops address the cmd's device
+        if not binary_replies:
+            return prepend_seq_num(crnt_cmd, "Error {}\n".format(WMT_UNSUPPORTED))
+        chip_id = devices[crnt_cmd.device_name]["chip_id"]
+        bin_payload = batch_payload([(chip_id,) + op for op in crnt_cmd.batch_ops])
+        if len(bin_payload) > BATCH_MAX_PAYLOAD_BYTES:
+            return prepend_seq_num(crnt_cmd, "Error {}\n".format(WMT_INVALID_COMMAND))
+        # Write binary payload to serial channel
+        ser_ch.write_channel_bytes(ch_num, bin_payload)
     else:
         raise Exception("Unknown abbr_action_str: {}".format(abbr_action_str))
 
+    return None
+
 
 def new_send_internal_CD_binary(ser_ch, ch_num):
     bin_payload = bytearray()
@@ -543,12 +703,31 @@ def new_send_internal_CD_binary(ser_ch, ch_num):
 
 def send_internal_bridge_mcu_protocol_version(ser_ch, ch_num):
     bin_payload = bytearray()
-    payload_len = 3
+    payload_len = 4
     bin_payload += payload_len.to_bytes(PAYLOAD_BYTE_LENGTH, PAYLOAD_BINARY_ENDIANNESS)
     # Add OpCode
     bin_payload.append(cmd_mcu_opcodes["IntBridgeMcuMsgVersion"])
+    # Request our msg format. MCUs that only support 0.1 ignore this and reply "0.1"
+    bin_payload.append(BRIDGE_MCU_MSG_FORMAT_MINOR)
     ser_ch.write_channel_bytes(ch_num, bin_payload)
 
+def batch_payload(ops):
+    '''Create a Batch cmd payload, for msg format 0.2.
+    ops is a list of (chip_id, addr) for reads and (chip_id, addr, value) for writes, for up to 255 ops.
+    '''
+    bin_payload = bytearray()
+    bin_payload += bytes(PAYLOAD_BYTE_LENGTH)
+    bin_payload.append(cmd_mcu_opcodes["Batch"])
+    bin_payload.append(len(ops))
+    for op in ops:
+        bin_payload.append(BATCH_OP_WRITE if len(op) == 3 else BATCH_OP_READ)
+        bin_payload.append(op[0])
+        bin_payload += op[1].to_bytes(4, PAYLOAD_BINARY_ENDIANNESS)
+        if len(op) == 3:
+            bin_payload += op[2].to_bytes(4, PAYLOAD_BINARY_ENDIANNESS)
+    bin_payload[:PAYLOAD_BYTE_LENGTH] = payload_length_bytes(len(bin_payload))
+    return bin_payload
+
 def send_internal_IN_binary(ser_ch, ch_num):
     bin_payload = bytearray()
     payload_len = 3
@@ -613,6 +792,53 @@ def mcu_reply_hndlr_detect(mcu_detect_reply_s):
     # Formulate reply to client
     return (reply_str[:-1] + '\n')
 
+def parse_batch_reply(reply_b):
+    '''Returns (status, num_ops_done, read_values) from a binary Batch reply'''
+    status = reply_b[BINARY_REPLY_STATUS_OFFSET]
+    data = reply_b[BINARY_REPLY_DATA_OFFSET:]
+    if len(data) == 0:
+        return (status, 0, [])
+    values = [int.from_bytes(data[i:i + 4], PAYLOAD_BINARY_ENDIANNESS) for i in range(1, len(data) - 3, 4)]
+    return (status, data[0], values)
+
+def binary_detect_to_str(data):
+    # Convert a binary Detect reply to the msg format 0.1 ASCII reply
+    parts = []
+    i = 1
+    for _ in range(data[0]):
+        bus_type, bus_addr, drvr_ctrl, name_len = data[i], data[i + 1], data[i + 2], data[i + 3]
+        i += 4
+        name = data[i:i + name_len].decode('latin-1')
+        i += name_len
+        id_len = data[i]
+        id_str = data[i + 1:i + 1 + id_len].decode('latin-1')
+        i += 1 + id_len
+        parts.append("{},{},{:x},{},{}".format(name, binary_detect_bus_names[bus_type], bus_addr,
+                                               "true" if drvr_ctrl else "false", id_str))
+    return ':'.join(parts)
+
+def binary_reply_handler(current_cmd, mcu_reply_b):
+    status = mcu_reply_b[BINARY_REPLY_STATUS_OFFSET]
+    data = mcu_reply_b[BINARY_REPLY_DATA_OFFSET:]
+    if status != BINARY_REPLY_STATUS_OK:
+        return prepend_seq_num(current_cmd, "Error {:X}\n".format(status))
+
+    cli_rsp_str = None
+    if current_cmd.action == "Detect":
+        cli_rsp_str = mcu_reply_hndlr_detect(binary_detect_to_str(data))
+    elif current_cmd.action == "R" or current_cmd.action == "Read":
+        cli_rsp_str = hex(int.from_bytes(data[:4], PAYLOAD_BINARY_ENDIANNESS)) + "\n"
+    elif current_cmd.action == "BR" or current_cmd.action == "BlockRead":
+        cli_rsp_str = data.hex().upper() + "\n"
+    elif current_cmd.action == "Batch":
+        # One value per Read op, in op order, or Ok if there were only Write ops
+        (status, num_ops_done, values) = parse_batch_reply(mcu_reply_b)
+        if num_ops_done != len(current_cmd.batch_ops):
+            return prepend_seq_num(current_cmd, "Error {}\n".format(WMT_INVALID_COMMAND))
+        cli_rsp_str = (" ".join(hex(v) for v in values) if len(values) else "Ok") + "\n"
+
+    return prepend_seq_num(current_cmd, cli_rsp_str)
+
 def prepend_seq_num(current_cmd, cli_rsp_str):
     if current_cmd.seq_num is not None:
         cli_rsp_str = "[{}] {}".format(current_cmd.seq_num, cli_rsp_str)
@@ -701,9 +927,25 @@ def wait_for_serial_data(ser_ch, ch_num):
         data_str = data_str + data_tmp
     return data_str
 
+def wait_for_serial_data_binary(ser_ch, ch_num):
+    # Binary replies start with their length, including the length field, so read until all of it has arrived
+    # Streamed block writes can have several replies in one read, so anything after the reply is kept for next time
+    global binary_rx_pending
+    data_b = binary_rx_pending
+    while (len(data_b) < PAYLOAD_BYTE_LENGTH) or \
+          (len(data_b) < int.from_bytes(data_b[:PAYLOAD_BYTE_LENGTH], PAYLOAD_BINARY_ENDIANNESS)):
+        data_tmp = ''
+        while data_tmp == '':
+            data_tmp = ser_ch.read_channel(ch_num)
+        # smcio maps each payload byte to a char
+        data_b += data_tmp.encode('latin-1')
+    reply_len = int.from_bytes(data_b[:PAYLOAD_BYTE_LENGTH], PAYLOAD_BINARY_ENDIANNESS)
+    binary_rx_pending = data_b[reply_len:]
+    return data_b[:reply_len]
+
 
 def inner_loop(sock, ser_ch, ch_num, state, crnt_cmd, verbose, user_num_reg_in_chunk):
-    global wisce_device_id
+    global wisce_device_id, binary_replies, stream_block_writes, binary_rx_pending
     while True:
         try:
             dbg_pr_general(verbose, "Loop state: {}".format(state))
@@ -726,7 +968,14 @@ def inner_loop(sock, ser_ch, ch_num, state, crnt_cmd, verbose, user_num_reg_in_c
                 reply = wait_for_serial_data(ser_ch, ch_num)
                 dbg_pr_DeviceMsgToAgent(verbose, reply)
                 bridge_mcu_msg_format = reply[:-1]
-                if bridge_mcu_msg_format != BRIDGE_MCU_MSG_FORMAT:
+                binary_replies = bridge_mcu_msg_format in [BRIDGE_MCU_MSG_FORMAT, BRIDGE_MCU_MSG_FORMAT_BINARY]
+                stream_block_writes = (bridge_mcu_msg_format == BRIDGE_MCU_MSG_FORMAT)
+                binary_rx_pending = b''
+                if bridge_mcu_msg_format == BRIDGE_MCU_MSG_FORMAT_ASCII:
+                    print("MCU msg format version {}, using ASCII replies".format(bridge_mcu_msg_format))
+                elif bridge_mcu_msg_format == BRIDGE_MCU_MSG_FORMAT_BINARY:
+                    print("MCU msg format version {}, using BWs/BWc/BWe block writes".format(bridge_mcu_msg_format))
+                elif bridge_mcu_msg_format != BRIDGE_MCU_MSG_FORMAT:
                     print("\n*WARNING* Bridge and MCU internal message formats are different")
                     print("Bridge message version: {}. MCU reports message version: {}".format(
                         BRIDGE_MCU_MSG_FORMAT, bridge_mcu_msg_format))
@@ -758,14 +1007,24 @@ def inner_loop(sock, ser_ch, ch_num, state, crnt_cmd, verbose, user_num_reg_in_c
                     raise bridge_sock_excpn("No command received. Remote end may have terminated connection")
                 crnt_cmd.new_cmd(cli_cmd_b)
                 dbg_pr_ClientMsg(verbose, crnt_cmd.get_all_str())
-                client_cmd_handler_binary(crnt_cmd, ser_ch, ch_num, state, verbose, user_num_reg_in_chunk)
-                state = BRIDGE_STATE_WAIT_MCU_REPLY
+                client_resp_s = client_cmd_handler_binary(crnt_cmd, ser_ch, ch_num, state, verbose,
+                                                          user_num_reg_in_chunk)
+                if client_resp_s is not None:
+                    dbg_pr_AgentMsgToClient(verbose, client_resp_s)
+                    socket_send(sock, client_resp_s.encode())
+                else:
+                    state = BRIDGE_STATE_WAIT_MCU_REPLY
             elif state == BRIDGE_STATE_WAIT_MCU_REPLY:
                 dbg_pr_general(verbose, "Waiting for reply from device")
-                mcu_reply = wait_for_serial_data(ser_ch, ch_num)
-                dbg_pr_DeviceMsgToAgent(verbose, mcu_reply)
-                mcu_reply = mcu_reply[:-1]
-                client_resp_s = reply_handler(crnt_cmd, mcu_reply)
+                if binary_replies and (crnt_cmd.action in binary_reply_actions):
+                    mcu_reply_b = wait_for_serial_data_binary(ser_ch, ch_num)
+                    dbg_pr_general(verbose, "Device reply: {} -> Agent".format(mcu_reply_b.hex()))
+                    client_resp_s = binary_reply_handler(crnt_cmd, mcu_reply_b)
+                else:
+                    mcu_reply = wait_for_serial_data(ser_ch, ch_num)
+                    dbg_pr_DeviceMsgToAgent(verbose, mcu_reply)
+                    mcu_reply = mcu_reply[:-1]
+                    client_resp_s = reply_handler(crnt_cmd, mcu_reply)
                 dbg_pr_AgentMsgToClient(verbose, client_resp_s)
                 socket_send(sock, client_resp_s.encode())
                 state = BRIDGE_STATE_WAIT_CLI_CMD
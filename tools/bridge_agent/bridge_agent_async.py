@@ -0,0 +1,442 @@
+#!/usr/bin/python
+#==========================================================================
+# (c) 2022 Cirrus Logic, Inc.
+#--------------------------------------------------------------------------
+# Project : StudioBridge Server serving several clients over one UART
+# File    : bridge_agent_async.py
+#--------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#--------------------------------------------------------------------------
+#
+# Environment Requirements: Python 3.7 or later
+#
+#==========================================================================
+'''asyncio version of bridge_agent.outer_loop(), which accepts any number of WISCE/SCS/scripting clients at once.
+
+The MCU handles commands one at a time and replies in order, so the commands of all clients are tagged and
+queued on the serial channel, and each reply is matched to the oldest command still waiting.  Up to pipeline_depth
+commands are sent before the first reply arrives, limited so that the commands waiting fit in the MCU receive
+buffer.  Each client's commands are sent in the order received and answered in that order.
+
+Block writes hold the serial channel until they complete, since the MCU keeps block write state between commands.
+
+Run with --loopback to use loopback_mcu in place of the MCU, and --benchmark to time clients against it.
+'''
+
+#==========================================================================
+# IMPORTS
+#==========================================================================
+import argparse
+import asyncio
+import collections
+import sys
+import threading
+import time
+import bridge_agent
+from bridge_agent import cmd_mcu_abbreviated, cmd_mcu_opcodes, dbg_pr_general, prepend_seq_num
+
+#==========================================================================
+# CONSTANTS/GLOBALS
+#==========================================================================
+DEFAULT_PIPELINE_DEPTH = 4
+# Bytes of commands that may be waiting at the MCU, as BRIDGE_STREAM_WINDOW_BYTES
+DEFAULT_PIPELINE_WINDOW_BYTES = 1024
+
+REPLY_TEXT = 0
+REPLY_BINARY = 1
+
+WMT_INVALID_COMMAND = "1E"
+WMT_NO_DEVICE = "36"
+
+#==========================================================================
+# CLASSES
+#==========================================================================
+class payload_capture(object):
+    '''Stands in for the serial channel to collect the payloads made by bridge_agent'''
+    def __init__(self):
+        self.payloads = []
+
+    def write_channel_bytes(self, ch_num, payload):
+        self.payloads.append(bytes(payload))
+
+class mcu_link(object):
+    '''Pipelined access to the MCU over the bridge serial channel'''
+    def __init__(self, ser_ch, ch_num, pipeline_depth, window, verbose):
+        self.ser_ch = ser_ch
+        self.ch_num = ch_num
+        self.pipeline_depth = pipeline_depth
+        self.window = window
+        self.verbose = verbose
+        self.loop = None
+        # Commands sent and waiting for a reply, oldest first, as (tag, reply kind, future, payload length)
+        self.pending = collections.deque()
+        self.pending_bytes = 0
+        self.rx_b = b''
+        self.next_tag = 0
+        self.issue_lock = None
+        self.space = None
+
+    def start(self):
+        self.loop = asyncio.get_running_loop()
+        self.issue_lock = asyncio.Lock()
+        self.space = asyncio.Event()
+        # smcio reads block, so wait for them on a thread
+        threading.Thread(target=self.rx_thread, daemon=True).start()
+
+    def rx_thread(self):
+        while True:
+            data_s = self.ser_ch.read_channel(self.ch_num)
+            if data_s:
+                self.loop.call_soon_threadsafe(self.on_rx, data_s.encode('latin-1'))
+
+    def on_rx(self, data_b):
+        self.rx_b += data_b
+        while len(self.pending):
+            (tag, kind, fut, payload_len) = self.pending[0]
+            if kind == REPLY_BINARY:
+                if len(self.rx_b) < bridge_agent.PAYLOAD_BYTE_LENGTH:
+                    break
+                reply_len = int.from_bytes(self.rx_b[:bridge_agent.PAYLOAD_BYTE_LENGTH],
+                                           bridge_agent.PAYLOAD_BINARY_ENDIANNESS)
+                if len(self.rx_b) < reply_len:
+                    break
+                reply = self.rx_b[:reply_len]
+            else:
+                reply_len = self.rx_b.find(b'\n') + 1
+                if reply_len == 0:
+                    break
+                reply = self.rx_b[:reply_len - 1].decode('latin-1')
+            self.rx_b = self.rx_b[reply_len:]
+            self.pending.popleft()
+            self.pending_bytes -= payload_len
+            dbg_pr_general(self.verbose, "Device reply to tag {}: {} -> Agent".format(tag, reply))
+            if not fut.done():
+                fut.set_result(reply)
+            self.space.set()
+
+    async def wait_for_space(self, payload_len, window):
+        while len(self.pending) and ((len(self.pending) >= self.pipeline_depth) or
+                                     (self.pending_bytes + payload_len > window)):
+            self.space.clear()
+            await self.space.wait()
+
+    async def issue(self, payload, kind, window=None):
+        '''Send a command once there is room for it, returning a future for its reply.
+        The caller must hold issue_lock, so that commands are sent in the order they are issued.
+        '''
+        if window is None:
+            window = self.window
+        await self.wait_for_space(len(payload), window)
+        fut = self.loop.create_future()
+        self.pending.append((self.next_tag, kind, fut, len(payload)))
+        self.pending_bytes += len(payload)
+        dbg_pr_general(self.verbose, "Device <- tag {}: {} Agent relay Command".format(self.next_tag, payload.hex()))
+        self.next_tag += 1
+        self.ser_ch.write_channel_bytes(self.ch_num, bytearray(payload))
+        return fut
+
+    async def request(self, payload, kind):
+        async with self.issue_lock:
+            return await self.issue(payload, kind)
+
+    async def drain(self):
+        while len(self.pending):
+            self.space.clear()
+            await self.space.wait()
+
+class bridge_server(object):
+    def __init__(self, link, verbose, user_num_reg_in_chunk):
+        self.link = link
+        self.verbose = verbose
+        self.user_num_reg_in_chunk = user_num_reg_in_chunk
+        self.greeting = ""
+        self.num_clients = 0
+        self.num_connected = 0
+
+    async def handshake(self):
+        '''Run the handshake of bridge_agent.inner_loop() once, for all clients, and Detect the devices'''
+        capture = payload_capture()
+        bridge_agent.new_send_internal_CD_binary(capture, None)
+        bridge_agent.wisce_device_id = await (await self.link.request(capture.payloads[-1], REPLY_TEXT))
+        print("wisce_device_id is {}".format(bridge_agent.wisce_device_id))
+
+        bridge_agent.send_internal_bridge_mcu_protocol_version(capture, None)
+        msg_format = await (await self.link.request(capture.payloads[-1], REPLY_TEXT))
+        bridge_agent.binary_replies = msg_format in [bridge_agent.BRIDGE_MCU_MSG_FORMAT,
+                                                     bridge_agent.BRIDGE_MCU_MSG_FORMAT_BINARY]
+        bridge_agent.stream_block_writes = (msg_format == bridge_agent.BRIDGE_MCU_MSG_FORMAT)
+        print("MCU msg format version {}".format(msg_format))
+
+        bridge_agent.send_internal_IN_binary(capture, None)
+        reply = await (await self.link.request(capture.payloads[-1], REPLY_TEXT))
+        dev, app, version, protver, systemid, _os, osversion = \
+            bridge_agent.mcu_reply_hndlr_info(reply.split(','), True)
+        self.greeting = "StudioBridge UART Version {}\n(c) Cirrus Logic\n{}\n".format(protver, dev)
+
+        # Detect up front, so that every client can address every device without sending Detect itself
+        detect_cmd = bridge_agent.current_command()
+        detect_cmd.new_cmd(b"Detect")
+        await (await self.submit(detect_cmd))
+
+    async def submit(self, crnt_cmd):
+        '''Send a client command to the MCU, returning a future for the client response'''
+        abbr_action_str = cmd_mcu_abbreviated[crnt_cmd.get_action_str()]
+        if abbr_action_str == "BW":
+            # The client's next command must not be sent before the block write
+            return completed(await self.block_write(crnt_cmd))
+
+        capture = payload_capture()
+        client_resp_s = bridge_agent.client_cmd_handler_binary(crnt_cmd, capture, None, None, self.verbose,
+                                                               self.user_num_reg_in_chunk)
+        if client_resp_s is not None:
+            # The agent replied without sending anything to the MCU
+            return completed(client_resp_s)
+        if bridge_agent.binary_replies and (crnt_cmd.action in bridge_agent.binary_reply_actions):
+            fut = await self.link.request(capture.payloads[0], REPLY_BINARY)
+            return asyncio.ensure_future(self.binary_response(crnt_cmd, fut))
+        fut = await self.link.request(capture.payloads[0], REPLY_TEXT)
+        return asyncio.ensure_future(self.text_response(crnt_cmd, fut))
+
+    async def binary_response(self, crnt_cmd, fut):
+        return bridge_agent.binary_reply_handler(crnt_cmd, await fut)
+
+    async def text_response(self, crnt_cmd, fut):
+        return bridge_agent.reply_handler(crnt_cmd, await fut)
+
+    async def block_write(self, crnt_cmd):
+        chip_id = bridge_agent.devices[crnt_cmd.device_name]["chip_id"]
+        data_str = crnt_cmd.get_all_str().split()[-1]
+        if crnt_cmd.arg2 is None or len(data_str) == 0 or len(data_str) % 8 != 0:
+            return prepend_seq_num(crnt_cmd, "Error {}\n".format(WMT_INVALID_COMMAND))
+        data_b = bytes.fromhex(data_str)
+        addr = int(crnt_cmd.arg1)
+
+        async with self.link.issue_lock:
+            # Other clients' commands must not reach the MCU between the parts of a block write
+            await self.link.drain()
+            if bridge_agent.stream_block_writes:
+                status = await self.block_write_stream(chip_id, addr, data_b)
+            else:
+                status = await self.block_write_chunked(chip_id, addr, data_b)
+
+        if status is not None:
+            return prepend_seq_num(crnt_cmd, "Error {}\n".format(status))
+        return prepend_seq_num(crnt_cmd, "Ok\n")
+
+    async def block_write_stream(self, chip_id, addr, data_b):
+        # As bridge_agent.send_bw_data_to_mcu_stream(), with the pipeline holding the chunks not yet replied to
+        start_payload = bridge_agent.block_write_stream_start_payload(chip_id, addr, len(data_b))
+        reply_b = await (await self.link.issue(start_payload, REPLY_BINARY))
+        status = reply_b[bridge_agent.BINARY_REPLY_STATUS_OFFSET]
+        if status != bridge_agent.BINARY_REPLY_STATUS_OK:
+            return "{:X}".format(status)
+        (window, chunk_bytes) = bridge_agent.block_write_stream_window(reply_b, self.user_num_reg_in_chunk)
+
+        futs = []
+        for i in range(0, len(data_b), chunk_bytes):
+            payload = bridge_agent.block_write_stream_data_payload(data_b[i:i + chunk_bytes])
+            futs.append(await self.link.issue(payload, REPLY_BINARY, window))
+            # Stop at the first failure that has been seen, but collect the replies to chunks already sent
+            if any(f.done() and (f.result()[bridge_agent.BINARY_REPLY_STATUS_OFFSET] != 0) for f in futs):
+                break
+        for reply_b in await asyncio.gather(*futs):
+            status = reply_b[bridge_agent.BINARY_REPLY_STATUS_OFFSET]
+            if status != bridge_agent.BINARY_REPLY_STATUS_OK:
+                return "{:X}".format(status)
+        return None
+
+    async def block_write_chunked(self, chip_id, addr, data_b):
+        # As bridge_agent.send_bw_data_to_mcu_binary(), for MCUs without streaming block writes
+        chunk_bytes = self.user_num_reg_in_chunk * 4
+        for i in range(0, len(data_b), chunk_bytes):
+            payload = bytearray()
+            if i == 0:
+                payload += bridge_agent.payload_length_bytes(8 + len(data_b[i:i + chunk_bytes]))
+                payload.append(cmd_mcu_opcodes["BWs"])
+                payload.append(chip_id)
+                payload += addr.to_bytes(4, bridge_agent.PAYLOAD_BINARY_ENDIANNESS)
+            else:
+                payload += bridge_agent.payload_length_bytes(3 + len(data_b[i:i + chunk_bytes]))
+                payload.append(cmd_mcu_opcodes["BWc"])
+            payload += data_b[i:i + chunk_bytes]
+            reply = await (await self.link.issue(payload, REPLY_TEXT))
+            if bridge_agent.BWc not in reply[:len(bridge_agent.BWc)]:
+                return reply.split()[-1]
+
+        payload = bridge_agent.payload_length_bytes(3) + bytes([cmd_mcu_opcodes["BWe"]])
+        reply = await (await self.link.issue(payload, REPLY_TEXT))
+        if bridge_agent.ERROR_REPLY in reply[:len(bridge_agent.ERROR_REPLY)]:
+            return reply.split()[-1]
+        return None
+
+    async def serve_client(self, reader, writer):
+        self.num_clients += 1
+        self.num_connected += 1
+        client_num = self.num_clients
+        print("Client {} connected".format(client_num))
+        responses = asyncio.Queue()
+        sender = asyncio.ensure_future(self.send_responses(responses, writer))
+        writer.write(self.greeting.encode())
+        try:
+            while True:
+                cli_cmd_b = await reader.readline()
+                if not cli_cmd_b:
+                    break
+                if not cli_cmd_b.strip():
+                    continue
+                dbg_pr_general(self.verbose, "Client {} command: {}".format(client_num, cli_cmd_b))
+                crnt_cmd = bridge_agent.current_command()
+                try:
+                    crnt_cmd.new_cmd(cli_cmd_b)
+                    await responses.put(await self.submit(crnt_cmd))
+                except bridge_agent.bridge_excpn as be:
+                    print(be)
+                    await responses.put(completed("Error {}\n".format(WMT_INVALID_COMMAND)))
+                except KeyError:
+                    # Device name not found by Detect
+                    await responses.put(completed(prepend_seq_num(crnt_cmd, "Error {}\n".format(WMT_NO_DEVICE))))
+        except (ConnectionError, UnicodeError) as err:
+            print(type(err), err)
+        finally:
+            await responses.put(None)
+            await sender
+            writer.close()
+            self.num_connected -= 1
+            print("Client {} disconnected".format(client_num))
+
+    async def send_responses(self, responses, writer):
+        # Responses are sent in the order the client's commands were received
+        while True:
+            response = await responses.get()
+            if response is None:
+                break
+            try:
+                writer.write((await response).encode())
+                await writer.drain()
+            except ConnectionError:
+                pass
+
+#==========================================================================
+# HELPER FUNCTIONS
+#==========================================================================
+def completed(result):
+    fut = asyncio.get_event_loop().create_future()
+    fut.set_result(result)
+    return fut
+
+async def serve(ser_ch, ch_num, verbose, user_num_reg_in_chunk, pipeline_depth=DEFAULT_PIPELINE_DEPTH,
+                host='127.0.0.1', port=bridge_agent.CLIENT_PORT, started=None):
+    link = mcu_link(ser_ch, ch_num, pipeline_depth, DEFAULT_PIPELINE_WINDOW_BYTES, verbose)
+    link.start()
+    server = bridge_server(link, verbose, user_num_reg_in_chunk)
+    await server.handshake()
+
+    sock_server = await asyncio.start_server(server.serve_client, host, port)
+    portstr = format(sock_server.sockets[0].getsockname()[1], 'd')
+    print("Socket listening on port: {}, pipeline depth {}\n".format(portstr, pipeline_depth))
+    if started is not None:
+        started.set_result((int(portstr), server))
+    async with sock_server:
+        await sock_server.serve_forever()
+
+def run(ser_ch, ch_num, verbose, user_num_reg_in_chunk, pipeline_depth=DEFAULT_PIPELINE_DEPTH):
+    '''Serve clients until interrupted, as bridge_agent.outer_loop()'''
+    asyncio.run(serve(ser_ch, ch_num, verbose, user_num_reg_in_chunk, pipeline_depth))
+
+async def benchmark_client(port, num_cmds, client_num):
+    reader, writer = await asyncio.open_connection('127.0.0.1', port)
+    # Greeting
+    for _ in range(3):
+        await reader.readline()
+    for i in range(num_cmds):
+        if i % 2:
+            writer.write("[CS47L63-1:{}] Read {:x}\n".format(i, 0x1000 + (4 * client_num)).encode())
+        else:
+            writer.write("[CS47L63-1:{}] Write {:x} {:x}\n".format(i, 0x1000 + (4 * client_num), i).encode())
+    await writer.drain()
+    for i in range(num_cmds):
+        response = (await reader.readline()).decode()
+        if not response.startswith("[{}] ".format(i)):
+            raise bridge_agent.bridge_excpn("Client {} unexpected response {}".format(client_num, response))
+        if (i % 2) and (int(response.split()[1], 16) != i - 1):
+            raise bridge_agent.bridge_excpn("Client {} read back {}".format(client_num, response))
+    writer.close()
+
+async def batch_check(port):
+    '''Check that a Batch cmd polls registers as the equivalent Write and Read cmds would'''
+    reader, writer = await asyncio.open_connection('127.0.0.1', port)
+    # Greeting
+    for _ in range(3):
+        await reader.readline()
+    writer.write(b"[CS47L63-1:1] Batch W 2000 1234 W 2004 5678 R 2000 R 2004\n")
+    writer.write(b"[CS47L63-1:2] Read 2004\n")
+    writer.write(b"[CS47L63-1:3] Batch W 2000 0\n")
+    await writer.drain()
+    responses = [(await reader.readline()).decode() for _ in range(3)]
+    writer.close()
+    if responses != ["[1] 0x1234 0x5678\n", "[2] 0x5678\n", "[3] Ok\n"]:
+        raise bridge_agent.bridge_excpn("Batch check failed: {}".format(responses))
+
+async def benchmark(pipeline_depth, num_clients, num_cmds, baud):
+    import loopback_mcu
+    mcu = loopback_mcu.loopback_mcu(baud=baud)
+    started = asyncio.get_running_loop().create_future()
+    serving = asyncio.ensure_future(serve(mcu, '3', False, 100, pipeline_depth, port=0, started=started))
+    (port, server) = await started
+    await batch_check(port)
+    start = time.perf_counter()
+    await asyncio.gather(*[benchmark_client(port, num_cmds, n) for n in range(num_clients)])
+    elapsed = time.perf_counter() - start
+    while server.num_connected:
+        await asyncio.sleep(0.01)
+    serving.cancel()
+    print("Pipeline depth {:2}: {} clients x {} cmds in {:.3f}s, {:.0f} cmds/s".format(
+        pipeline_depth, num_clients, num_cmds, elapsed, (num_clients * num_cmds) / elapsed))
+
+def get_args(args):
+    """Parse arguments"""
+    parser = argparse.ArgumentParser(description='Run the bridge agent against the loopback stand-in MCU')
+    parser.add_argument('-d', '--pipeline-depth', dest='pipeline_depth', type=int, default=DEFAULT_PIPELINE_DEPTH,
+                        help='Maximum number of commands waiting for a reply from the MCU')
+    parser.add_argument('-l', '--loopback', dest='loopback', default=False, action='store_true',
+                        help='Serve clients with loopback_mcu in place of the MCU')
+    parser.add_argument('-b', '--benchmark', dest='benchmark', default=False, action='store_true',
+                        help='Time clients against loopback_mcu for pipeline depths up to --pipeline-depth')
+    parser.add_argument('-c', '--clients', dest='num_clients', type=int, default=4,
+                        help='Number of clients for --benchmark')
+    parser.add_argument('-n', '--commands', dest='num_cmds', type=int, default=200,
+                        help='Number of commands sent by each client for --benchmark')
+    parser.add_argument('--baud', dest='baud', type=int, default=bridge_agent.SER_BAUD,
+                        help='UART baud rate modelled by loopback_mcu')
+    parser.add_argument('-v', '--verbose', dest='verbose', default=False, action='store_true')
+
+    return parser.parse_args(args[1:])
+
+#==========================================================================
+# MAIN PROGRAM
+#==========================================================================
+def main(argv):
+    args = get_args(argv)
+    if args.benchmark:
+        depth = 1
+        while depth <= args.pipeline_depth:
+            asyncio.run(benchmark(depth, args.num_clients, args.num_cmds, args.baud))
+            depth *= 2
+    elif args.loopback:
+        import loopback_mcu
+        run(loopback_mcu.loopback_mcu(baud=args.baud), '3', args.verbose, 100, args.pipeline_depth)
+    else:
+        print("Use run_bridge.py --async to serve clients over the serial channel")
+
+if __name__ == "__main__":
+    main(sys.argv)
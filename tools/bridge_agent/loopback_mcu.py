@@ -0,0 +1,305 @@
+#==========================================================================
+# (c) 2022 Cirrus Logic, Inc.
+#--------------------------------------------------------------------------
+# Project : Stand-in MCU for exercising and benchmarking the bridge agent
+# File    : loopback_mcu.py
+#--------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#--------------------------------------------------------------------------
+#
+# Environment Requirements: None
+#
+#==========================================================================
+
+#==========================================================================
+# IMPORTS
+#==========================================================================
+import queue
+import threading
+import time
+import bridge_agent
+
+#==========================================================================
+# CONSTANTS/GLOBALS
+#==========================================================================
+# UART bits per byte, with start and stop bits
+UART_BITS_PER_BYTE = 10
+# Time the MCU takes to handle a command, not counting the UART
+DEFAULT_CMD_TIME_S = 0.0002
+# Bytes the MCU can have waiting in its bridge receive FIFO, as BRIDGE_STREAM_WINDOW_BYTES
+DEFAULT_WINDOW_BYTES = 1024
+MAX_BLOCK_WRITE_BYTES = 800
+
+WMT_INVALID_COMMAND = 0x1E
+WMT_WRITE_FAILED = 0x27
+WMT_READ_FAILED = 0x28
+WMT_UNSUPPORTED = 0x33
+WMT_NO_DEVICE = 0x36
+
+INFO_REPLY = '"StudioBridge","1.5.13.0","106","DEADBEEF","Alt-OS","0.0.0"'
+
+#==========================================================================
+# CLASSES
+#==========================================================================
+class loopback_device(object):
+    def __init__(self, name, id_str, bus_name="SPI", bus_addr=0, reg_addr_stride=4):
+        self.name = name
+        self.id_str = id_str
+        self.bus_name = bus_name
+        self.bus_addr = bus_addr
+        self.reg_addr_stride = reg_addr_stride
+        self.regs = dict()
+
+    def read(self, addr):
+        return self.regs.get(addr, 0)
+
+    def write(self, addr, val):
+        self.regs[addr] = val & 0xFFFFFFFF
+
+    def write_block(self, addr, data_b):
+        # Block data is big-endian, as sent by the agent
+        for i in range(0, len(data_b), 4):
+            self.write(addr, int.from_bytes(data_b[i:i + 4], 'big'))
+            addr += self.reg_addr_stride
+
+    def read_block(self, addr, length):
+        data_b = b''
+        for i in range(0, length, 4):
+            data_b += self.read(addr).to_bytes(4, 'big')
+            addr += self.reg_addr_stride
+        return data_b[:length]
+
+class loopback_mcu(object):
+    """
+    Stand-in for the MCU end of the bridge serial channel.
+
+    Implements the serial channel calls used by bridge_agent (write_channel_bytes and read_channel), and handles the
+    commands as common/bridge/bridge.c does, for msg formats up to 0.3, with registers held in memory.  Commands are
+    handled one at a time, in order, and the time taken on the UART in each direction is modelled from baud, so that
+    the agent can be benchmarked without hardware.
+    """
+    def __init__(self, devices=None, baud=bridge_agent.SER_BAUD, cmd_time_s=DEFAULT_CMD_TIME_S, max_minor=3):
+        if devices is None:
+            devices = [loopback_device("CS47L63-1", "47A63")]
+        self.devices = devices
+        self.byte_time_s = (UART_BITS_PER_BYTE / baud) if baud else 0
+        self.cmd_time_s = cmd_time_s
+        self.max_minor = max_minor
+        self.minor = 1
+        self.current_device = devices[0]
+        self.bw = None
+        self.bws = None
+        self.num_cmds = 0
+
+        self.cmd_q = queue.Queue()
+        self.reply_q = queue.Queue()
+        self.rx_line_free = 0
+        self.tx_line_free = 0
+        self.thread = threading.Thread(target=self.run, daemon=True)
+        self.thread.start()
+
+    def write_channel_bytes(self, ch_num, payload):
+        # Commands queue up on the UART behind any still being received
+        self.rx_line_free = max(time.perf_counter(), self.rx_line_free) + (len(payload) * self.byte_time_s)
+        self.cmd_q.put((bytes(payload), self.rx_line_free))
+
+    def read_channel(self, ch_num):
+        # As smcio, block for the next reply and return everything that has arrived, one char per byte
+        (reply_b, ready) = self.reply_q.get()
+        wait_until(ready)
+        while not self.reply_q.empty():
+            (more_b, ready) = self.reply_q.queue[0]
+            if ready > time.perf_counter():
+                break
+            self.reply_q.get()
+            reply_b += more_b
+        return reply_b.decode('latin-1')
+
+    def run(self):
+        while True:
+            (cmd_b, arrival) = self.cmd_q.get()
+            wait_until(arrival + self.cmd_time_s)
+            reply_b = self.handle(cmd_b)
+            self.num_cmds += 1
+            self.tx_line_free = max(time.perf_counter(), self.tx_line_free) + (len(reply_b) * self.byte_time_s)
+            self.reply_q.put((reply_b, self.tx_line_free))
+
+    def handle(self, cmd_b):
+        opcode = cmd_b[bridge_agent.PAYLOAD_BYTE_LENGTH]
+        handlers = {
+            0x1: self.handle_current_device,
+            0x2: lambda c: (0, text_reply("ProtocolVersion 106")),
+            0x3: lambda c: (0, text_reply(INFO_REPLY)),
+            0x4: self.handle_detect,
+            0x5: self.handle_read,
+            0x6: self.handle_write,
+            0x7: self.handle_blockread,
+            0x8: self.handle_blockwrite_start,
+            0x9: self.handle_blockwrite_cont,
+            0xa: self.handle_blockwrite_end,
+            0x10: self.handle_mcu_msg_format_version,
+            0x11: self.handle_batch,
+            0x12: self.handle_blockwrite_stream_start,
+            0x13: self.handle_blockwrite_stream_data,
+        }
+        binary = (self.minor >= 2) and (opcode in [0x4, 0x5, 0x7, 0x11, 0x12, 0x13])
+        if opcode not in handlers:
+            return self.error_reply(binary, WMT_UNSUPPORTED)
+        (status, reply) = handlers[opcode](cmd_b)
+        if status != 0:
+            return self.error_reply(binary, status)
+        return reply
+
+    def error_reply(self, binary, status):
+        if binary:
+            return binary_reply(status)
+        return text_reply("ER {:X}".format(status))
+
+    def get_device(self, chip_num):
+        if 0 < chip_num <= len(self.devices):
+            self.current_device = self.devices[chip_num - 1]
+            return self.current_device
+        return None
+
+    def handle_current_device(self, cmd_b):
+        return (0, text_reply(self.current_device.name))
+
+    def handle_mcu_msg_format_version(self, cmd_b):
+        requested = cmd_b[3] if len(cmd_b) > 3 else 1
+        self.minor = max(1, min(requested, self.max_minor))
+        self.bws = None
+        return (0, text_reply("0.{}".format(self.minor)))
+
+    def handle_detect(self, cmd_b):
+        if self.minor >= 2:
+            data_b = bytes([len(self.devices)])
+            for d in self.devices:
+                data_b += bytes([bridge_agent.binary_detect_bus_names.index(d.bus_name), d.bus_addr, 0])
+                data_b += bytes([len(d.name)]) + d.name.encode() + bytes([len(d.id_str)]) + d.id_str.encode()
+            return (0, binary_reply(0, data_b))
+        parts = ["{},{},{:x},false,{}".format(d.name, d.bus_name, d.bus_addr, d.id_str) for d in self.devices]
+        return (0, text_reply(':'.join(parts)))
+
+    def handle_read(self, cmd_b):
+        d = self.get_device(cmd_b[3])
+        if d is None:
+            return (WMT_NO_DEVICE, None)
+        val = d.read(le(cmd_b[4:8]))
+        if self.minor >= 2:
+            return (0, binary_reply(0, val.to_bytes(4, 'little')))
+        return (0, text_reply(str(val)))
+
+    def handle_write(self, cmd_b):
+        d = self.get_device(cmd_b[3])
+        if d is None:
+            return (WMT_NO_DEVICE, None)
+        d.write(le(cmd_b[4:8]), le(cmd_b[8:12]))
+        return (0, text_reply("Ok"))
+
+    def handle_blockread(self, cmd_b):
+        d = self.get_device(cmd_b[3])
+        if d is None:
+            return (WMT_NO_DEVICE, None)
+        length = le(cmd_b[8:10])
+        if length > MAX_BLOCK_WRITE_BYTES:
+            return (WMT_UNSUPPORTED, None)
+        data_b = d.read_block(le(cmd_b[4:8]), length)
+        if self.minor >= 2:
+            return (0, binary_reply(0, data_b))
+        return (0, text_reply(data_b.hex().upper()))
+
+    def handle_blockwrite_start(self, cmd_b):
+        d = self.get_device(cmd_b[3])
+        if d is None:
+            return (WMT_NO_DEVICE, None)
+        self.bw = (d, le(cmd_b[4:8]), bytearray(cmd_b[8:]))
+        return (0, text_reply("BWc"))
+
+    def handle_blockwrite_cont(self, cmd_b):
+        if self.bw is None:
+            return (WMT_INVALID_COMMAND, None)
+        self.bw[2].extend(cmd_b[3:])
+        return (0, text_reply("BWc"))
+
+    def handle_blockwrite_end(self, cmd_b):
+        if self.bw is None:
+            return (WMT_INVALID_COMMAND, None)
+        (d, addr, data_b) = self.bw
+        self.bw = None
+        d.write_block(addr, data_b)
+        return (0, text_reply("Ok"))
+
+    def handle_batch(self, cmd_b):
+        if self.minor < 2:
+            return (WMT_UNSUPPORTED, None)
+        i = 4
+        data_b = b''
+        for num_done in range(cmd_b[3]):
+            d = self.get_device(cmd_b[i + 1])
+            if d is None:
+                return (0, binary_reply(WMT_NO_DEVICE, bytes([num_done]) + data_b))
+            if cmd_b[i] == bridge_agent.BATCH_OP_WRITE:
+                d.write(le(cmd_b[i + 2:i + 6]), le(cmd_b[i + 6:i + 10]))
+                i += 10
+            else:
+                data_b += d.read(le(cmd_b[i + 2:i + 6])).to_bytes(4, 'little')
+                i += 6
+        return (0, binary_reply(0, bytes([cmd_b[3]]) + data_b))
+
+    def handle_blockwrite_stream_start(self, cmd_b):
+        self.bws = None
+        if self.minor < 3:
+            return (WMT_UNSUPPORTED, None)
+        d = self.get_device(cmd_b[3])
+        if d is None:
+            return (WMT_NO_DEVICE, None)
+        length = le(cmd_b[8:12])
+        if length == 0 or length % 4 != 0:
+            return (WMT_INVALID_COMMAND, None)
+        self.bws = [d, le(cmd_b[4:8]), length]
+        data_b = DEFAULT_WINDOW_BYTES.to_bytes(2, 'little') + MAX_BLOCK_WRITE_BYTES.to_bytes(2, 'little')
+        return (0, binary_reply(0, data_b))
+
+    def handle_blockwrite_stream_data(self, cmd_b):
+        chunk = cmd_b[3:]
+        if self.bws is None:
+            return (WMT_INVALID_COMMAND, None)
+        (d, addr, left) = self.bws
+        if len(chunk) == 0 or len(chunk) % 4 != 0 or len(chunk) > min(left, MAX_BLOCK_WRITE_BYTES):
+            self.bws = None
+            return (WMT_INVALID_COMMAND, None)
+        d.write_block(addr, chunk)
+        left -= len(chunk)
+        self.bws = [d, addr + (len(chunk) // 4) * d.reg_addr_stride, left] if left else None
+        return (0, binary_reply(0))
+
+#==========================================================================
+# HELPER FUNCTIONS
+#==========================================================================
+def le(data_b):
+    return int.from_bytes(data_b, 'little')
+
+def text_reply(reply_str):
+    return (reply_str + '\n').encode('latin-1')
+
+def binary_reply(status, data_b=b''):
+    return (len(data_b) + 3).to_bytes(2, 'little') + bytes([status]) + data_b
+
+def wait_until(t):
+    delay = t - time.perf_counter()
+    if delay > 0:
+        time.sleep(delay)
+
+#==========================================================================
+# MAIN PROGRAM
+#==========================================================================
@@ -37,6 +37,7 @@ import smcio
 import signal
 import time
 import bridge_agent
+import bridge_agent_async
 import traceback
 import re
 
@@ -62,7 +63,10 @@ class com_port(smcio.serial_io_interface):
         self.ser.write(byte_list)
 
     def read(self, length):
-        byte_list = self.ser.read(length)
+        # Wait for the first byte, then take whatever else has already arrived
+        byte_list = self.ser.read(1)
+        if (len(byte_list) != 0) and (length > 1) and (self.ser.in_waiting > 0):
+            byte_list += self.ser.read(min(length - 1, self.ser.in_waiting))
         if (len(byte_list) == 0):
             return None
         else:
@@ -142,6 +146,11 @@ def get_args(args):
     parser.add_argument('-r', '--user_num_reg_in_chunk', dest='user_num_reg_in_chunk', default=100, type=int,
                         help='The number of registers to chunk in a block-write operation. '
                         'Must be between 1 and 200. Omitting this option defaults to 100')
+    parser.add_argument('-a', '--async', dest='async_agent', default=False, action='store_true',
+                        help='Serve several clients at once, pipelining their commands to the MCU')
+    parser.add_argument('-d', '--pipeline-depth', dest='pipeline_depth', type=int,
+                        default=bridge_agent_async.DEFAULT_PIPELINE_DEPTH,
+                        help='With --async, the maximum number of commands waiting for a reply from the MCU')
 
     return parser.parse_args(args[1:])
 
@@ -177,6 +186,10 @@ def validate_args(args):
         print("Invalid chunk-size specified ({})".format(args.user_num_reg_in_chunk))
         return False
 
+    if args.pipeline_depth < 1:
+        print("Invalid pipeline depth specified ({})".format(args.pipeline_depth))
+        return False
+
     return True
 
 def print_start():
@@ -193,6 +206,8 @@ def print_args(args):
     print("Timeout (s): " + str(args.timeout))
     if args.verbose:
         print("Register chunk size for block-writes: {}".format(args.user_num_reg_in_chunk))
+    if args.async_agent:
+        print("Multi-client agent, pipeline depth: {}".format(args.pipeline_depth))
     print("")
 
 def print_results(results_string):
@@ -263,7 +278,10 @@ def main(argv):
     ''' Do Wisce Agent stuff using new module bridge_agent.py '''
     devices = dict()  # No device details discovered yet
     try:
-        bridge_agent.outer_loop(p, '3', args.verbose, args.user_num_reg_in_chunk)
+        if args.async_agent:
+            bridge_agent_async.run(p, '3', args.verbose, args.user_num_reg_in_chunk, args.pipeline_depth)
+        else:
+            bridge_agent.outer_loop(p, '3', args.verbose, args.user_num_reg_in_chunk)
     except IOError as e:
         print("\nIOError: {}. Exiting\n".format(e))
         raise
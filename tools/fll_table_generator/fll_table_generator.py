@@ -0,0 +1,357 @@
+# ==========================================================================
+# (c) 2021 Cirrus Logic, Inc.
+# --------------------------------------------------------------------------
+# Project : Generate the pre-solved FLL configuration tables in fll_table.c
+# File    : fll_table_generator.py
+# --------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# --------------------------------------------------------------------------
+#
+# Environment Requirements: None
+#
+# The solvers below mirror fll_madera_solve() and fll_hj_solve() in
+# common/fll.c.  Any change to one must be made to the other, then the table
+# regenerated.  --check runs fll_table_check() on the host to confirm that
+# the table and the C solvers agree.
+#
+# ==========================================================================
+
+# ==========================================================================
+# IMPORTS
+# ==========================================================================
+import os
+import sys
+repo_path = os.path.dirname(os.path.abspath(__file__)) + '/../..'
+import argparse
+import datetime
+import shutil
+import subprocess
+import tempfile
+
+# ==========================================================================
+# CONSTANTS/GLOBALS
+# ==========================================================================
+# Common reference clocks: 32kHz sleep clock, I2S BCLKs for 44.1k/48k families and typical MCLKs
+fll_common_frefs = [32768, 1411200, 1536000, 2822400, 3072000, 5644800, 6144000,
+                    11289600, 12288000, 22579200, 24576000]
+fll_madera_common_fouts = [98304000, 90316800]
+fll_hj_common_fouts = [49152000, 45158400]
+
+FLL_MADERA_MAX_FREF = 13500000
+FLL_MADERA_MAX_REFDIV = 8
+FLL_MADERA_MAX_N = 1023
+
+fll_madera_sync_fratios = [
+    (0, 64000, 4, 16),
+    (64000, 128000, 3, 8),
+    (128000, 256000, 2, 4),
+    (256000, 1000000, 1, 2),
+    (1000000, 13500000, 0, 1),
+]
+
+fll_madera_sync_gains = [
+    (0, 256000, 0, -1),
+    (256000, 1000000, 2, -1),
+    (1000000, 13500000, 4, -1),
+]
+
+fll_madera_main_gains = [
+    (0, 100000, 0, 2),
+    (100000, 375000, 2, 2),
+    (375000, 768000, 3, 2),
+    (768001, 1500000, 3, 3),
+    (1500000, 6000000, 4, 3),
+    (6000000, 13500000, 5, 3),
+]
+
+FLL_HJ_INT_MAX_N = 1023
+FLL_HJ_INT_MIN_N = 1
+FLL_HJ_FRAC_MAX_N = 255
+FLL_HJ_FRAC_MIN_N = 2
+FLL_HJ_LP_INT_MODE_THRESH = 100000
+FLL_HJ_LOW_THRESH = 192000
+FLL_HJ_MID_THRESH = 1152000
+FLL_HJ_MAX_THRESH = 13000000
+FLL_HJ_LOW_GAINS = 0x23f0
+FLL_HJ_MID_GAINS = 0x22f2
+FLL_HJ_HIGH_GAINS = 0x21f0
+
+fll_table_c_template = """/**
+ * @file fll_table.c
+ *
+ * @brief Pre-solved FLL configurations for common reference/output frequency pairs
+ *
+ * This file is generated by tools/fll_table_generator/fll_table_generator.py - do not edit.
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic {year} All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include "fll.h"
+
+/***********************************************************************************************************************
+ * GLOBAL VARIABLES
+ **********************************************************************************************************************/
+const fll_madera_table_entry_t fll_madera_table[] =
+{{
+    //  fref,      fout,       sync,  {{ n,    theta,  lambda, refdiv, fratio, gain, alt_gain }}
+{madera_entries}
+}};
+
+const uint32_t fll_madera_table_size = sizeof(fll_madera_table) / sizeof(fll_madera_table[0]);
+
+const fll_hj_table_entry_t fll_hj_table[] =
+{{
+    //  fref,      fout,       {{ refdiv, n,    theta,  lambda, fbdiv, hp,  gains,  lockdet_thr }}
+{hj_entries}
+}};
+
+const uint32_t fll_hj_table_size = sizeof(fll_hj_table) / sizeof(fll_hj_table[0]);
+"""
+
+# ==========================================================================
+# HELPER FUNCTIONS
+# ==========================================================================
+def fll_madera_solve(fref, fout, sync):
+    if (fref == 0):
+        return None
+
+    div = 1
+    refdiv = 0
+    while (fref > FLL_MADERA_MAX_FREF):
+        div *= 2
+        fref //= 2
+        refdiv += 1
+        if (div > FLL_MADERA_MAX_REFDIV):
+            return None
+
+    if (sync):
+        ratio = None
+        for (fmin, fmax, f, r) in fll_madera_sync_fratios:
+            if (fmin <= fref <= fmax):
+                fratio = f
+                ratio = r
+                break
+        if (ratio is None):
+            return None
+        gains = fll_madera_sync_gains
+    else:
+        ratio = 1
+        while ((fout // (ratio * fref)) > FLL_MADERA_MAX_N):
+            ratio += 1
+        fratio = ratio - 1
+        gains = fll_madera_main_gains
+
+    n = fout // (ratio * fref)
+    if (fout % (ratio * fref)):
+        g = gcd(fout, ratio * fref)
+        theta = (fout - (n * ratio * fref)) // g
+        lambda_ = (ratio * fref) // g
+    else:
+        theta = 0
+        lambda_ = 0
+
+    while (lambda_ >= (1 << 16)):
+        theta >>= 1
+        lambda_ >>= 1
+
+    for (fmin, fmax, gain, alt_gain) in gains:
+        if (fmin <= fref <= fmax):
+            return (n, theta, lambda_, refdiv, fratio, gain, alt_gain)
+
+    return None
+
+def fll_hj_solve(fref, fout):
+    if ((fref == 0) or (fout == 0)):
+        return None
+
+    refdiv = 0
+    while (refdiv < 4):
+        if ((fref // (1 << refdiv)) <= FLL_HJ_MAX_THRESH):
+            break
+        refdiv += 1
+
+    fref = fref // (1 << refdiv)
+    frac = (fout % fref) != 0
+
+    if (fref < FLL_HJ_LOW_THRESH):
+        lockdet_thr = 2
+        gains = FLL_HJ_LOW_GAINS
+        fbdiv = 256 if frac else 4
+    elif (fref < FLL_HJ_MID_THRESH):
+        lockdet_thr = 8
+        gains = FLL_HJ_MID_GAINS
+        fbdiv = 16 if frac else 2
+    else:
+        lockdet_thr = 8
+        gains = FLL_HJ_HIGH_GAINS
+        fbdiv = 1
+
+    if (frac):
+        hp = 0x3
+        min_n = FLL_HJ_FRAC_MIN_N
+        max_n = FLL_HJ_FRAC_MAX_N
+    else:
+        hp = 0x0 if (fref < FLL_HJ_LP_INT_MODE_THRESH) else 0x1
+        min_n = FLL_HJ_INT_MIN_N
+        max_n = FLL_HJ_INT_MAX_N
+
+    ratio = fout // fref
+    while ((ratio // fbdiv) < min_n):
+        fbdiv //= 2
+        if (fbdiv < min_n):
+            return None
+    while (frac and ((ratio // fbdiv) > max_n)):
+        fbdiv *= 2
+        if (fbdiv >= 1024):
+            return None
+
+    g = gcd(fout, fbdiv * fref)
+    num = fout // g
+    lambda_ = (fref * fbdiv) // g
+    n = num // lambda_
+    theta = num % lambda_
+
+    if ((n < min_n) or (n > max_n)):
+        return None
+    if ((fbdiv < 1) or (frac and (fbdiv >= 1024)) or ((not frac) and (fbdiv >= 256))):
+        return None
+
+    return (refdiv, n, theta, lambda_, fbdiv, hp, gains, lockdet_thr)
+
+def gcd(n1, n2):
+    while (n2 != 0):
+        (n1, n2) = (n2, n1 % n2)
+    return n1
+
+def format_madera_entries():
+    lines = []
+    for fout in fll_madera_common_fouts:
+        for fref in fll_common_frefs:
+            for sync in [False, True]:
+                cfg = fll_madera_solve(fref, fout, sync)
+                if (cfg is None):
+                    continue
+                lines.append("    {{ {:>8}, {:>10}, {:<5}, {{ {:>4}, {:>6}, {:>6}, {:>6}, {:>6}, {:>4}, {:>8} }} }},".format(
+                    fref, fout, 'true' if sync else 'false', *cfg))
+    return '\n'.join(lines)
+
+def format_hj_entries():
+    lines = []
+    for fout in fll_hj_common_fouts:
+        for fref in fll_common_frefs:
+            cfg = fll_hj_solve(fref, fout)
+            if (cfg is None):
+                continue
+            (refdiv, n, theta, lambda_, fbdiv, hp, gains, lockdet_thr) = cfg
+            lines.append("    {{ {:>8}, {:>10}, {{ {:>6}, {:>4}, {:>6}, {:>6}, {:>5}, {:>3}, 0x{:04x}, {:>11} }} }},".format(
+                fref, fout, refdiv, n, theta, lambda_, fbdiv, hp, gains, lockdet_thr))
+    return '\n'.join(lines)
+
+def get_args(args):
+    """Parse arguments"""
+    parser = argparse.ArgumentParser(description='Parse command line arguments')
+    parser.add_argument('-o', '--output', dest='output_filename', type=str,
+                        default=repo_path + '/common/fll_table.c',
+                        help='Path and filename of the fll_table.c to generate.')
+    parser.add_argument('-c', '--check', dest='check', action="store_true",
+                        help='Only check that the existing file is up to date and matches the solvers in fll.c, ' +
+                             'do not write it.')
+
+    return parser.parse_args(args[1:])
+
+# Host program calling fll_table_check() from common/fll.c
+fll_table_check_main_c = """#include <stdio.h>
+#include "fll.h"
+
+int main(void)
+{
+    uint32_t ret = fll_table_check();
+
+    printf("fll_table_check() returned %u\\n", (unsigned int) ret);
+
+    return (ret == FLL_STATUS_OK) ? 0 : 1;
+}
+"""
+
+def run_fll_table_check(table_filename):
+    """Build common/fll.c with table_filename for the host and run fll_table_check()"""
+    cc = os.environ.get('CC', 'cc')
+    if (shutil.which(cc) is None):
+        print("No host C compiler (" + cc + "), fll_table_check() not run")
+        return True
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        main_filename = os.path.join(temp_dir, 'fll_table_check_main.c')
+        exe_filename = os.path.join(temp_dir, 'fll_table_check')
+        with open(main_filename, 'w') as f:
+            f.write(fll_table_check_main_c)
+        cmd = [cc, '-std=c99', '-I' + repo_path + '/common', '-o', exe_filename,
+               main_filename, repo_path + '/common/fll.c', table_filename]
+        if (subprocess.call(cmd) != 0):
+            print("Failed to build fll_table_check()")
+            return False
+
+        return (subprocess.call([exe_filename]) == 0)
+
+def error_exit(error_message):
+    print('ERROR: ' + error_message)
+    exit(1)
+
+# ==========================================================================
+# MAIN PROGRAM
+# ==========================================================================
+def main(argv):
+    args = get_args(argv)
+
+    output_str = fll_table_c_template.format(year=datetime.datetime.now().year,
+                                             madera_entries=format_madera_entries(),
+                                             hj_entries=format_hj_entries())
+
+    if (args.check):
+        if (not os.path.exists(args.output_filename)):
+            error_exit("No such file: " + args.output_filename)
+        with open(args.output_filename, 'r') as f:
+            existing = f.read()
+        # Ignore the copyright year when comparing
+        existing = existing.split('\n', 8)[8]
+        if (existing != output_str.split('\n', 8)[8]):
+            error_exit(args.output_filename + " is out of date")
+        print(args.output_filename + " is up to date")
+        if (not run_fll_table_check(args.output_filename)):
+            error_exit(args.output_filename + " does not match the solvers in fll.c")
+    else:
+        with open(args.output_filename, 'w') as f:
+            f.write(output_str)
+        print("Wrote " + args.output_filename)
+
+    return
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,135 @@
+#==========================================================================
+# (c) 2022 Cirrus Logic, Inc.
+#--------------------------------------------------------------------------
+# Project : Pack fw_img binaries into an image for the interposer EEPROM
+# File    : fw_img_eeprom.py
+#--------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#--------------------------------------------------------------------------
+#
+# Environment Requirements: None
+#
+# The fw_img inputs are the .bin files from
+# 'firmware_converter.py fw_img_v2 ... --binary-output'.  The output is a
+# raw image of the EEPROM from address 0, to be written with any SPI flash
+# programmer or with bsp_eeprom_program().  The index layout must match
+# BSP_EEPROM_FW_IMG_INDEX_* in common/platform_bsp/platform_bsp.h:
+#
+#   0x0000: magic, version, count
+#   0x000C: (address, size) for each fw_img, in the order given
+#
+# All fields are little-endian 32-bit words.  Each fw_img starts on an
+# erase sector boundary, so one can be replaced without erasing the others.
+#
+#==========================================================================
+
+#==========================================================================
+# IMPORTS
+#==========================================================================
+import argparse
+import struct
+import sys
+
+#==========================================================================
+# CONSTANTS/GLOBALS
+#==========================================================================
+INDEX_MAGIC = 0x58495746    # "FWIX"
+INDEX_VERSION = 1
+INDEX_HEADER_FORMAT = '<III'
+INDEX_ENTRY_FORMAT = '<II'
+
+FW_IMG_MAGIC_1 = 0x54b998ff
+FW_IMG_SIZE_OFFSET = 8
+
+# AT25SL128A on the RevB interposer
+EEPROM_SECTOR_SIZE = 4096
+EEPROM_SIZE = 16 * 1024 * 1024
+ERASED_BYTE = 0xFF
+
+#==========================================================================
+# HELPER FUNCTIONS
+#==========================================================================
+def align(value, alignment):
+    return ((value + alignment - 1) // alignment) * alignment
+
+def read_fw_img(filename):
+    f = open(filename, 'rb')
+    fw_img = f.read()
+    f.close()
+
+    if (len(fw_img) < (FW_IMG_SIZE_OFFSET + 4)):
+        raise ValueError(filename + ": too short to be a fw_img")
+    (magic_1,) = struct.unpack_from('<I', fw_img, 0)
+    if (magic_1 != FW_IMG_MAGIC_1):
+        raise ValueError(filename + ": not a fw_img, magic number is " + hex(magic_1))
+    (img_size,) = struct.unpack_from('<I', fw_img, FW_IMG_SIZE_OFFSET)
+    if (img_size != len(fw_img)):
+        raise ValueError(filename + ": img_size in header is " + str(img_size) + " but file is " +
+                         str(len(fw_img)) + " bytes")
+
+    return fw_img
+
+def create_eeprom_image(fw_imgs):
+    index_size = struct.calcsize(INDEX_HEADER_FORMAT) + (len(fw_imgs) * struct.calcsize(INDEX_ENTRY_FORMAT))
+
+    # Lay out the fw_imgs after the index, each in its own erase sectors
+    entries = []
+    addr = align(index_size, EEPROM_SECTOR_SIZE)
+    for fw_img in fw_imgs:
+        entries.append((addr, len(fw_img)))
+        addr = align(addr + len(fw_img), EEPROM_SECTOR_SIZE)
+    if (addr > EEPROM_SIZE):
+        raise ValueError("fw_imgs need " + str(addr) + " bytes, but the EEPROM is only " + str(EEPROM_SIZE))
+
+    image = bytearray([ERASED_BYTE] * addr)
+    struct.pack_into(INDEX_HEADER_FORMAT, image, 0, INDEX_MAGIC, INDEX_VERSION, len(fw_imgs))
+    offset = struct.calcsize(INDEX_HEADER_FORMAT)
+    for (entry, fw_img) in zip(entries, fw_imgs):
+        struct.pack_into(INDEX_ENTRY_FORMAT, image, offset, entry[0], entry[1])
+        offset += struct.calcsize(INDEX_ENTRY_FORMAT)
+        image[entry[0]:entry[0] + entry[1]] = fw_img
+
+    return (bytes(image), entries)
+
+def get_args(args):
+    """Parse arguments"""
+    parser = argparse.ArgumentParser(description='Pack fw_img binaries, with an index, into an EEPROM image')
+    parser.add_argument(dest='output', type=str, help='The EEPROM image to create.')
+    parser.add_argument(dest='fw_imgs', type=str, nargs='+',
+                        help='The fw_img .bin files, in index order, i.e. the first is index 0.')
+
+    return parser.parse_args(args[1:])
+
+#==========================================================================
+# MAIN PROGRAM
+#==========================================================================
+def main(argv):
+    args = get_args(argv)
+
+    try:
+        fw_imgs = [read_fw_img(filename) for filename in args.fw_imgs]
+        (image, entries) = create_eeprom_image(fw_imgs)
+    except (IOError, ValueError) as e:
+        print("ERROR: " + str(e))
+        sys.exit(1)
+
+    f = open(args.output, 'wb')
+    f.write(image)
+    f.close()
+
+    for (i, (filename, entry)) in enumerate(zip(args.fw_imgs, entries)):
+        print("{:2}: 0x{:06X} {:8} bytes {}".format(i, entry[0], entry[1], filename))
+    print("Wrote " + args.output + ", " + str(len(image)) + " bytes")
+
+if __name__ == "__main__":
+    main(sys.argv)
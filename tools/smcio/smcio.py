@@ -41,6 +41,22 @@ sys.path.insert(1, '../bridge_agent')
 PAYLOAD_UNPACK_SHORT = None
 PAYLOAD_UNPACK_INT = None
 
+# Packet framing:
+# | SOH | Type | Count | Length | STX | Payload | ETX | Checksum | EOT |
+#   1     1      1       2 (BE)   1     Length    1     1          1
+# An MCU with nothing left to send may end a packet early with | SOH | Type | Count | EOT |
+SOH = 0x01
+STX = 0x02
+ETX = 0x03
+EOT = 0x04
+PACKET_HEADER_LENGTH = 6
+PACKET_TRAILER_LENGTH = 3
+PACKET_EMPTY_LENGTH = 4
+# Longer payloads are treated as framing errors.  The MCU sends no more than its UART TX FIFO (1024 bytes) at once.
+PACKET_MAX_PAYLOAD_LENGTH = 4096
+# Bytes requested from serial_io_interface.read() at a time
+RX_READ_LENGTH = 4096
+
 #==========================================================================
 # CLASSES
 #==========================================================================
@@ -62,8 +78,7 @@ class packet:
         for c in packet_str:
             a.payload.append(ord(c))
         a.length = len(a.payload)
-        # calculate checksum
-        a.checksum = 0xAB
+        a.checksum = cls.calc_checksum(a.payload)
         return a
 
     @classmethod
@@ -75,35 +90,27 @@ class packet:
         # The payload must already be in new binary format
         # This module should not know details of the payload format
         a.length = len(a.payload)
-
-        # calculate checksum
-        a.checksum = 0xAB
+        a.checksum = cls.calc_checksum(a.payload)
         return a
 
+    @staticmethod
+    def calc_checksum(payload):
+        return (~sum(payload)) & 0xFF
+
     def validate(self):
 
         if (self.length != len(self.payload)):
             return False
 
-        temp_checksum = 0
-
-        for p in self.payload:
-            temp_checksump += p
-
-        temp_checksum = ~temp_checksum
-
-        if (self.checksum != temp_checksum):
+        # MCU builds that do not calculate the checksum send 0
+        if (self.checksum != 0) and (self.checksum != packet.calc_checksum(self.payload)):
             return False
 
         return True
 
     def payload_to_string(self):
-        temp_str = ''
-
-        for i in self.payload:
-            temp_str += chr(i)
-
-        return temp_str
+        # One char per payload byte
+        return bytes(self.payload).decode('latin-1')
 
     def encode(self):
         temp_bytes = b'\x01'
@@ -143,73 +150,80 @@ class packet:
         return temp_str
 
 class packet_parser:
-    def __init__(self):
+    """
+    Split the received byte stream into packets.
+
+    Rather than stepping through each byte, the parser searches for SOH and slices out whole packets once all their
+    bytes have arrived.  Only an incomplete packet is kept between calls, so the buffer is bounded by the longest
+    packet.  Packets with bad framing or a bad checksum are dropped and counted, and parsing resumes at the next SOH.
+    """
+    def __init__(self, max_payload_length=PACKET_MAX_PAYLOAD_LENGTH):
         self.packets = queue.Queue()
+        self.max_payload_length = max_payload_length
         self.reset()
 
         return
 
     def add_bytes(self, byte_list):
-        self.byte_list += byte_list
+        self.buffer += bytes(byte_list)
 
         return
 
     def parse(self, b):
-        self.byte_list += b
-
-        for temp_int in b:
-            if ((self.state == 'idle') and (temp_int == 0x01)):
-                self.state = 'soh'
-            elif (self.state == 'soh'):
-                self.temp_packet = packet()
-                self.temp_packet.type = chr(temp_int)
-                self.state = 'type'
-            elif (self.state == 'type'):
-                self.temp_packet.count = temp_int
-                self.byte_count = 0
-                self.state = 'count'
-            elif (self.state == 'count'):
-                if (self.byte_count == 0):
-                    self.temp_packet.length = temp_int
-                    self.byte_count += 1
-                else:
-                    self.temp_packet.length <<= 8
-                    self.temp_packet.length |= temp_int
-                    self.state = 'length'
-            elif (self.state == 'length'):
-                if (temp_int == 0x02):
-                    self.byte_count = 1
-                    self.state = 'sot'
-                else:
-                    self.state = 'idle'
-            elif (self.state == 'sot'):
-                self.temp_packet.payload.append(temp_int)
-                if (self.byte_count < self.temp_packet.length):
-                    self.byte_count += 1
-                else:
-                    self.state = 'payload'
-            elif (self.state == 'payload'):
-                if (temp_int == 0x03):
-                    self.state = 'eo_text'
-                else:
-                    self.state = 'idle'
-            elif (self.state == 'eo_text'):
-                self.temp_packet.checksum = temp_int
-                self.state = 'checksum'
-            elif (self.state == 'checksum'):
-                if (temp_int == 0x04):
-                    self.packets.put(self.temp_packet)
-                    self.packets.task_done()
-                    self.temp_packet = None
-                self.state = 'idle'
+        self.buffer += b
+        buf = self.buffer
+        index = 0
+
+        while True:
+            soh = buf.find(SOH, index)
+            if (soh < 0):
+                index = len(buf)
+                break
+            if ((len(buf) - soh) < PACKET_HEADER_LENGTH):
+                index = soh
+                break
+            if ((buf[soh + 3] == EOT) and (buf[soh + 5] != STX)):
+                # Early end, with no payload.  A length msb of 0x04 is told apart by the STX that follows it.
+                index = soh + PACKET_EMPTY_LENGTH
+                continue
+
+            length = (buf[soh + 3] << 8) | buf[soh + 4]
+            if ((buf[soh + 5] != STX) or (length > self.max_payload_length)):
+                self.framing_errors += 1
+                index = soh + 1
+                continue
+
+            end = soh + PACKET_HEADER_LENGTH + length
+            if (len(buf) < (end + PACKET_TRAILER_LENGTH)):
+                index = soh
+                break
+            if ((buf[end] != ETX) or (buf[end + 2] != EOT)):
+                self.framing_errors += 1
+                index = soh + 1
+                continue
+
+            p = packet()
+            p.type = chr(buf[soh + 1])
+            p.count = buf[soh + 2]
+            p.length = length
+            p.payload = bytes(buf[(soh + PACKET_HEADER_LENGTH):end])
+            p.checksum = buf[end + 1]
+            index = end + PACKET_TRAILER_LENGTH
+            if (not p.validate()):
+                self.checksum_errors += 1
+                continue
+
+            self.packets.put(p)
+            self.packets.task_done()
+
+        del buf[:index]
 
         return
 
     def reset(self):
-        self.byte_list = []
-        self.state = 'idle'
-        self.byte_count = 0
-        self.temp_packet = None
+        self.buffer = bytearray()
+        self.framing_errors = 0
+        self.checksum_errors = 0
         self.packets.queue.clear()
 
         return
@@ -235,7 +249,7 @@ class serial_io_interface(metaclass=abc.ABCMeta):
 
     @abc.abstractmethod
     def read(self, length: int):
-        """Read some data"""
+        """Read up to length bytes, waiting for at least one, or return None on timeout"""
         raise NotImplementedError
 
 class channel:
@@ -296,7 +310,7 @@ class processor:
 
     def rx_parser(self):
         while not self.stop_event.is_set():
-            l = self.io.read(1)
+            l = self.io.read(RX_READ_LENGTH)
             if (l is not None):
                 self.parser.parse(l)
 
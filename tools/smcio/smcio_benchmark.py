@@ -0,0 +1,113 @@
+#==========================================================================
+# (c) 2022 Cirrus Logic, Inc.
+#--------------------------------------------------------------------------
+# Project : Serial-Multichannel IO Library
+# File    : smcio_benchmark.py
+#--------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#--------------------------------------------------------------------------
+#
+# Environment Requirements: None
+#
+#==========================================================================
+
+#==========================================================================
+# IMPORTS
+#==========================================================================
+import argparse
+import random
+import sys
+import time
+import smcio
+
+#==========================================================================
+# CONSTANTS/GLOBALS
+#==========================================================================
+UART_BITS_PER_BYTE = 10
+DEFAULT_BAUD_RATES = [115200, 460800, 921600]
+# Time between serial reads, which sets how many bytes each parse() call gets
+DEFAULT_READ_INTERVAL_S = 0.001
+
+#==========================================================================
+# HELPER FUNCTIONS
+#==========================================================================
+def make_stream(num_packets, max_payload_length, corrupt_every, seed=1):
+    '''Returns (stream bytes, expected packets), as a mix of stdout text and bridge channel replies'''
+    rnd = random.Random(seed)
+    stream = bytearray()
+    expected = []
+    for i in range(num_packets):
+        channel_id = rnd.choice(['0', '3'])
+        payload = bytes(rnd.getrandbits(8) for _ in range(rnd.randint(1, max_payload_length)))
+        p = smcio.packet.fromTypeBytes(ord(channel_id), i, payload)
+        encoded = bytearray(p.encode())
+        # A checksum of 0 is taken as from an older MCU build and not checked, so leave those packets alone
+        if corrupt_every and ((i % corrupt_every) == (corrupt_every - 1)) and (p.checksum != 0):
+            # Flip a payload bit, which the checksum must catch
+            encoded[smcio.PACKET_HEADER_LENGTH] ^= 0x01
+        else:
+            expected.append((channel_id, i & 0xFF, payload))
+        stream += encoded
+    return (bytes(stream), expected)
+
+def run_parser(stream, chunk_length):
+    parser = smcio.packet_parser()
+    received = []
+    start = time.perf_counter()
+    for i in range(0, len(stream), chunk_length):
+        parser.parse(stream[i:i + chunk_length])
+        p = parser.get_new_packet()
+        while (p is not None):
+            received.append((p.type, p.count, p.payload_to_string()))
+            p = parser.get_new_packet()
+    elapsed = time.perf_counter() - start
+    return (elapsed, received, parser)
+
+def get_args(args):
+    """Parse arguments"""
+    parser = argparse.ArgumentParser(description='Measure smcio packet parser throughput at UART rates')
+    parser.add_argument('-n', '--packets', dest='num_packets', type=int, default=5000)
+    parser.add_argument('-l', '--max-payload', dest='max_payload_length', type=int, default=1024,
+                        help='Maximum payload length of the generated packets')
+    parser.add_argument('-c', '--corrupt-every', dest='corrupt_every', type=int, default=100,
+                        help='Corrupt every Nth packet, or 0 for none')
+    parser.add_argument('-i', '--read-interval', dest='read_interval_s', type=float, default=DEFAULT_READ_INTERVAL_S,
+                        help='Seconds between serial reads')
+    parser.add_argument('-b', '--baud', dest='baud_rates', type=int, nargs='+', default=DEFAULT_BAUD_RATES)
+
+    return parser.parse_args(args[1:])
+
+#==========================================================================
+# MAIN PROGRAM
+#==========================================================================
+def main(argv):
+    args = get_args(argv)
+    (stream, expected) = make_stream(args.num_packets, args.max_payload_length, args.corrupt_every)
+    expected = [(t, c, p.decode('latin-1')) for (t, c, p) in expected]
+    print("{} packets, {} bytes, {} corrupted".format(args.num_packets, len(stream),
+                                                      args.num_packets - len(expected)))
+
+    for baud in args.baud_rates:
+        uart_bytes_per_s = baud / UART_BITS_PER_BYTE
+        chunk_length = max(1, int(uart_bytes_per_s * args.read_interval_s))
+        (elapsed, received, parser) = run_parser(stream, chunk_length)
+        if (received != expected):
+            print("ERROR: {} baud: packets received do not match packets sent".format(baud))
+            sys.exit(1)
+        parse_bytes_per_s = len(stream) / elapsed
+        print("{:8} baud: {:5} byte reads, {:7.2f} MB/s, {:6.0f} packets/s, {:5.2f}% CPU at line rate, "
+              "{} checksum errors".format(baud, chunk_length, parse_bytes_per_s / 1e6, len(received) / elapsed,
+                                          100 * uart_bytes_per_s / parse_bytes_per_s, parser.checksum_errors))
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,273 @@
+# ==========================================================================
+# (c) 2021 Cirrus Logic, Inc.
+# --------------------------------------------------------------------------
+# Project : Export typed register field accessors from device XML
+# File    : field_accessor_exporter.py
+# --------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# --------------------------------------------------------------------------
+#
+# Environment Requirements: None
+#
+# ==========================================================================
+
+# ==========================================================================
+# IMPORTS
+# ==========================================================================
+import re
+
+# ==========================================================================
+# CONSTANTS/GLOBALS
+# ==========================================================================
+header_file_template_str = """/**
+ * @file {prefix_lc}_fields.h
+ *
+ * @brief
+ * Typed register field accessors for {prefix_uc}.
+ *
+ * Each register has its own update type, so fields of different registers cannot be combined by mistake.  Field
+ * setters accumulate into an update, which is then applied with a single read-modify-write, e.g.:
+ *
+ *     {prefix_lc}_<reg>_t u = {prefix_lc}_<reg>_fields();
+ *     u = {prefix_lc}_<reg>_<field_a>(u, a);
+ *     u = {prefix_lc}_<reg>_<field_b>(u, b);
+ *     ret = {prefix_lc}_<reg>_update(cp, u);
+ *
+ * @copyright
+ * Copyright (c) Cirrus Logic 2021 All Rights Reserved, http://www.cirrus.com/
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+{metadata_text} *
+ */
+#ifndef {prefix_uc}_FIELDS_H
+#define {prefix_uc}_FIELDS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***********************************************************************************************************************
+ * INCLUDES
+ **********************************************************************************************************************/
+#include <stdint.h>
+#include "regmap.h"
+
+/***********************************************************************************************************************
+ * LITERALS & CONSTANTS
+ **********************************************************************************************************************/
+{reg_defines}
+/***********************************************************************************************************************
+ * ENUMS, STRUCTS, UNIONS, TYPEDEFS
+ **********************************************************************************************************************/
+{reg_typedefs}
+/***********************************************************************************************************************
+ * API FUNCTIONS
+ **********************************************************************************************************************/
+{reg_accessors}
+/**********************************************************************************************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif // {prefix_uc}_FIELDS_H
+
+"""
+
+reg_defines_template_str = "#define {prefix_uc}_{regname}_FIELDS_ADDRESS ({address})\n"
+
+bitfield_defines_template_str = """#define {prefix_uc}_{regname}_{name}_FIELD_MASK ({mask})
+#define {prefix_uc}_{regname}_{name}_FIELD_SHIFT ({shift})
+"""
+
+reg_typedef_template_str = """/**
+ * Pending field update of register {regname}
+ */
+typedef struct
+{
+    uint32_t mask;                          ///< Bits changed by the update
+    uint32_t val;                           ///< New value of the changed bits
+} {prefix_lc}_{regname_lc}_t;
+
+"""
+
+bitfield_get_template_str = """/**
+ * Get {regname}.{name} from a register value
+ */
+static inline uint32_t {prefix_lc}_{regname_lc}_{name_lc}_get(uint32_t reg_val)
+{
+    return (reg_val & {prefix_uc}_{regname}_{name}_FIELD_MASK) >> {prefix_uc}_{regname}_{name}_FIELD_SHIFT;
+}
+
+"""
+
+reg_fields_template_str = """/**
+ * Start an update of register {regname} with no fields changed
+ */
+static inline {prefix_lc}_{regname_lc}_t {prefix_lc}_{regname_lc}_fields(void)
+{
+    {prefix_lc}_{regname_lc}_t u;
+
+    u.mask = 0;
+    u.val = 0;
+
+    return u;
+}
+
+"""
+
+bitfield_set_template_str = """/**
+ * Set {regname}.{name} in a pending update of register {regname}
+ */
+static inline {prefix_lc}_{regname_lc}_t {prefix_lc}_{regname_lc}_{name_lc}({prefix_lc}_{regname_lc}_t u, uint32_t val)
+{
+    u.mask |= {prefix_uc}_{regname}_{name}_FIELD_MASK;
+    u.val &= ~{prefix_uc}_{regname}_{name}_FIELD_MASK;
+    u.val |= (val << {prefix_uc}_{regname}_{name}_FIELD_SHIFT) & {prefix_uc}_{regname}_{name}_FIELD_MASK;
+
+    return u;
+}
+
+"""
+
+reg_update_template_str = """/**
+ * Apply a pending update to register {regname}
+ *
+ * All changed fields are applied in a single read-modify-write, or a single write if the update covers the whole
+ * register.
+ *
+ * @return
+ * - REGMAP_STATUS_FAIL if the control port transaction fails
+ * - REGMAP_STATUS_OK   otherwise
+ */
+static inline uint32_t {prefix_lc}_{regname_lc}_update(regmap_cp_config_t *cp, {prefix_lc}_{regname_lc}_t u)
+{
+    if (u.mask == 0xFFFFFFFF)
+    {
+        return regmap_write(cp, {prefix_uc}_{regname}_FIELDS_ADDRESS, u.val);
+    }
+
+    return regmap_update_reg(cp, {prefix_uc}_{regname}_FIELDS_ADDRESS, u.mask, u.val);
+}
+
+"""
+
+# ==========================================================================
+# CLASSES
+# ==========================================================================
+class field_accessor_exporter:
+    def __init__(self, output_path, device, metadata_text, prefix=None):
+        self.output_path = output_path
+        self.device = device
+        self.metadata_text = metadata_text
+        if (prefix is None):
+            prefix = device.device_id_type
+        self.prefix = to_identifier(prefix)
+
+        return
+
+    def export(self):
+        defines_str = ""
+        typedefs_str = ""
+        accessors_str = ""
+
+        for r in self.device.registers:
+            # Registers with no bitfields are accessed as a whole with regmap_read/regmap_write
+            if (len(r.bitfields) == 0):
+                continue
+
+            regname = to_identifier(r.name)
+            reg_terms = {'regname': regname,
+                         'regname_lc': regname.lower(),
+                         'address': "0x{:08x}".format(r.address)}
+
+            defines_str += self.replace_terms(reg_defines_template_str, reg_terms)
+
+            has_writeable = False
+            get_str = ""
+            set_str = ""
+            for b in r.bitfields:
+                name = to_identifier(b.name)
+                terms = dict(reg_terms)
+                terms.update({'name': name,
+                              'name_lc': name.lower(),
+                              'mask': "0x{:08x}".format(b.mask),
+                              'shift': str(b.shift)})
+
+                defines_str += self.replace_terms(bitfield_defines_template_str, terms)
+                get_str += self.replace_terms(bitfield_get_template_str, terms)
+                if (b.is_writeable):
+                    has_writeable = True
+                    set_str += self.replace_terms(bitfield_set_template_str, terms)
+            defines_str += '\n'
+
+            accessors_str += get_str
+            if (has_writeable):
+                typedefs_str += self.replace_terms(reg_typedef_template_str, reg_terms)
+                accessors_str += self.replace_terms(reg_fields_template_str, reg_terms)
+                accessors_str += set_str
+                accessors_str += self.replace_terms(reg_update_template_str, reg_terms)
+
+        temp_metadata_text = ""
+        for l in self.metadata_text:
+            temp_metadata_text += ' * ' + l + '\n'
+
+        output_str = header_file_template_str
+        output_str = output_str.replace("{metadata_text}", temp_metadata_text)
+        output_str = output_str.replace("{reg_defines}", defines_str)
+        output_str = output_str.replace("{reg_typedefs}", typedefs_str)
+        output_str = output_str.replace("{reg_accessors}", accessors_str)
+        output_str = self.replace_terms(output_str, {})
+        output_str = output_str.replace("\n\n\n", "\n\n")
+
+        filename = self.output_path + "/" + self.prefix.lower() + "_fields.h"
+        f = open(filename, 'w')
+        f.write(output_str)
+        f.close()
+
+        results_str = "Exported to:\n"
+        results_str += filename + "\n"
+        return results_str
+
+    def replace_terms(self, template_str, terms):
+        output_str = template_str
+        for (k, v) in terms.items():
+            output_str = output_str.replace('{' + k + '}', v)
+        output_str = output_str.replace('{prefix_lc}', self.prefix.lower())
+        output_str = output_str.replace('{prefix_uc}', self.prefix.upper())
+
+        return output_str
+
+# ==========================================================================
+# HELPER FUNCTIONS
+# ==========================================================================
+def to_identifier(name):
+    name = re.sub(r'[^A-Za-z0-9_]', '_', name.upper())
+    if re.match(r'[0-9]', name):
+        name = '_' + name
+
+    return name
+
+# ==========================================================================
+# MAIN PROGRAM
+# ==========================================================================
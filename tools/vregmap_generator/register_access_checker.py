@@ -0,0 +1,282 @@
+# ==========================================================================
+# (c) 2021 Cirrus Logic, Inc.
+# --------------------------------------------------------------------------
+# Project : Report register accesses that could be merged
+# File    : register_access_checker.py
+# --------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# --------------------------------------------------------------------------
+#
+# Environment Requirements: None
+#
+# ==========================================================================
+
+# ==========================================================================
+# IMPORTS
+# ==========================================================================
+import os
+import re
+
+# ==========================================================================
+# CONSTANTS/GLOBALS
+# ==========================================================================
+# Calls which change a register, with the register address as the second argument
+write_call_pattern = r'\b(regmap_write|regmap_update_reg|\w+_write_reg|\w+_update_reg)\s*\('
+
+# Field accessor updates exported by field_accessor_exporter, i.e. <prefix>_<reg>_update(cp, u), which name the
+# register in the function name rather than in an argument
+field_update_call_pattern = r'\b(\w+)_update\s*\('
+FIELD_UPDATE_NUM_ARGS = 2
+
+# Block writes, which change other registers and so separate two writes to the same register
+block_write_call_pattern = r'\b(regmap_write_block|\w+_write_block)\s*\('
+
+# Calls which read a register or wait, and so separate writes to the same register
+read_call_pattern = r'\b(regmap_read|regmap_poll_reg|regmap_write_acked_reg|\w+_read_reg|\w+_poll_reg)\s*\('
+delay_call_pattern = r'\b(set_timer|\w+_wait\w*|\w+_delay\w*)\s*\('
+
+# Registers where each write has a side effect, so are written with a fixed sequence of values or pulsed, are never
+# reported.  These are the TEST_KEY_CTRL/USER_KEY_CTRL unlock keys, the MSM_ERROR_RELEASE 0->1->0 pulses, the DSP
+# mailboxes, the PWRMGT_WAKESRC_CTL update sequence, the MCU_CTRL handshakes and FLL_CONTROL_1, where FREERUN is set
+# before and cleared after changing the FLL.  Literal addresses are matched against these by the register name they
+# resolve to in the device _spec.h.
+side_effect_register_patterns = [r'TEST_KEY', r'USER_KEY', r'ERROR_RELEASE', r'MBOX', r'WAKESRC', r'MCU_CTRL',
+                                 r'FLL\w*_CONTROL_?1']
+
+# The same rules by address, for each device _spec.h, so literal addresses are skipped even where the register map
+# does not name them
+side_effect_register_addresses = {
+    'cs47l63_spec.h': [0x0030, 0x0034, 0x0808],
+}
+
+# Register names and addresses in _spec.h files, i.e. '#define CS47L63_MCU_CTRL2  0x000808' for symbolic addresses
+# and 'R38 (0x808) - MCU_CTRL2' or '/* (0x0808)  SPDIF1TX2MIX_Input_1_Source */' for the register at a literal address
+spec_define_pattern = r'^#define\s+(\w+)\s+\(?(0x[0-9A-Fa-f]+)\)?'
+spec_register_pattern = r'^(?:/\*|\s*\*)\s*(?:R\d+\s+)?\((0x[0-9A-Fa-f]+)\)\s*-?\s*(\w+)'
+include_pattern = r'#include\s+"(\w+\.h)"'
+
+# ==========================================================================
+# CLASSES
+# ==========================================================================
+class register_access_checker:
+    """
+    Report sequences that write the same register more than once.
+
+    Within each function, two writes or updates of the same register address in the same block are reported when there
+    is no read, poll or delay in between.  These can usually be combined into a single read-modify-write with the field
+    accessors exported by field_accessor_exporter.  Literal and symbolic addresses are resolved through the register
+    map in the _spec.h included by the source, so both name the same register.
+
+    Registers matching side_effect_register_patterns, side_effect_register_addresses or any of allowed_patterns are
+    never reported.  Neither are back-to-back writes of the same register with no other write in between, as these are
+    a deliberate sequence of values rather than fields that could be merged.
+    """
+    def __init__(self, filenames, allowed_patterns=[]):
+        self.filenames = filenames
+        self.allowed_patterns = side_effect_register_patterns + allowed_patterns
+        self.findings = []
+
+        return
+
+    def check(self):
+        self.findings = []
+        for fn in self.filenames:
+            f = open(fn)
+            text = f.read()
+            f.close()
+            self.regmap = get_register_map(fn, text)
+            self.check_source(fn, strip_comments(text))
+
+        return self.findings
+
+    def check_source(self, filename, text):
+        events = []
+        for (pattern, kind) in [(write_call_pattern, 'write'),
+                                (block_write_call_pattern, 'block'),
+                                (read_call_pattern, 'read'),
+                                (delay_call_pattern, 'delay')]:
+            for m in re.finditer(pattern, text):
+                args = get_call_args(text, m.end())
+                addr = None
+                if (kind not in ['delay', 'block']) and (len(args) > 1):
+                    addr = self.resolve(re.sub(r'\s+', '', args[1]))
+                events.append((m.start(), kind, addr, m.group(1)))
+        for m in re.finditer(field_update_call_pattern, text):
+            if (len(get_call_args(text, m.end())) == FIELD_UPDATE_NUM_ARGS):
+                events.append((m.start(), 'write', m.group(1), m.group(0).rstrip('( \t\n')))
+        events.sort()
+
+        # Assign each event to the innermost block it is in
+        blocks = get_blocks(text)
+        pending = dict()
+        last_write = None
+        for (pos, kind, addr, name) in events:
+            block = get_block(blocks, pos)
+            if (block is None):
+                continue
+            (start, depth) = block
+            # A new top-level block is a new function
+            pending = {k: v for (k, v) in pending.items() if is_in_function(blocks, v[0], pos)}
+            previous_write = last_write
+            if (kind in ['write', 'block']):
+                last_write = (addr, start)
+
+            if (kind == 'delay'):
+                pending = dict()
+            elif (kind == 'read'):
+                pending.pop(addr, None)
+            elif (kind == 'write') and (addr is not None) and (not self.is_allowed(addr)):
+                if (addr in pending) and (pending[addr][1] == start) and (previous_write != (addr, start)):
+                    (prev_pos, prev_start, prev_name) = pending[addr]
+                    self.findings.append((filename,
+                                          get_line(text, prev_pos),
+                                          get_line(text, pos),
+                                          addr,
+                                          prev_name,
+                                          name))
+                pending[addr] = (pos, start, name)
+
+        return
+
+    def resolve(self, addr):
+        # Name the register by '<address> (<register name>)' where the register map knows it
+        (names, addresses, side_effect_addresses) = self.regmap
+        value = addresses.get(addr)
+        if (value is None) and re.match(r'^0x[0-9A-Fa-f]+$', addr):
+            value = int(addr, 16)
+        if (value is None):
+            return addr
+        if (value not in names) and (addr in addresses):
+            # Only named by its #define, so use that for literal writes of the same register too
+            names[value] = addr
+        if (value not in names):
+            return '0x%04X' % value
+
+        return '0x%04X (%s)' % (value, names[value])
+
+    def is_allowed(self, addr):
+        m = re.match(r'^0x([0-9A-F]+)\b', addr)
+        if (m is not None) and (int(m.group(1), 16) in self.regmap[2]):
+            return True
+
+        return any(re.search(pattern, addr) for pattern in self.allowed_patterns)
+
+    def report(self):
+        output_str = ""
+        for (filename, line_a, line_b, addr, name_a, name_b) in self.findings:
+            output_str += filename + ":" + str(line_b) + ": " + addr + " also written at line " + str(line_a) + \
+                          " (" + name_a + ", " + name_b + "), could be merged\n"
+        output_str += str(len(self.findings)) + " register accesses could be merged\n"
+
+        return output_str
+
+# ==========================================================================
+# HELPER FUNCTIONS
+# ==========================================================================
+def strip_comments(text):
+    # Replace comments and string literals with spaces, keeping line numbers and character positions
+    def blank(m):
+        return re.sub(r'[^\n]', ' ', m.group(0))
+
+    return re.sub(r'//[^\n]*|/\*.*?\*/|"(\\.|[^"\\])*"|\'(\\.|[^\'\\])*\'', blank, text, flags=re.S)
+
+def get_spec_headers(filename, text):
+    # The _spec.h files included by the source, directly or through a header in the same directory
+    spec_fns = []
+    for header_fn in re.findall(include_pattern, text):
+        header_path = os.path.join(os.path.dirname(filename), header_fn)
+        if header_fn.endswith('_spec.h'):
+            spec_fns.append(header_path)
+        elif os.path.exists(header_path):
+            f = open(header_path)
+            header_text = f.read()
+            f.close()
+            spec_fns += [os.path.join(os.path.dirname(filename), fn) for fn in re.findall(include_pattern, header_text)
+                         if fn.endswith('_spec.h')]
+
+    return spec_fns
+
+def get_register_map(filename, text):
+    # Maps of register address to name and name to address from each _spec.h the source includes, and the side effect
+    # addresses for those devices
+    names = dict()
+    addresses = dict()
+    side_effect_addresses = []
+    for spec_path in get_spec_headers(filename, text):
+        side_effect_addresses += side_effect_register_addresses.get(os.path.basename(spec_path), [])
+        if (not os.path.exists(spec_path)):
+            continue
+        f = open(spec_path)
+        spec_text = f.read()
+        f.close()
+        for m in re.finditer(spec_define_pattern, spec_text, flags=re.M):
+            addresses[m.group(1)] = int(m.group(2), 16)
+        for m in re.finditer(spec_register_pattern, spec_text, flags=re.M):
+            names.setdefault(int(m.group(1), 16), m.group(2))
+
+    return (names, addresses, side_effect_addresses)
+
+def get_call_args(text, pos):
+    args = []
+    depth = 0
+    start = pos
+    while pos < len(text):
+        c = text[pos]
+        if c in '([{':
+            depth += 1
+        elif c in ')]}':
+            if depth == 0:
+                args.append(text[start:pos])
+                break
+            depth -= 1
+        elif (c == ',') and (depth == 0):
+            args.append(text[start:pos])
+            start = pos + 1
+        pos += 1
+
+    return args
+
+def get_blocks(text):
+    # List of (start, end, depth) for each brace-delimited block
+    blocks = []
+    stack = []
+    for (i, c) in enumerate(text):
+        if c == '{':
+            stack.append(i)
+        elif (c == '}') and (len(stack) > 0):
+            start = stack.pop()
+            blocks.append((start, i, len(stack)))
+
+    return blocks
+
+def get_block(blocks, pos):
+    innermost = None
+    for (start, end, depth) in blocks:
+        if (start < pos < end) and ((innermost is None) or (depth > innermost[1])):
+            innermost = (start, depth)
+
+    return innermost
+
+def is_in_function(blocks, pos_a, pos_b):
+    for (start, end, depth) in blocks:
+        if (depth == 0) and (start < pos_a < end):
+            return start < pos_b < end
+
+    return False
+
+def get_line(text, pos):
+    return text.count('\n', 0, pos) + 1
+
+# ==========================================================================
+# MAIN PROGRAM
+# ==========================================================================
@@ -34,6 +34,8 @@ from vregmap_wisce_xml_importer import vregmap_wisce_xml_importer
 from vregmap_scs_xml_importer import vregmap_scs_xml_importer
 import xml.etree.ElementTree as ET
 from vregmap_exporter import vregmap_exporter
+from field_accessor_exporter import field_accessor_exporter
+from register_access_checker import register_access_checker
 
 # ==========================================================================
 # VERSION
@@ -54,16 +56,36 @@ from vregmap_exporter import vregmap_exporter
 def get_args(args):
     """Parse arguments"""
     parser = argparse.ArgumentParser(description='Parse command line arguments')
-    parser.add_argument('-c', '--command', dest='command', type=str, choices=["print", "export"], required=True, default="print",
-                        help='The command you wish to execute.')
-    parser.add_argument('-i', '--input', dest='input', type=str, required=True,
-                        help='The filename of the XML to be parsed.')
+    parser.add_argument('-c', '--command', dest='command', type=str, choices=["print", "export", "fields", "check"], required=True, default="print",
+                        help='The command you wish to execute.  "fields" exports typed register field accessors, ' +
+                             '"check" reports registers written more than once that could be merged.')
+    parser.add_argument('-i', '--input', dest='input', type=str, default=None,
+                        help='The filename of the XML to be parsed.  Not needed for "check".')
     parser.add_argument('-o', '--output_dir', dest='output_dir', type=str, default='.', help='The path to output directory.')
+    parser.add_argument('-p', '--prefix', dest='prefix', type=str, default=None,
+                        help='The prefix for exported field accessors.  Defaults to the device ID from the XML.')
+    parser.add_argument('-s', '--sources', dest='sources', type=str, nargs='+', default=[],
+                        help='The C source files to check.')
+    parser.add_argument('-a', '--allow', dest='allow', type=str, action='append', default=[],
+                        help='A regex for register addresses that "check" should never report, e.g. registers ' +
+                             'where each write has a side effect.  Can be given more than once.')
 
     return parser.parse_args(args[1:])
 
 def validate_args(args):
+    if (args.command == "check"):
+        # Check that all sources exist
+        for fn in args.sources:
+            if (not os.path.exists(fn)):
+                print("Invalid source path: " + fn)
+                return False
+
+        return (len(args.sources) > 0)
+
     # Check that input XML exists
+    if (args.input is None):
+        print("No XML path given")
+        return False
     if (not os.path.exists(args.input)):
         print("Invalid XML path: " + args.input)
         return False
@@ -88,7 +110,8 @@ def print_start():
 def print_args(args):
     print("")
     print("Command: " + args.command)
-    print("Input XML path: " + args.input)
+    if (args.input is not None):
+        print("Input XML path: " + args.input)
     print("Output directory: " + args.output_dir)
 
     return
@@ -131,6 +154,14 @@ def main(argv):
     if (not (validate_args(args))):
         error_exit("Invalid Arguments")
 
+    if (args.command == "check"):
+        c = register_access_checker(args.sources, args.allow)
+        c.check()
+        print_results(c.report())
+        print_end()
+
+        return
+
     if (get_xml_type(args.input) == "WISCE"):
         i = vregmap_wisce_xml_importer(args.input)
     else:
@@ -146,8 +177,11 @@ def main(argv):
         for arg in argv:
             temp_line = temp_line + ' ' + arg
         metadata_text_lines.append('Command: ' + temp_line)
-        e = vregmap_exporter(args.output_dir, vdevice, metadata_text_lines)
-        e.export()
+        if (args.command == "fields"):
+            e = field_accessor_exporter(args.output_dir, vdevice, metadata_text_lines, args.prefix)
+        else:
+            e = vregmap_exporter(args.output_dir, vdevice, metadata_text_lines)
+        print_results(e.export())
 
     print_results("")
     print_end()
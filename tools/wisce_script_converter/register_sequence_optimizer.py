@@ -0,0 +1,314 @@
+# ==========================================================================
+# (c) 2021 Cirrus Logic, Inc.
+# --------------------------------------------------------------------------
+# Project : Optimize WISCE Script register sequences before export
+# File    : register_sequence_optimizer.py
+# --------------------------------------------------------------------------
+# Licensed under the Apache License, Version 2.0 (the License); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an AS IS BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# --------------------------------------------------------------------------
+#
+# Environment Requirements: None
+#
+# ==========================================================================
+
+# ==========================================================================
+# IMPORTS
+# ==========================================================================
+from wisce_script_function import wisce_script_function
+
+# ==========================================================================
+# CONSTANTS/GLOBALS
+# ==========================================================================
+delay_cmds = ['wait', 'insert_delay_ms', 'insert_delay']
+
+# Registers whose writes open or close a lock window, i.e. TEST_KEY_CTRL
+default_lock_addrs = [0x40]
+default_lock_names = ['TEST_KEY']
+
+# ==========================================================================
+# CLASSES
+# ==========================================================================
+class register_sequence_optimizer:
+    """
+    Remove redundant control port transactions from an imported transaction list.
+
+    The transaction list is split into windows at delays, block writes, firmware symbol writes and writes to lock
+    registers.  These are emitted unchanged.  Transactions are never reordered.  Within each window:
+    - a write or RMW to memory followed by a write to the same address is dropped
+    - an RMW of memory following a write or RMW to the same address is folded into it, when all values and masks are
+      literals
+    - consecutive writes to ascending contiguous literal addresses are merged into a block write, if it is smaller
+
+    Registers may have side effects, e.g. mailboxes, so only literal addresses within memory_ranges are treated as
+    memory.  No transaction is dropped or folded across a write to a register, or across a transaction that may alias
+    it.
+    """
+    def __init__(self, command, reg_stride=4, block_min_regs=2, lock_addrs=None, memory_ranges=None):
+        self.command = command
+        self.reg_stride = reg_stride
+        self.block_min_regs = block_min_regs
+        self.lock_addrs = default_lock_addrs if lock_addrs is None else lock_addrs
+        self.memory_ranges = [] if memory_ranges is None else memory_ranges
+        self.stats_before = None
+        self.stats_after = None
+        return
+
+    def optimize(self, transaction_list):
+        self.stats_before = self.get_stats(transaction_list)
+
+        result = []
+        window = []
+        for t in transaction_list:
+            if isinstance(t, str) or (t.cmd in ['write', 'rmodw'] and not self.is_barrier(t)):
+                window.append(t)
+            else:
+                result.extend(self.optimize_window(window))
+                result.append(t)
+                window = []
+        result.extend(self.optimize_window(window))
+
+        self.stats_after = self.get_stats(result)
+        return result
+
+    def optimize_window(self, window):
+        ops = []
+        for t in window:
+            if isinstance(t, str):
+                ops.append(t)
+                continue
+
+            key = self.get_key(t)
+            if not self.is_memory(key):
+                ops.append(t)
+                continue
+
+            prev_index = self.find_last_alias(ops, key)
+            if (prev_index is not None) and (self.get_key(ops[prev_index]) == key):
+                prev = ops[prev_index]
+                if t.cmd == 'write':
+                    # Previous value is never read
+                    del ops[prev_index]
+                    t = self.copy_transaction(t, [prev.comment, t.comment])
+                else:
+                    folded = self.fold(prev, t)
+                    if folded is not None:
+                        del ops[prev_index]
+                        t = folded
+            ops.append(t)
+
+        return self.merge_blocks(ops)
+
+    def merge_blocks(self, ops):
+        if self.block_min_regs == 0:
+            return ops
+
+        result = []
+        # Writes to ascending contiguous addresses, and any comments between them
+        run = []
+        last = None
+        for t in ops:
+            if isinstance(t, str):
+                (run if (last is not None) else result).append(t)
+            elif (last is not None) and self.can_merge(t) and \
+                 (self.get_key(t) == self.get_key(last) + self.reg_stride):
+                run.append(t)
+                last = t
+            else:
+                result.extend(self.merge_run(run))
+                (run, last) = ([t], t) if self.can_merge(t) else ([], None)
+                if last is None:
+                    result.append(t)
+        result.extend(self.merge_run(run))
+
+        return result
+
+    def can_merge(self, t):
+        return (t.cmd == 'write') and isinstance(self.get_key(t), int) and (self.get_value(t) is not None)
+
+    def merge_run(self, run):
+        writes = [t for t in run if not isinstance(t, str)]
+        # A block write has a 3 word header, so in an array it must replace at least 4 writes to be smaller
+        if (len(writes) < self.block_min_regs) or \
+           ((self.command == 'c_array') and ((len(writes) + 3) >= sum(t.length for t in writes))):
+            return run
+
+        return [t for t in run if isinstance(t, str)] + [self.create_block_write(writes)]
+
+    def fold(self, prev, t):
+        value = self.get_value(t)
+        mask = self.get_mask(t)
+        prev_value = self.get_value(prev)
+        if (value is None) or (mask is None) or (prev_value is None):
+            return None
+
+        if prev.cmd == 'write':
+            return self.create_transaction('write',
+                                           self.get_addr(t),
+                                           (prev_value & ~mask) | (value & mask),
+                                           None,
+                                           [prev.comment, t.comment])
+
+        prev_mask = self.get_mask(prev)
+        if prev_mask is None:
+            return None
+
+        value = ((prev_value & ~mask) | (value & mask)) & (prev_mask | mask)
+        mask = prev_mask | mask
+        if mask == 0xFFFFFFFF:
+            return self.create_transaction('write', self.get_addr(t), value, None, [prev.comment, t.comment])
+        else:
+            return self.create_transaction('rmodw', self.get_addr(t), value, mask, [prev.comment, t.comment])
+
+    def find_last_alias(self, ops, key):
+        for i in range(len(ops) - 1, -1, -1):
+            if isinstance(ops[i], str):
+                continue
+            k = self.get_key(ops[i])
+            if (k == key) or not self.is_memory(k):
+                return i
+
+        return None
+
+    def is_memory(self, key):
+        return isinstance(key, int) and any((start <= key <= end) for (start, end) in self.memory_ranges)
+
+    def is_barrier(self, t):
+        addr = self.get_addr(t)
+        if "_SYM_" in addr:
+            return True
+
+        key = self.get_key(t)
+        if isinstance(key, int):
+            return key in self.lock_addrs
+        else:
+            return any(name in key for name in default_lock_names)
+
+    def get_params(self, t):
+        if isinstance(t.params, list):
+            return [str(p).strip() for p in t.params]
+        else:
+            return [p.strip() for p in t.params.split(',')]
+
+    def get_addr(self, t):
+        return self.get_params(t)[0]
+
+    def get_key(self, t):
+        addr = self.get_addr(t)
+        value = self.parse_literal(addr)
+        if value is None:
+            return addr.upper()
+
+        return value
+
+    def get_value(self, t):
+        return self.parse_literal(self.get_params(t)[1])
+
+    def get_mask(self, t):
+        return self.parse_literal(self.get_params(t)[2])
+
+    def parse_literal(self, s):
+        try:
+            return int(s, 0) & 0xFFFFFFFF
+        except ValueError:
+            return None
+
+    def join_comments(self, comments):
+        comments = [c.strip() for c in comments if (c is not None) and (c.strip() != '')]
+        if len(comments) == 0:
+            return None
+
+        return ' '.join(comments)
+
+    def copy_transaction(self, t, comments):
+        return wisce_script_function(t.cmd, t.params, self.join_comments(comments), t.length)
+
+    def create_transaction(self, cmd, addr, value, mask, comments):
+        params = [addr, "0x{:08x}".format(value)]
+        if cmd == 'rmodw':
+            params.append("0x{:08x}".format(mask))
+        # Array words, including the REGMAP_ARRAY_RMODW marker
+        length = 4 if (cmd == 'rmodw') else 2
+
+        if self.command == 'c_array':
+            params = ', '.join(params)
+
+        return wisce_script_function(cmd, params, self.join_comments(comments), length)
+
+    def create_block_write(self, writes):
+        addr = "0x{:04x}".format(self.get_key(writes[0]))
+        values = [self.get_value(t) for t in writes]
+        comments = self.join_comments([t.comment for t in writes])
+
+        if self.command == 'c_array':
+            # Byte swap for casting into uint8_ts, as for imported block writes
+            data = ["0x{:08x}".format(int.from_bytes(v.to_bytes(4, 'big'), 'little')) for v in values]
+            data = [', '.join(data[i:i + 8]) for i in range(0, len(data), 8)]
+            params = addr + ', ' + hex(len(values)) + ',\n{space}{space}' + ',\n{space}{space}'.join(data)
+
+            return wisce_script_function('block_write', params, comments, len(values) + 3)
+        else:
+            data = ["0x{:02x}".format(b) for v in values for b in v.to_bytes(4, 'big')]
+            data = [', '.join(data[i:i + 16]) for i in range(0, len(data), 16)]
+            data = "(uint8_t[]){" + (",\n" + ("{space}" * 6)).join(data) + "}"
+
+            return wisce_script_function('block_write', [addr, data, str(len(values) * 4)], comments)
+
+    def get_stats(self, transaction_list):
+        stats = dict.fromkeys(['write', 'rmodw', 'block_write', 'delay', 'other', 'transactions', 'words'], 0)
+        for t in transaction_list:
+            if isinstance(t, str):
+                continue
+
+            if t.cmd in delay_cmds:
+                stats['delay'] += 1
+            elif t.cmd in stats:
+                stats[t.cmd] += 1
+                # An RMW is a read followed by a write
+                stats['transactions'] += 2 if (t.cmd == 'rmodw') else 1
+            else:
+                stats['other'] += 1
+
+            if t.length is not None:
+                stats['words'] += t.length
+
+        return stats
+
+    def report(self):
+        if (self.stats_before is None):
+            return ''
+
+        lines = ["Register sequence optimization:",
+                 "{:<24}{:>8}{:>8}".format('', 'Before', 'After')]
+        rows = [('Writes', 'write'),
+                ('RMWs', 'rmodw'),
+                ('Block writes', 'block_write'),
+                ('Delays', 'delay'),
+                ('Bus transactions', 'transactions')]
+        if self.command == 'c_array':
+            rows.append(('Array words', 'words'))
+        for (label, key) in rows:
+            lines.append("{:<24}{:>8}{:>8}".format(label, self.stats_before[key], self.stats_after[key]))
+
+        return '\n'.join(lines) + '\n'
+
+    def summary(self):
+        return "Optimized from " + str(self.stats_before['transactions']) + " to " + \
+               str(self.stats_after['transactions']) + " bus transactions"
+
+# ==========================================================================
+# HELPER FUNCTIONS
+# ==========================================================================
+
+# ==========================================================================
+# MAIN PROGRAM
+# ==========================================================================
@@ -32,6 +32,7 @@ from sdk_version import print_sdk_version
 import argparse
 import script_importer
 from wisce_script_exporter_factory import wisce_script_exporter_factory, exporter_types
+from register_sequence_optimizer import register_sequence_optimizer
 
 # ==========================================================================
 # VERSION
@@ -50,6 +51,13 @@ supported_commands = exporter_types
 # HELPER FUNCTIONS
 # ==========================================================================
 
+def parse_range(s):
+    (start, end) = [int(x, 0) for x in s.split('-')]
+    if (end < start):
+        raise argparse.ArgumentTypeError("range end is below start: " + s)
+
+    return (start, end)
+
 def get_args(args):
     """Parse arguments"""
     parser = argparse.ArgumentParser(description='Parse command line arguments')
@@ -65,6 +73,21 @@ def get_args(args):
     parser.add_argument('-sym', '--symbol_file', dest='symbol_file', type=str, default=None,
                         help='The filename containing firmware symbols, produced by firmware_converter. ' +
                              'Needed to differentiate between normal named registers and firmware registers.')
+    parser.add_argument('--optimize', dest='optimize', action="store_true",
+                        help='Merge consecutive writes to contiguous registers into block writes, and remove dead ' +
+                             'writes and fold RMWs within --memory-range.  Transactions are never reordered.')
+    parser.add_argument('--reg-stride', dest='reg_stride', type=lambda x: int(x, 0), default=4,
+                        help='Address increment between contiguous registers when merging block writes.')
+    parser.add_argument('--block-min-regs', dest='block_min_regs', type=int, default=2,
+                        help='Minimum number of contiguous writes to merge into a block write, or 0 to disable ' +
+                             'merging, i.e. for parts with 16-bit registers.')
+    parser.add_argument('--lock-reg', dest='lock_regs', type=lambda x: int(x, 0), action='append', default=None,
+                        help='Address of a register whose writes change the register lock.  May be repeated. ' +
+                             'Defaults to 0x40 (TEST_KEY_CTRL).')
+    parser.add_argument('--memory-range', dest='memory_ranges', type=parse_range, action='append', default=None,
+                        help='Inclusive address range START-END with no side effects on access, i.e. DSP memory, ' +
+                             'so repeated writes may be removed and RMWs folded.  May be repeated.  All other ' +
+                             'addresses are treated as registers with side effects.')
 
     return parser.parse_args(args[1:])
 
@@ -143,8 +166,19 @@ def main(argv):
     elif (args.command == 'c_functions'):
         wse.add_exporter('c_functions')
 
+    # Optimize transaction list
+    transaction_list = script_imp.get_transaction_list()
+    if (args.optimize):
+        rso = register_sequence_optimizer(args.command,
+                                          args.reg_stride,
+                                          args.block_min_regs,
+                                          args.lock_regs,
+                                          args.memory_ranges)
+        transaction_list = rso.optimize(transaction_list)
+        print_results(rso.report())
+
     # Export transaction list to exporter
-    for t in script_imp.get_transaction_list():
+    for t in transaction_list:
         wse.add_transaction(t)
 
     # Add metadata text
@@ -154,6 +188,8 @@ def main(argv):
     for arg in argv:
         temp_line = temp_line + ' ' + arg
     metadata_text_lines.append('Command: ' + temp_line)
+    if (args.optimize):
+        metadata_text_lines.append(rso.summary())
 
     for line in metadata_text_lines:
         wse.add_metadata_text_line(line)